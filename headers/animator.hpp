@@ -0,0 +1,46 @@
+#ifndef ANIMATOR_HPP
+#define ANIMATOR_HPP
+
+#include <array>
+#include <vector>
+
+// Owns the frame state of every character/enemy animation clip in contiguous arrays.
+// Only clips that are playing get advanced; entities refer to their clips by index.
+class Animator
+{
+public:
+    // clip id that Add never hands out, for slots without a sheet and entities that play nothing
+    static constexpr int NoClip{-1};
+
+    template <std::size_t N>
+    static constexpr std::array<int, N> NoClips()
+    {
+        std::array<int, N> Clips{};
+        Clips.fill(NoClip);
+        return Clips;
+    }
+
+    Animator() = default;
+
+    int Add(const int MaxFramesX, const float UpdateTime);
+    void Play(const int Clip);
+    void Stop(const int Clip);
+    void Tick(const float DeltaTime);
+
+    int GetFrame(const int Clip) const {return FrameX.at(Clip);}
+    bool IsPlaying(const int Clip) const {return Slot.at(Clip) != -1;}
+
+    // frame of a looping animation taken from the global clock, for props that are never ticked
+    static int AmbientFrame(const int MaxFramesX, const float UpdateTime);
+
+private:
+    std::vector<int> FrameX{};
+    std::vector<int> MaxFramesX{};
+    std::vector<float> UpdateTime{};
+    std::vector<float> RunningTime{};
+
+    std::vector<int> Playing{};        // dense list of clips to advance
+    std::vector<int> Slot{};           // position of each clip in Playing, -1 when stopped
+};
+
+#endif // ANIMATOR_HPP
@@ -0,0 +1,116 @@
+#ifndef ARCHETYPE_HPP
+#define ARCHETYPE_HPP
+
+#include <array>
+#include <cstddef>
+#include "background.hpp"
+#include "voices.hpp"
+
+enum class EnemyType
+{
+    BEAR, BEHOLDER, CREATURE, GHOST,
+    IMP, MUSHROOM, NECROMANCER, SHADOW,
+    SPIDER, TOAD, NORMAL, BOSS, NPC,
+    FINALBOSS, FOX, CROW, SQUIRREL, DEFAULT
+};
+
+// Hitbox as a fraction of the current frame size
+struct FrameBox
+{
+    float X{};
+    float Y{};
+    float Width{1.f};
+    float Height{1.f};
+};
+
+// Distance band an enemy keeps from the player while chasing
+struct AggroRange
+{
+    float Min{60.f};
+    float Max{150.f};
+};
+
+struct RollRange
+{
+    int Min{};
+    int Max{};
+};
+
+// Constants shared by every enemy of one race
+struct EnemyArchetype
+{
+    EnemyType Race{};
+    bool Ranged{false};
+    float Speed{1.4f};
+    std::array<AggroRange, 4> Aggro{};          // indexed by Direction
+    FrameBox Collision{.31f, .31f, .40f, .60f};
+    Cue AttackCue{Cue::MONSTERATTACK};
+    RollRange MoveRange{60, 80};
+    RollRange IdleTime{3, 6};
+    RollRange LeftRight{1, 10};
+    RollRange ActionState{1, 10};
+};
+
+namespace Archetype
+{
+    // ranged enemies hold further back when facing down or right
+    inline constexpr std::array<AggroRange, 4> RangedAggro{{{140.f, 200.f}, {80.f, 260.f}, {140.f, 200.f}, {80.f, 260.f}}};
+
+    constexpr EnemyArchetype Melee(const EnemyType Race)
+    {
+        return EnemyArchetype{.Race = Race};
+    }
+
+    constexpr EnemyArchetype Ranged(const EnemyType Race)
+    {
+        return EnemyArchetype{.Race = Race, .Ranged = true, .Aggro = RangedAggro, .AttackCue = Cue::MONSTERRANGEDATTACK};
+    }
+
+    constexpr EnemyArchetype Wildlife(const EnemyType Race, const FrameBox Collision)
+    {
+        return EnemyArchetype{.Race = Race, .Collision = Collision};
+    }
+}
+
+// One record per EnemyType, only the races are ever looked up
+inline constexpr std::array<EnemyArchetype, static_cast<size_t>(EnemyType::DEFAULT) + 1> Archetypes
+{{
+    Archetype::Melee(EnemyType::BEAR),
+    Archetype::Ranged(EnemyType::BEHOLDER),
+    Archetype::Melee(EnemyType::CREATURE),
+    Archetype::Melee(EnemyType::GHOST),
+    Archetype::Ranged(EnemyType::IMP),
+    Archetype::Melee(EnemyType::MUSHROOM),
+    Archetype::Ranged(EnemyType::NECROMANCER),
+    Archetype::Melee(EnemyType::SHADOW),
+    Archetype::Melee(EnemyType::SPIDER),
+    Archetype::Melee(EnemyType::TOAD),
+    Archetype::Melee(EnemyType::NORMAL),
+    Archetype::Melee(EnemyType::BOSS),
+    Archetype::Melee(EnemyType::NPC),
+    Archetype::Melee(EnemyType::FINALBOSS),
+    Archetype::Wildlife(EnemyType::FOX, FrameBox{.31f, .40f, .40f, .30f}),
+    Archetype::Wildlife(EnemyType::CROW, FrameBox{.31f, .31f, .40f, .30f}),
+    Archetype::Wildlife(EnemyType::SQUIRREL, FrameBox{.35f, .35f, .20f, .30f}),
+    Archetype::Melee(EnemyType::DEFAULT)
+}};
+
+constexpr const EnemyArchetype& GetArchetype(const EnemyType Race) {return Archetypes[static_cast<size_t>(Race)];}
+
+namespace Archetype
+{
+    constexpr bool InOrder()
+    {
+        for (size_t i{}; i < Archetypes.size(); ++i) {
+            if (static_cast<size_t>(Archetypes[i].Race) != i) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+static_assert(Archetype::InOrder(), "Archetypes rows are out of order with EnemyType");
+static_assert(static_cast<int>(Direction::UP) == 0 && static_cast<int>(Direction::RIGHT) == 3, "Aggro ranges are indexed by Direction");
+
+#endif // ARCHETYPE_HPP
@@ -0,0 +1,40 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+
+// Everything that belongs to one map is built straight into containers drawn from that map's
+// arena; releasing the arena frees all of its blocks at once.
+namespace Arena
+{
+    // Monotonic arena for one map. The loader jobs fill it from several threads at once, so every
+    // allocation takes the lock; once the world is built nothing contends for it. Freeing a single
+    // block does nothing, Release hands every block back in one go.
+    class Resource : public std::pmr::memory_resource
+    {
+    public:
+        explicit Resource(const size_t InitialBytes);
+
+        // only once nothing allocated from the arena is alive any more
+        void Release();
+
+    private:
+        void* do_allocate(const size_t Bytes, const size_t Alignment) override;
+        void do_deallocate(void* Block, const size_t Bytes, const size_t Alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& Other) const noexcept override;
+
+        std::mutex Lock{};
+        std::pmr::monotonic_buffer_resource Blocks;
+    };
+
+    // Room for Count elements of T, with the padding an arena adds between blocks
+    template <typename T>
+    constexpr size_t Bytes(const size_t Count)
+    {
+        return Count * sizeof(T) + alignof(std::max_align_t);
+    }
+}
+
+#endif // ARENA_HPP
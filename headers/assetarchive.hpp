@@ -0,0 +1,91 @@
+#ifndef ASSETARCHIVE_HPP
+#define ASSETARCHIVE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <raylib.h>
+
+// On-disk layout shared by the offline packer and the game: a header, an index sorted by path,
+// then every asset's payload aligned for direct use. Images are stored as raw RGBA8, sound
+// effects as the PCM LoadWave would produce and music as its original compressed stream.
+namespace Pack
+{
+    constexpr uint32_t Magic{0x4B505846};       // "FXPK"
+    constexpr uint32_t Version{1};
+    constexpr size_t PathLength{80};
+    constexpr size_t Alignment{16};
+
+    enum class Kind : uint32_t {IMAGE, WAVE, STREAM};
+
+    struct Header
+    {
+        uint32_t Magic{};
+        uint32_t Version{};
+        uint32_t Count{};
+        uint32_t Reserved{};
+    };
+
+    struct Entry
+    {
+        char Path[PathLength]{};
+        Kind Type{};
+        uint32_t Width{};           // images
+        uint32_t Height{};
+        uint32_t Format{};
+        uint32_t Frames{};          // waves
+        uint32_t SampleRate{};
+        uint32_t SampleSize{};
+        uint32_t Channels{};
+        uint64_t Offset{};          // from the start of the archive
+        uint64_t Size{};
+    };
+
+    static_assert(sizeof(Header) % Alignment == 0, "Pack header must keep the index aligned");
+    static_assert(sizeof(Entry) % Alignment == 0, "Pack entries must keep the data aligned");
+}
+
+// Read-only view of a packed archive. The file is memory mapped, so nothing is read until an
+// asset is touched and every lookup hands back pointers into the mapping without a copy.
+// A missing archive, or one written by another Pack::Version, leaves it closed and callers
+// fall back to the loose files. The build repacks it whenever an asset changes.
+class AssetArchive
+{
+public:
+    explicit AssetArchive(const char* Path);
+    ~AssetArchive();
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+
+    bool IsOpen() const {return Count > 0;}
+    const Pack::Entry* Find(const char* Path) const;
+
+    // Views into the mapping. They must never be passed to UnloadImage or UnloadWave.
+    bool GetImage(const char* Path, Image& View) const;
+    bool GetWave(const char* Path, Wave& View) const;
+    bool GetStream(const char* Path, const unsigned char*& Bytes, int& Size) const;
+
+private:
+    void Close();
+
+    const unsigned char* Base{};
+    size_t Length{};
+    const Pack::Entry* Index{};
+    uint32_t Count{};
+    std::vector<unsigned char> Buffer{};      // holds the whole file where mmap is unavailable
+};
+
+// Loading entry points the rest of the game goes through. Each prefers the archive next to
+// the executable and quietly falls back to the loose file when an asset is not packed.
+namespace Assets
+{
+    constexpr const char* ArchivePath{"assets.pak"};
+
+    const AssetArchive& Archive();
+    Texture2D LoadTexture(const char* Path);
+    Image LoadImage(const char* Path, bool& Owned);   // Owned images go back through UnloadImage
+    Wave LoadWave(const char* Path, bool& Owned);     // Owned waves go back through UnloadWave
+    Music LoadMusicStream(const char* Path);
+}
+
+#endif // ASSETARCHIVE_HPP
@@ -18,7 +18,7 @@ enum class Area
 class Background
 {
 public:
-    explicit Background(const GameTexture& GameTextures, const GameAudio& Audio);
+    explicit Background(const GameTexture& GameTextures, GameAudio& Audio);
     ~Background() = default;
     constexpr Background(const Background&) = delete;
     constexpr Background(Background&&) = default;
@@ -39,7 +39,7 @@ public:
     
 private:
     const GameTexture& GameTextures;
-    const GameAudio& Audio;
+    GameAudio& Audio;
     Vector2 MapPos{0.f, 0.f};
     float Scale{4.f};
     Area Map{Area::FOREST};
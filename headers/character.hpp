@@ -1,6 +1,7 @@
 #ifndef CHARACTER_HPP
 #define CHARACTER_HPP
 
+#include <limits>
 #include "enemy.hpp"
 
 enum class Emotion 
@@ -26,20 +27,22 @@ public:
               const Sprite& Sleep, 
               const Sprite& ItemGrab,
               const GameTexture& GameTextures,
-              const GameAudio& Audio, 
+              GameAudio& Audio, 
               const Window& Screen, 
-              Background& World);
+              Background& World,
+              Animator& Animations);
     
-    void Tick(float DeltaTime, Props& Props, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees);
+    void Tick(Props& Props, std::pmr::vector<Enemy>& Enemies, std::pmr::vector<Prop>& Trees);
     void Draw();
-    void SpriteTick(float DeltaTime);
+    void SpriteTick();
     void UpdateScreenPos();
     void CheckDirection();
-    void CheckMovement(Props& Props, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees);
+    void CheckMovement(Props& Props, std::pmr::vector<Enemy>& Enemies, std::pmr::vector<Prop>& Trees);
+    Vector2 SweepMovement(Vector2 Delta, Props& Props, std::pmr::vector<Prop>& Trees);
     void UndoMovement();
     void CheckOutOfBounds();
-    void CheckCollision(std::vector<std::vector<Prop>>& Props, const Vector2 Direction, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees);
-    void CheckCollision(std::vector<Enemy>& Enemies);
+    void CheckCollision(std::pmr::vector<std::pmr::vector<Prop>>& Props, const Vector2 Direction, std::pmr::vector<Enemy>& Enemies);
+    void CheckCollision(std::pmr::vector<Enemy>& Enemies);
     void WalkOrRun();
     void CheckAttack();
     void UpdateSource();
@@ -51,6 +54,7 @@ public:
     void SetWorldPos(Vector2 Pos) {WorldPos = Pos;}
     void DrawIndicator();
     void TakeDamage();
+    void TakeHit(const float Damage);
     void CheckMapChange(const Area& CurrentMap);
     void MapChangeWorldPos(const Area& NextMap);
     void CheckDungeonExit(Enemy& FinalBoss);
@@ -82,12 +86,14 @@ public:
     void HealOverTime(float HP, float TimeToHeal = 0.6f);
     void CheckHealing();
     void SwitchCollidable() {Collidable = !Collidable;}
+    constexpr bool IsCollidable() const {return Collidable;}
     
 private:
     const GameTexture& GameTextures;
-    const GameAudio& Audio;
+    GameAudio& Audio;
     const Window& Screen;
     Background& World;
+    Animator& Animations;
     Vector2 Offset{615.f,335.f};         // Player offset vs Enemy/Prop WorldPos
     Vector2 ScreenPos{};                 // Where the character is on the screen
     Vector2 WorldPos{344.f,2560.f};      // Where the character is in the world
@@ -98,9 +104,12 @@ private:
     Area PrevMap{};
     Rectangle Source{};
     Rectangle Destination{};
-    std::vector<Sprite> Sprites{};
+    std::array<Sprite, 9> Sprites{};
+    std::array<int, 9> Clips{Animator::NoClips<9>()};
+    std::vector<Rectangle> Blockers{};      // solid props in the path of this frame's step, reused every frame
 
     int SpriteIndex{};
+    int PlayingClip{Animator::NoClip};
     float Health{11.f};
     float Scale{1.5f};
     float Speed{1.0f};
@@ -108,6 +117,7 @@ private:
     float DamageTime{};
     float AttackTime{};
     float HealTime{};
+    float Healed{std::numeric_limits<float>::max()};     // so the first heal is skipped, as it always was
     float WalkingAudioTime{};
     float PushingAudioTime{};
     float DamageAudioTime{};
@@ -135,6 +145,8 @@ private:
 
     // Debug controls
     bool Collidable{true};
+
+    static constexpr float Skin{0.05f};     // contact slack, so a fox resting against a wall can still slide along it
 };
 
 #endif // CHARACTER_HPP
@@ -0,0 +1,48 @@
+#ifndef CUEQUEUE_HPP
+#define CUEQUEUE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <raylib.h>
+
+enum class Cue;
+
+// A request to play one cue, optionally from a world position
+struct CueEvent
+{
+    Cue Effect{};
+    float Volume{1.f};
+    Vector2 Emitter{};
+    bool Positioned{false};
+};
+
+// Bounded ring that any thread can post cue events into and one audio consumer drains.
+// Every slot carries a sequence number, so producers only race on the head index and never
+// block: a post into a full ring is dropped, the same as a cue that loses its voice.
+class CueQueue
+{
+public:
+    CueQueue();
+    CueQueue(const CueQueue&) = delete;
+    CueQueue& operator=(const CueQueue&) = delete;
+
+    bool Push(const CueEvent& Event);
+    bool Pop(CueEvent& Event);
+
+    static constexpr size_t Capacity{256};
+    static_assert((Capacity & (Capacity - 1)) == 0, "CueQueue capacity must be a power of two");
+
+private:
+    struct Slot
+    {
+        std::atomic<size_t> Sequence{};
+        CueEvent Event{};
+    };
+
+    std::array<Slot, Capacity> Ring{};
+    alignas(64) std::atomic<size_t> Head{};     // shared by producers
+    alignas(64) size_t Tail{};                  // consumer only
+};
+
+#endif // CUEQUEUE_HPP
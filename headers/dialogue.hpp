@@ -0,0 +1,44 @@
+#ifndef DIALOGUE_HPP
+#define DIALOGUE_HPP
+
+#include <map>
+#include "prop.hpp"
+
+struct DialoguePage
+{
+    std::vector<std::string> Lines{};
+    Vector2 Origin{390.f, 550.f};
+    Progress Next{Progress::ACT_O};     // ACT_O closes the dialogue
+    bool SmallBox{false};
+};
+
+// Dialogue pages loaded from a text table, keyed by speaker and act/page.
+// The open page is laid out into a render texture once and drawn with a single call per frame.
+class Dialogue
+{
+public:
+    explicit Dialogue(const std::string& Path);
+    ~Dialogue();
+    Dialogue(const Dialogue&) = delete;
+    Dialogue(Dialogue&& Other) noexcept;
+    Dialogue& operator=(const Dialogue&) = delete;
+    Dialogue& operator=(Dialogue&&) = delete;
+
+    void Draw(const PropType Speaker, const int Page, const std::string_view Item = "");
+    Progress GetNext(const PropType Speaker, const int Page) const;
+
+private:
+    void Load(const std::string& Path);
+    void Compose(const PropType Speaker, const int Page, const std::string_view Item);
+
+    std::map<std::pair<PropType, int>, DialoguePage> Pages{};
+    RenderTexture2D Target{};
+    Rectangle Bounds{};
+
+    // page currently laid out in Target
+    std::pair<PropType, int> Current{PropType::PLACEHOLDER, -1};
+    std::string CurrentItem{};
+    bool Composed{false};
+};
+
+#endif // DIALOGUE_HPP
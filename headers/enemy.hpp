@@ -6,26 +6,46 @@
 #include "prop.hpp"
 #include "window.hpp"
 #include "randomizer.hpp"
-
-enum class EnemyType 
-{
-    BEAR, BEHOLDER, CREATURE, GHOST, 
-    IMP, MUSHROOM, NECROMANCER, SHADOW, 
-    SPIDER, TOAD, NORMAL, BOSS, NPC,
-    FINALBOSS, FOX, CROW, SQUIRREL, DEFAULT
-};
+#include "ui.hpp"
+#include "animator.hpp"
+#include "archetype.hpp"
+#include "patterns.hpp"
 
 enum class Monster 
 {
     IDLE, WALK, ATTACK, HURT, DEATH, PROJECTILE
 }; 
 
-enum class NPC 
+struct Enemies;
+
+// How many monsters of each race are alive in one world, and how many ever lived or died
+struct MonsterTally
 {
-    IDLE, IDLETWO, WALK, MISC, SLEEP
+    std::unordered_map<EnemyType, int> Alive
+    {
+        {EnemyType::BEAR, 0}, {EnemyType::BEHOLDER, 0}, 
+        {EnemyType::CREATURE, 0}, {EnemyType::GHOST, 0}, 
+        {EnemyType::IMP, 0}, {EnemyType::MUSHROOM, 0},
+        {EnemyType::NECROMANCER, 0}, {EnemyType::SHADOW, 0}, 
+        {EnemyType::SPIDER, 0}, {EnemyType::TOAD, 0},
+        {EnemyType::BOSS, 0} 
+    };
+    int Deaths{};
+    int Count{};
 };
 
-struct Enemies;
+// World services every enemy shares, one instance per game
+struct EnemyContext
+{
+    const Window& Screen;
+    Background& World;
+    Animator& Animations;
+    Projectiles& Missiles;
+    const GameTexture& GameTextures;
+    GameAudio& Audio;
+    Randomizer& RandomEngine;       // root stream, each enemy splits its own off it
+    MonsterTally& Monsters;
+};
 
 class Enemy
 {
@@ -40,41 +60,26 @@ public:
           const EnemyType Race,
           const EnemyType Type,
           const Vector2 WorldPos,
-          const Window& Screen,
-          Background& World,
-          const GameTexture& GameTextures,
-          const GameAudio& Audio,
-          Randomizer& RandomEngine,
+          EnemyContext& Context,
           const int Health = 3,
           const float Scale = 3.2f,
           const EnemyType BossSpawner = EnemyType::DEFAULT);
-    
-    // Wildlife NPC constructor
-    Enemy(const Sprite& NpcIdle,
-          const Sprite& NpcIdleTwo,
-          const Sprite& NpcWalk,
-          const Sprite& NpcMisc,
-          const Sprite& NpcSleep,
-          const EnemyType Race,
-          const Vector2 WorldPos,
-          const Window& Screen,
-          Background& World,
-          const GameTexture& GameTextures,
-          const GameAudio& Audio,
-          Randomizer& RandomEngine,
-          const float Scale = 3.2f);
 
-    void Tick(float DeltaTime, Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees);
-    void Draw(const Vector2 HeroWorldPos);
-    void SpriteTick(float DeltaTime);
+    void Tick(float DeltaTime, Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, std::pmr::vector<Enemy>& Enemies, std::pmr::vector<Prop>& Trees);
+    void Draw(const Vector2 HeroWorldPos, UILayer& Interface);
+    void CollectTextures(std::vector<Texture2D>& Into) const;
+    void SpriteTick();
+    void StopSprites();
     void UpdateScreenPos(Vector2 HeroWorldPos);
     void CheckDirection();
-    void CheckMovement(Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees);
+    void CheckMovement(Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, std::pmr::vector<Enemy>& Enemies, std::pmr::vector<Prop>& Trees);
     void NeutralAction();
     void UndoMovement();
     void CheckOutOfBounds();
-    void CheckCollision(std::vector<std::vector<Prop>>& Props, const Vector2 HeroWorldPos, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees);
+    void CheckCollision(std::pmr::vector<std::pmr::vector<Prop>>& Props, const Vector2 HeroWorldPos, std::pmr::vector<Enemy>& Enemies, std::pmr::vector<Prop>& Trees);
+    void Avoid(const Vector2 OtherScreenPos);
     void CheckAttack();
+    void Shoot(const Vector2 HeroScreenPos);
     void UpdateSource();
     void TakeDamage();
     void CheckAlive(float DeltaTime);
@@ -82,9 +87,9 @@ public:
     void EnemyAggro(const Vector2 HeroScreenPos);
     void CheckMovementAI();
     void InitializeAI();
-    void DrawHP();
+    void DrawHP(UILayer& Interface);
     void CheckBossSummon(const Vector2 HeroWorldPos);
-    void CheckSpawnChest(std::vector<std::vector<Prop>>& Props);
+    void CheckSpawnChest(std::pmr::vector<std::pmr::vector<Prop>>& Props);
 
     // Audio
     void WalkingAudio();
@@ -98,28 +103,30 @@ public:
     constexpr bool IsSummoned() const {return Summoned;}
     constexpr bool IsInvulnerable() const {return Invulnerable;}
     constexpr bool IsAttacking() const {return Attacking;}
+    constexpr bool IsRanged() const {return Archetype.Ranged;}
     constexpr bool IsDying() const {return Dying;}
     constexpr int GetHealth() const {return Health;}
     constexpr int GetMaxHP() const {return MaxHP;}
-    int GetMonstersKilled() {return MonsterDeaths;}
-    int GetTotalMonsters() {return MonsterCount;}
+    int GetMonstersKilled() {return Context.Monsters.Deaths;}
+    int GetTotalMonsters() {return Context.Monsters.Count;}
     constexpr Vector2 GetWorldPos() const {return WorldPos;}
     constexpr Vector2 GetPrevWorldPos() const {return PrevWorldPos;}
     constexpr Vector2 GetEnemyPos() const {return ScreenPos;}
     constexpr EnemyType GetType() const {return Type;}
     constexpr EnemyType GetRace() const {return Race;}
+    const AggroRange& GetAggroRange() const {return Archetype.Aggro.at(static_cast<size_t>(Face));}
     Rectangle GetCollisionRec();
     Rectangle GetAttackRec();
-    Vector2 UpdateProjectile();
-    std::array<Vector2,3> UpdateMultiProjectile();
     bool WithinScreen(const Vector2 HeroWorldPos);
-    int GetMonsterCount(const EnemyType Type) {return MonsterCounter.at(Type);}
+    int GetMonsterCount(const EnemyType Type) {return Context.Monsters.Alive.at(Type);}
     
 private:
-    std::vector<Sprite> Sprites{};
+    std::array<Sprite, 6> Sprites{};
+    std::array<int, 6> Clips{Animator::NoClips<6>()};     // only races with a sheet in a slot get a clip there
+    HealthBar HPBar{};
 
     const EnemyType Race{};
-    const EnemyType Type{};           // If the Enemy is NORMAL, BOSS, or NPC type
+    const EnemyType Type{};           // If the Enemy is NORMAL, BOSS, or FINALBOSS type
 
     Vector2 ScreenPos{};                  
     Vector2 WorldPos{};                  
@@ -127,27 +134,19 @@ private:
     Vector2 Movement{};
     Rectangle Source{};
     Rectangle Destination{};
-    const Window& Screen;
-    Background& World;
-    const GameTexture& GameTextures;
-    const GameAudio& Audio;
-    Randomizer& RandomEngine;
+    EnemyContext& Context;
+    const EnemyArchetype& Archetype;    // per-race constants shared by every instance
+    Randomizer Random;                  // this enemy's own stream, so AI rolls never touch shared state
+    Emitter Volley{};                   // boss bullet patterns, empty for everyone else
     EnemyType BossSpawner{};    // Spawn Boss after this EnemyType is all killed
     
-    static int MonsterDeaths;
-    static int MonsterCount;
     int CurrentSpriteIndex{};
     int ShootingSpriteIndex{};
-    int AttackRecIndex{};
+    int PlayingClip{Animator::NoClip};
     int Health{};
     int MaxHP{};
     int LeftOrRight{};
-    int ActionState{};
     float Scale{3.2f};
-    float Speed{1.4f};
-    float Radius{25.f};                 
-    float MaxRange{150.f};
-    float MinRange{60.f};
     float MinCollisionRange{0.5f};
     float RunningTime{};
     float DamageTime{};
@@ -160,7 +159,7 @@ private:
     float MoveYRange{};
     float AIX{0.6f};
     float AIY{0.6f};
-    float Trajectory{1.f};
+    float ShotTime{ShotInterval};
     bool Alive{true};
     bool Colliding{false};
     bool Attacking{false};
@@ -174,23 +173,12 @@ private:
     bool Hurting{false};
     bool InitializedAI{false};
     bool OOB{false};
-    bool Ranged{false};
     bool Summoned{true};
     bool Visible{false};
-
-    // Wildlife NPC
-    bool IdleTwo{false};
-    bool Sleeping{false};
-    bool MiscAction{false};
     
     Direction Face{Direction::DOWN};
 
-    std::uniform_int_distribution<int> RandomRange{60,80};
-    std::uniform_int_distribution<int> RandomIdleTime{3,6};
-    std::uniform_int_distribution<int> RandomLeftRight{1,10};
-    std::uniform_int_distribution<int> RandomActionState{1,10};
-
-    static std::unordered_map<EnemyType, int> MonsterCounter;
+    static constexpr float ShotInterval{Projectiles::Lifetime};     // one volley in the air at a time
 };
 
 #endif // ENEMY_HPP
@@ -2,7 +2,14 @@
 #define GAME_HPP
 
 #include <array>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include "arena.hpp"
 #include "hud.hpp"
+#include "dialogue.hpp"
+#include "scene.hpp"
+#include "spawn.hpp"
 
 namespace Game 
 {
@@ -14,6 +21,8 @@ namespace Game
     struct Info
     {
         Background Map;
+        Animator Animations;
+        Projectiles Missiles;
         int PauseFoxIndex{0};
         float Opacity{0.f};
         float MasterAudio{0.5f};
@@ -31,9 +40,12 @@ namespace Game
         bool DungeonThemePaused{false};
         bool PauseThemeStarted{false};
         bool PauseThemePaused{false};
+        bool Preparing{false};      // the next state's assets were requested this transition
         Game::State State{Game::State::TRANSITION};
         Game::State PrevState{Game::State::FOREST};
         Game::State NextState{Game::State::MAINMENU};
+        Questline Quest{};          // the world's own story and monster counts, so a fresh Info is a fresh game
+        MonsterTally Monsters{};
 
         // Debugging --------------------
         bool ShowPos{false};
@@ -45,45 +57,73 @@ namespace Game
         bool DrawRectanglesOn{false};
     };
 
+    // Entities that live in one map. Only the active area's set is ticked, drawn and collided
+    // against; the other one sits untouched until its map is entered again.
+    // Its containers all allocate from Memory, which is declared first so it outlives them.
+    struct AreaSet
+    {
+        std::unique_ptr<Arena::Resource> Memory;
+        Props PropsContainer;
+        std::pmr::vector<Enemy> Enemies;
+        std::pmr::vector<Prop> Trees;
+        Scene Scenery;
+        bool Active{false};
+    };
+
     struct Objects
     {
         HUD Hud;
         Character Fox;
-        Props PropsContainer;
-        std::vector<Enemy> Enemies;
-        std::vector<Enemy> Crows;
-        std::vector<Prop> Trees;
+        std::array<AreaSet, 2> Areas;       // indexed by Area
         std::array<Sprite, 5> PauseFox;
         std::array<const Texture2D, 9> Buttons;
+        UILayer Interface;
+        MenuPanel MainMenu;
+        MenuPanel ExitMenu;
+        MenuPanel GameOverMenu;
+        Dialogue Speech;
     };
 
     void Run();
     void Initialize(const Window& Window, const std::string& Title);
     void CheckScreenSizing(Window& Window);
-    void Tick(Window& Window, Game::Info& Info, Game::Objects& Objects, const GameTexture& Textures, const GameAudio& Audio);
-    void ForestUpdate(Game::Info& Info, Game::Objects& Objects, const GameAudio& Audio);
-    void ForestDraw(Game::Info& Info, Game::Objects& Objects);
-    void DungeonUpdate(Game::Info& Info, Game::Objects& Objects, const GameAudio& Audio);
-    void DungeonDraw(Game::Info& Info, Game::Objects& Objects);
-    void PauseUpdate(Game::Info& Info, Game::Objects& Objects, const GameAudio& Audio);
+    void Tick(Window& Window, Game::Info& Info, Game::Objects& Objects, GameTexture& Textures, GameAudio& Audio);
+    void ForestUpdate(Game::Info& Info, Game::Objects& Objects, GameAudio& Audio);
+    void ForestDraw(Game::Info& Info, Game::Objects& Objects, const GameTexture& Textures);
+    void DrawScenery(const Game::Info& Info, Game::Objects& Objects, const GameTexture& Textures, const DrawLayer Layer, const Color RecColor);
+    void DungeonUpdate(Game::Info& Info, Game::Objects& Objects, GameAudio& Audio);
+    void DungeonDraw(Game::Info& Info, Game::Objects& Objects, const GameTexture& Textures);
+    void PauseUpdate(Game::Info& Info, Game::Objects& Objects, GameAudio& Audio);
     void PauseDraw(const Game::Info& Info, Game::Objects& Objects, const GameTexture& Textures);
-    void ExitUpdate(Game::Info& Info, const GameAudio& Audio);
-    void ExitDraw(const Game::Info& Info);
-    void MainMenuUpdate(Game::Info& Info, const GameAudio& Audio);
-    void MainMenuDraw(const Game::Info& Info);
-    void GameOverUpdate(Game::Info& Info, const GameAudio& Audio);
-    void GameOverDraw(const Game::Info& Info);
-    void Transition(Game::Info& Info, const GameAudio& Audio);
+    void ExitUpdate(Game::Info& Info, GameAudio& Audio);
+    void ExitDraw(const Game::Info& Info, Game::Objects& Objects, const GameTexture& Textures);
+    void MainMenuUpdate(Game::Info& Info, GameAudio& Audio);
+    void MainMenuDraw(const Game::Info& Info, Game::Objects& Objects, const GameTexture& Textures);
+    void GameOverUpdate(Game::Info& Info, GameAudio& Audio);
+    void GameOverDraw(const Game::Info& Info, Game::Objects& Objects, const GameTexture& Textures);
+    void Transition(Game::Info& Info, Game::Objects& Objects, GameTexture& Textures, GameAudio& Audio);
+    void PrepareArea(Game::Info& Info, Game::Objects& Objects, GameTexture& Textures, const Area Next);
+    AreaSet& GetAreaSet(Game::Objects& Objects, const Area Where);
+    void ActivateArea(Game::Info& Info, Game::Objects& Objects, const Area Next);
+    void ResetArea(Game::AreaSet& Set);
+    std::vector<Texture2D> CollectTextures(Game::AreaSet& Set);
 
     HUD InitializeHud(const GameTexture& Textures);
-    Character InitializeFox(const Window& Window, Game::Info& Info, const GameTexture& Textures, const GameAudio& Audio);
-    std::array<Sprite,5> InitializePauseFox(const GameTexture& Textures);
+    MenuPanel InitializeMainMenu();
+    MenuPanel InitializeExitMenu();
+    MenuPanel InitializeGameOverMenu();
+    Character InitializeFox(const Window& Window, Game::Info& Info, const GameTexture& Textures, SpriteSheets& Sheets, GameAudio& Audio);
+    std::array<Sprite,5> InitializePauseFox(SpriteSheets& Sheets);
     std::array<const Texture2D,9> InitializeButtons(const GameTexture& Textures);
-    std::vector<std::vector<Prop>> InitializePropsUnder(const GameTexture& Textures, const GameAudio& Audio);
-    std::vector<std::vector<Prop>> InitializePropsOver(const GameTexture& Textures, const GameAudio& Audio);
-    std::vector<Prop> InitializeTrees(const GameTexture& Textures, const GameAudio& Audio);
-    std::vector<Enemy> InitializeEnemies(Background& MapBG, const Window& Window, const GameTexture& Textures, Randomizer& RandomEngine, const GameAudio& Audio);
-    std::vector<Enemy> InitializeCrows(Background& MapaBG, const Window& Window, const GameTexture& Textures, Randomizer& RandomEngine, const GameAudio& Audio);
+    std::array<AreaSet, 2> InitializeAreas(EnemyContext& Context, const GameTexture& Textures, SpriteSheets& Sheets, GameAudio& Audio, Questline& Quest);
+    std::pmr::vector<std::pmr::vector<Prop>> InitializePropsUnder(const GameTexture& Textures, SpriteSheets& Sheets, GameAudio& Audio, Questline& Quest, std::pmr::memory_resource* Memory);
+    std::pmr::vector<std::pmr::vector<Prop>> InitializePropsOver(const GameTexture& Textures, SpriteSheets& Sheets, GameAudio& Audio, Questline& Quest, std::pmr::memory_resource* Memory);
+    Scene InitializeScenery(EnemyContext& Context, SpriteSheets& Sheets, std::pmr::memory_resource* Memory);
+    std::pmr::vector<Prop> InitializeTrees(const GameTexture& Textures, SpriteSheets& Sheets, GameAudio& Audio, Questline& Quest, std::pmr::memory_resource* Memory);
+    std::pmr::vector<Enemy> InitializeEnemies(EnemyContext& Context, SpriteSheets& Sheets, const Area Where, std::pmr::memory_resource* Memory);
+    std::pmr::vector<Prop> SpawnProps(std::span<const PropSpawn> Spawns, const GameTexture& Textures, SpriteSheets& Sheets, GameAudio& Audio, Questline& Quest, std::pmr::memory_resource* Memory);
+    std::pmr::vector<Enemy> SpawnEnemies(std::span<const EnemySpawn> Spawns, EnemyContext& Context, SpriteSheets& Sheets, std::pmr::memory_resource* Memory);
+    void SpawnWildlife(std::span<const EnemySpawn> Spawns, Scene& Scenery, EnemyContext& Context, SpriteSheets& Sheets);
 
     // Debugging --------------------
     void DrawCollisionRecs(Prop& Prop, const Vector2 CharacterWorldPos, Color RecColor = {0, 121, 241, 150});
@@ -1,466 +1,480 @@
 #ifndef GAMETEXTURES_HPP
 #define GAMETEXTURES_HPP
 
+#include <cstddef>
+#include <span>
 #include <raylib.h>
+#include "residency.hpp"
 
+// Named handles for the textures the game refers to directly. Every file under sprites/ is
+// registered with the residency manager by its generated TextureID, named or not.
+// Read a handle's size directly, but draw what Use returns.
 struct GameTexture {
 
-    constexpr GameTexture() = default;
-    ~GameTexture();
+    explicit GameTexture(const size_t Budget = TextureResidency::DefaultBudget) : Resident{Budget} {}
     GameTexture(const GameTexture&) = delete;
     GameTexture(GameTexture&&) = default;
     GameTexture& operator=(const GameTexture&) = delete;
     GameTexture& operator=(GameTexture&&) = default;
 
-    const Texture2D AltarBot{LoadTexture("sprites/props/AltarBot.png")};
-    const Texture2D AltarBotAnimated{LoadTexture("sprites/props/AltarBotAnimated.png")};
-    const Texture2D AltarBotLeft{LoadTexture("sprites/props/AltarBotLeft.png")};
-    const Texture2D AltarBotLeftAnimated{LoadTexture("sprites/props/AltarBotLeftAnimated.png")};
-    const Texture2D AltarBotRight{LoadTexture("sprites/props/AltarBotRight.png")};
-    const Texture2D AltarBotRightAnimated{LoadTexture("sprites/props/AltarBotRightAnimated.png")};
-    const Texture2D AltarDormant{LoadTexture("sprites/props/AltarDormant.png")};
-    const Texture2D AltarDormantRust{LoadTexture("sprites/props/AltarDormantRust.png")};
-    const Texture2D AltarTop{LoadTexture("sprites/props/AltarTop.png")};
-    const Texture2D AltarTopAnimated{LoadTexture("sprites/props/AltarTopAnimated.png")};
-    const Texture2D AltarTopLeft{LoadTexture("sprites/props/AltarTopLeft.png")};
-    const Texture2D AltarTopLeftAnimated{LoadTexture("sprites/props/AltarTopLeftAnimated.png")};
-    const Texture2D AltarTopRight{LoadTexture("sprites/props/AltarTopRight.png")};
-    const Texture2D AltarTopRightAnimated{LoadTexture("sprites/props/AltarTopRightAnimated.png")};
-
-    const Texture2D AxeStump{LoadTexture("sprites/props/AxeStump.png")};
-    const Texture2D BigGrass{LoadTexture("sprites/props/BigGrass.png")};
-    const Texture2D Boulder{LoadTexture("sprites/props/Boulder.png")};
-
-    const Texture2D Bracelet{LoadTexture("sprites/props/Bracelet.png")};
-
-    const Texture2D BridgeHorizontal{LoadTexture("sprites/props/BridgeHorizontal.png")};
-    const Texture2D BridgeRopeBottom{LoadTexture("sprites/props/BridgeRopeBottom.png")};
-    const Texture2D BridgeRopeLeft{LoadTexture("sprites/props/BridgeRopeLeft.png")};
-    const Texture2D BridgeRopeRight{LoadTexture("sprites/props/BridgeRopeRight.png")};
-    const Texture2D BridgeRopeTop{LoadTexture("sprites/props/BridgeRopeTop.png")};
-    const Texture2D BridgeVertical{LoadTexture("sprites/props/BridgeVertical.png")};
-
-    const Texture2D Bush{LoadTexture("sprites/props/Bush.png")};
-    const Texture2D ClayPot{LoadTexture("sprites/props/ClayPot.png")};
-
-    const Texture2D Cryptex{LoadTexture("sprites/props/Cryptex.png")};
-
-    const Texture2D Door{LoadTexture("sprites/props/Door.png")};
-    const Texture2D DoorBlue{LoadTexture("sprites/props/DoorBlue.png")};
-    const Texture2D DoorRed{LoadTexture("sprites/props/DoorRed.png")};
-
-    const Texture2D DungeonEntrance{LoadTexture("sprites/props/DungeonEntrance.png")};
-
-    const Texture2D FenceDown{LoadTexture("sprites/props/FenceDown.png")};
-    const Texture2D FenceLeft{LoadTexture("sprites/props/FenceLeft.png")};
-    const Texture2D FenceRight{LoadTexture("sprites/props/FenceRight.png")};
-    const Texture2D FenceUp{LoadTexture("sprites/props/FenceUp.png")};
-
-    const Texture2D FlowerBush{LoadTexture("sprites/props/FlowerBush.png")};
-    const Texture2D Flowers{LoadTexture("sprites/props/Flowers.png")};
-
-    const Texture2D GrassAnimation{LoadTexture("sprites/props/GrassAnimation.png")};
-
-    const Texture2D GrassWallBotLeft{LoadTexture("sprites/props/GrassWallBotLeft.png")};
-    const Texture2D GrassWallBotRight{LoadTexture("sprites/props/GrassWallBotRight.png")};
-    const Texture2D GrassWallBottom{LoadTexture("sprites/props/GrassWallBottom.png")};
-    const Texture2D GrassWallInnerLeft{LoadTexture("sprites/props/GrassWallInnerLeft.png")};
-    const Texture2D GrassWallInnerRight{LoadTexture("sprites/props/GrassWallInnerRight.png")};
-    const Texture2D GrassWallLeft{LoadTexture("sprites/props/GrassWallLeft.png")};
-    const Texture2D GrassWallRight{LoadTexture("sprites/props/GrassWallRight.png")};
-    const Texture2D GrassWallTop{LoadTexture("sprites/props/GrassWallTop.png")};
-    const Texture2D GrassWallTopLeft{LoadTexture("sprites/props/GrassWallTopLeft.png")};
-    const Texture2D GrassWallTopRight{LoadTexture("sprites/props/GrassWallTopRight.png")};
-
-    const Texture2D Hole{LoadTexture("sprites/props/Hole.png")};
-
-    const Texture2D HouseBlue{LoadTexture("sprites/props/HouseBlue.png")};
-    const Texture2D HouseRed{LoadTexture("sprites/props/HouseRed.png")};
-
-    const Texture2D Interact{LoadTexture("sprites/props/Interact.png")};
-
-    const Texture2D LifebarLeftEmpty{LoadTexture("sprites/enemies/lifebar/round_left_empty.png")};
-    const Texture2D LifebarLeftFilled{LoadTexture("sprites/enemies/lifebar/round_left_filled.png")};
-    const Texture2D LifebarMiddleEmpty{LoadTexture("sprites/enemies/lifebar/round_middle_empty.png")};
-    const Texture2D LifebarMiddleFilled{LoadTexture("sprites/enemies/lifebar/round_middle_filled.png")};
-    const Texture2D LifebarRightEmpty{LoadTexture("sprites/enemies/lifebar/round_right_empty.png")};
-    const Texture2D LifebarRightFilled{LoadTexture("sprites/enemies/lifebar/round_right_filled.png")};
-
-    const Texture2D LargeRocks{LoadTexture("sprites/props/LargeRocks.png")};
-    const Texture2D LittleGrass{LoadTexture("sprites/props/LittleGrass.png")};
-    const Texture2D LittleRocks{LoadTexture("sprites/props/LittleRocks.png")};
-    const Texture2D MediumRocks{LoadTexture("sprites/props/MediumRocks.png")};
-    const Texture2D Placeholder{LoadTexture("sprites/placeholder/placeholder.png")};
-    const Texture2D RockStump{LoadTexture("sprites/props/RockStump.png")};
-
-    const Texture2D Sapling{LoadTexture("sprites/props/Sapling.png")};
-    const Texture2D Sign{LoadTexture("sprites/props/Sign.png")};
-    const Texture2D SpeechBox{LoadTexture("sprites/npc/SpeechBox.png")};
-    const Texture2D SpeechName{LoadTexture("sprites/npc/SpeechName.png")};
-    const Texture2D SquareContainer{LoadTexture("sprites/props/SquareContainer.png")};
-    const Texture2D Stones{LoadTexture("sprites/props/Stones.png")};
-
-    const Texture2D TransparentContainer{LoadTexture("sprites/props/TransparentContainer.png")};
-    const Texture2D TransparentSquare{LoadTexture("sprites/props/TransparentSquare.png")};
-
-    const Texture2D TreasureChest{LoadTexture("sprites/props/TreasureChest.png")};
-    const Texture2D TreasureChestBig{LoadTexture("sprites/props/TreasureChestBig.png")};
-    const Texture2D TreasureHeart{LoadTexture("sprites/props/TreasureHeart.png")};
-
-    const Texture2D TreeBlue{LoadTexture("sprites/props/TreeBlue.png")};
-    const Texture2D TreeClear{LoadTexture("sprites/props/TreeClear.png")};
-    const Texture2D TreeFall{LoadTexture("sprites/props/TreeFall.png")};
-    const Texture2D TreeGreen{LoadTexture("sprites/props/TreeGreen.png")};
-    const Texture2D TreePink{LoadTexture("sprites/props/TreePink.png")};
-    const Texture2D TreeStump{LoadTexture("sprites/props/TreeStump.png")};
-
-    const Texture2D UnderFlowersOne{LoadTexture("sprites/props/UnderFlowersOne.png")};
-    const Texture2D UnderFlowersTwo{LoadTexture("sprites/props/UnderFlowersTwo.png")};
-    const Texture2D UnderFlowersThree{LoadTexture("sprites/props/UnderFlowersThree.png")};
-
-    const Texture2D WallBotLeft{LoadTexture("sprites/props/WallBotLeft.png")};
-    const Texture2D WallBotRight{LoadTexture("sprites/props/WallBotRight.png")};
-    const Texture2D WallBottom{LoadTexture("sprites/props/WallBottom.png")};
-    const Texture2D WallLeft{LoadTexture("sprites/props/WallLeft.png")};
-    const Texture2D WallRight{LoadTexture("sprites/props/WallRight.png")};
-    const Texture2D WallTopLeft{LoadTexture("sprites/props/WallTopLeft.png")};
-    const Texture2D WallTopRight{LoadTexture("sprites/props/WallTopRight.png")};
-
-    const Texture2D Didi{LoadTexture("sprites/npc/Didi.png")};
-    const Texture2D Jade{LoadTexture("sprites/npc/Jade.png")};
-    const Texture2D Son{LoadTexture("sprites/npc/Son.png")};
-    const Texture2D Rumby{LoadTexture("sprites/npc/Rumby.png")};
-    const Texture2D RumbySide{LoadTexture("sprites/npc/RumbySide.png")};
-
-    const Texture2D FoxIdle{LoadTexture("sprites/characters/fox/Fox_idle.png")};
-    const Texture2D FoxWalk{LoadTexture("sprites/characters/fox/Fox_walk.png")};
-    const Texture2D FoxRun{LoadTexture("sprites/characters/fox/Fox_run.png")};
-    const Texture2D FoxMelee{LoadTexture("sprites/characters/fox/Fox_melee.png")};
-    const Texture2D FoxHit{LoadTexture("sprites/characters/fox/Fox_hit.png")};
-    const Texture2D FoxDie{LoadTexture("sprites/characters/fox/Fox_die.png")};
-    const Texture2D FoxPush{LoadTexture("sprites/characters/fox/Fox_push.png")};
-    const Texture2D FoxSleeping{LoadTexture("sprites/characters/fox/Fox_sleeping.png")};
-    const Texture2D FoxItemGot{LoadTexture("sprites/characters/fox/Fox_itemGot.png")};
-
-    const Texture2D FoxPortraitAngry{LoadTexture("sprites/portraits/Fox_Angry.png")};
-    const Texture2D FoxPortraitDead{LoadTexture("sprites/portraits/Fox_Dead.png")};
-    const Texture2D FoxPortraitFrame{LoadTexture("sprites/portraits/Fox_Frame.png")};
-    const Texture2D FoxPortraitHappy{LoadTexture("sprites/portraits/Fox_Happy.png")};
-    const Texture2D FoxPortraitHurt{LoadTexture("sprites/portraits/Fox_Hurt.png")};
-    const Texture2D FoxPortraitNervous{LoadTexture("sprites/portraits/Fox_Nervous.png")};
-    const Texture2D FoxPortraitSad{LoadTexture("sprites/portraits/Fox_Sad.png")};
-    const Texture2D FoxPortraitSleeping{LoadTexture("sprites/portraits/Fox_Sleeping.png")};
-
-    const Texture2D HeartFull{LoadTexture("sprites/props/Heart.png")};
-    const Texture2D HeartHalf{LoadTexture("sprites/props/HeartHalf.png")};
-    const Texture2D HeartEmpty{LoadTexture("sprites/props/HeartEmpty.png")};
-
-    const Texture2D ButtonW{LoadTexture("sprites/buttons/W.png")};
-    const Texture2D ButtonA{LoadTexture("sprites/buttons/A.png")};
-    const Texture2D ButtonS{LoadTexture("sprites/buttons/S.png")};
-    const Texture2D ButtonD{LoadTexture("sprites/buttons/D.png")};
-    const Texture2D ButtonL{LoadTexture("sprites/buttons/L.png")};
-    const Texture2D ButtonM{LoadTexture("sprites/buttons/M.png")};
-    const Texture2D Shift{LoadTexture("sprites/buttons/Shift.png")};
-    const Texture2D Space{LoadTexture("sprites/buttons/Space.png")};
-    const Texture2D Lmouse{LoadTexture("sprites/buttons/Lmouse.png")};
-
-    const Texture2D Map{LoadTexture("sprites/maps/CodexMap.png")};
-    const Texture2D MiniMap{LoadTexture("sprites/maps/MiniMap.png")};
-    const Texture2D DungeonMap{LoadTexture("sprites/maps/DungeonMap.png")};
-    const Texture2D PauseBackground{LoadTexture("sprites/maps/PauseBackground.png")};
+    Texture2D operator[](const TextureID ID) const {return Resident.Handle(ID);}
+    Texture2D Use(const Texture2D& Texture) const {return Resident.Use(Texture);}
+    void Preload(std::span<const TextureID> IDs) {Resident.Preload(IDs);}
+    void Prefetch(std::span<const Texture2D> Handles) {Resident.Prefetch(Handles);}
+    bool Settle() {return Resident.Settle();}
+    void NextFrame() {Resident.NextFrame();}
+
+    mutable TextureResidency Resident;      // first, so the handles below can be taken from it
+
+    const Texture2D AltarBot{Resident.Handle(TextureID::PropsAltarBot)};
+    const Texture2D AltarBotAnimated{Resident.Handle(TextureID::PropsAltarBotAnimated)};
+    const Texture2D AltarBotLeft{Resident.Handle(TextureID::PropsAltarBotLeft)};
+    const Texture2D AltarBotLeftAnimated{Resident.Handle(TextureID::PropsAltarBotLeftAnimated)};
+    const Texture2D AltarBotRight{Resident.Handle(TextureID::PropsAltarBotRight)};
+    const Texture2D AltarBotRightAnimated{Resident.Handle(TextureID::PropsAltarBotRightAnimated)};
+    const Texture2D AltarDormant{Resident.Handle(TextureID::PropsAltarDormant)};
+    const Texture2D AltarDormantRust{Resident.Handle(TextureID::PropsAltarDormantRust)};
+    const Texture2D AltarTop{Resident.Handle(TextureID::PropsAltarTop)};
+    const Texture2D AltarTopAnimated{Resident.Handle(TextureID::PropsAltarTopAnimated)};
+    const Texture2D AltarTopLeft{Resident.Handle(TextureID::PropsAltarTopLeft)};
+    const Texture2D AltarTopLeftAnimated{Resident.Handle(TextureID::PropsAltarTopLeftAnimated)};
+    const Texture2D AltarTopRight{Resident.Handle(TextureID::PropsAltarTopRight)};
+    const Texture2D AltarTopRightAnimated{Resident.Handle(TextureID::PropsAltarTopRightAnimated)};
+
+    const Texture2D AxeStump{Resident.Handle(TextureID::PropsAxeStump)};
+    const Texture2D BigGrass{Resident.Handle(TextureID::PropsBigGrass)};
+    const Texture2D Boulder{Resident.Handle(TextureID::PropsBoulder)};
+
+    const Texture2D Bracelet{Resident.Handle(TextureID::PropsBracelet)};
+
+    const Texture2D BridgeHorizontal{Resident.Handle(TextureID::PropsBridgeHorizontal)};
+    const Texture2D BridgeRopeBottom{Resident.Handle(TextureID::PropsBridgeRopeBottom)};
+    const Texture2D BridgeRopeLeft{Resident.Handle(TextureID::PropsBridgeRopeLeft)};
+    const Texture2D BridgeRopeRight{Resident.Handle(TextureID::PropsBridgeRopeRight)};
+    const Texture2D BridgeRopeTop{Resident.Handle(TextureID::PropsBridgeRopeTop)};
+    const Texture2D BridgeVertical{Resident.Handle(TextureID::PropsBridgeVertical)};
+
+    const Texture2D Bush{Resident.Handle(TextureID::PropsBush)};
+    const Texture2D ClayPot{Resident.Handle(TextureID::PropsClayPot)};
+
+    const Texture2D Cryptex{Resident.Handle(TextureID::PropsCryptex)};
+
+    const Texture2D Door{Resident.Handle(TextureID::PropsDoor)};
+    const Texture2D DoorBlue{Resident.Handle(TextureID::PropsDoorBlue)};
+    const Texture2D DoorRed{Resident.Handle(TextureID::PropsDoorRed)};
+
+    const Texture2D DungeonEntrance{Resident.Handle(TextureID::PropsDungeonEntrance)};
+
+    const Texture2D FenceDown{Resident.Handle(TextureID::PropsFenceDown)};
+    const Texture2D FenceLeft{Resident.Handle(TextureID::PropsFenceLeft)};
+    const Texture2D FenceRight{Resident.Handle(TextureID::PropsFenceRight)};
+    const Texture2D FenceUp{Resident.Handle(TextureID::PropsFenceUp)};
+
+    const Texture2D FlowerBush{Resident.Handle(TextureID::PropsFlowerBush)};
+    const Texture2D Flowers{Resident.Handle(TextureID::PropsFlowers)};
+
+    const Texture2D GrassAnimation{Resident.Handle(TextureID::PropsGrassAnimation)};
+
+    const Texture2D GrassWallBotLeft{Resident.Handle(TextureID::PropsGrassWallBotLeft)};
+    const Texture2D GrassWallBotRight{Resident.Handle(TextureID::PropsGrassWallBotRight)};
+    const Texture2D GrassWallBottom{Resident.Handle(TextureID::PropsGrassWallBottom)};
+    const Texture2D GrassWallInnerLeft{Resident.Handle(TextureID::PropsGrassWallInnerLeft)};
+    const Texture2D GrassWallInnerRight{Resident.Handle(TextureID::PropsGrassWallInnerRight)};
+    const Texture2D GrassWallLeft{Resident.Handle(TextureID::PropsGrassWallLeft)};
+    const Texture2D GrassWallRight{Resident.Handle(TextureID::PropsGrassWallRight)};
+    const Texture2D GrassWallTop{Resident.Handle(TextureID::PropsGrassWallTop)};
+    const Texture2D GrassWallTopLeft{Resident.Handle(TextureID::PropsGrassWallTopLeft)};
+    const Texture2D GrassWallTopRight{Resident.Handle(TextureID::PropsGrassWallTopRight)};
+
+    const Texture2D Hole{Resident.Handle(TextureID::PropsHole)};
+
+    const Texture2D HouseBlue{Resident.Handle(TextureID::PropsHouseBlue)};
+    const Texture2D HouseRed{Resident.Handle(TextureID::PropsHouseRed)};
+
+    const Texture2D Interact{Resident.Handle(TextureID::PropsInteract)};
+
+    const Texture2D LifebarLeftEmpty{Resident.Handle(TextureID::EnemiesLifebarRoundLeftEmpty)};
+    const Texture2D LifebarLeftFilled{Resident.Handle(TextureID::EnemiesLifebarRoundLeftFilled)};
+    const Texture2D LifebarMiddleEmpty{Resident.Handle(TextureID::EnemiesLifebarRoundMiddleEmpty)};
+    const Texture2D LifebarMiddleFilled{Resident.Handle(TextureID::EnemiesLifebarRoundMiddleFilled)};
+    const Texture2D LifebarRightEmpty{Resident.Handle(TextureID::EnemiesLifebarRoundRightEmpty)};
+    const Texture2D LifebarRightFilled{Resident.Handle(TextureID::EnemiesLifebarRoundRightFilled)};
+
+    const Texture2D LargeRocks{Resident.Handle(TextureID::PropsLargeRocks)};
+    const Texture2D LittleGrass{Resident.Handle(TextureID::PropsLittleGrass)};
+    const Texture2D LittleRocks{Resident.Handle(TextureID::PropsLittleRocks)};
+    const Texture2D MediumRocks{Resident.Handle(TextureID::PropsMediumRocks)};
+    const Texture2D Placeholder{Resident.Handle(TextureID::PlaceholderPlaceholder)};
+    const Texture2D RockStump{Resident.Handle(TextureID::PropsRockStump)};
+
+    const Texture2D Sapling{Resident.Handle(TextureID::PropsSapling)};
+    const Texture2D Sign{Resident.Handle(TextureID::PropsSign)};
+    const Texture2D SpeechBox{Resident.Handle(TextureID::NpcSpeechBox)};
+    const Texture2D SpeechName{Resident.Handle(TextureID::NpcSpeechName)};
+    const Texture2D SquareContainer{Resident.Handle(TextureID::PropsSquareContainer)};
+    const Texture2D Stones{Resident.Handle(TextureID::PropsStones)};
+
+    const Texture2D TransparentContainer{Resident.Handle(TextureID::PropsTransparentContainer)};
+    const Texture2D TransparentSquare{Resident.Handle(TextureID::PropsTransparentSquare)};
+
+    const Texture2D TreasureChest{Resident.Handle(TextureID::PropsTreasureChest)};
+    const Texture2D TreasureChestBig{Resident.Handle(TextureID::PropsTreasureChestBig)};
+    const Texture2D TreasureHeart{Resident.Handle(TextureID::PropsTreasureHeart)};
+
+    const Texture2D TreeBlue{Resident.Handle(TextureID::PropsTreeBlue)};
+    const Texture2D TreeClear{Resident.Handle(TextureID::PropsTreeClear)};
+    const Texture2D TreeFall{Resident.Handle(TextureID::PropsTreeFall)};
+    const Texture2D TreeGreen{Resident.Handle(TextureID::PropsTreeGreen)};
+    const Texture2D TreePink{Resident.Handle(TextureID::PropsTreePink)};
+    const Texture2D TreeStump{Resident.Handle(TextureID::PropsTreeStump)};
+
+    const Texture2D UnderFlowersOne{Resident.Handle(TextureID::PropsUnderFlowersOne)};
+    const Texture2D UnderFlowersTwo{Resident.Handle(TextureID::PropsUnderFlowersTwo)};
+    const Texture2D UnderFlowersThree{Resident.Handle(TextureID::PropsUnderFlowersThree)};
+
+    const Texture2D WallBotLeft{Resident.Handle(TextureID::PropsWallBotLeft)};
+    const Texture2D WallBotRight{Resident.Handle(TextureID::PropsWallBotRight)};
+    const Texture2D WallBottom{Resident.Handle(TextureID::PropsWallBottom)};
+    const Texture2D WallLeft{Resident.Handle(TextureID::PropsWallLeft)};
+    const Texture2D WallRight{Resident.Handle(TextureID::PropsWallRight)};
+    const Texture2D WallTopLeft{Resident.Handle(TextureID::PropsWallTopLeft)};
+    const Texture2D WallTopRight{Resident.Handle(TextureID::PropsWallTopRight)};
+
+    const Texture2D Didi{Resident.Handle(TextureID::NpcDidi)};
+    const Texture2D Jade{Resident.Handle(TextureID::NpcJade)};
+    const Texture2D Son{Resident.Handle(TextureID::NpcSon)};
+    const Texture2D Rumby{Resident.Handle(TextureID::NpcRumby)};
+    const Texture2D RumbySide{Resident.Handle(TextureID::NpcRumbySide)};
+
+    const Texture2D FoxIdle{Resident.Handle(TextureID::CharactersFoxFoxIdle)};
+    const Texture2D FoxWalk{Resident.Handle(TextureID::CharactersFoxFoxWalk)};
+    const Texture2D FoxRun{Resident.Handle(TextureID::CharactersFoxFoxRun)};
+    const Texture2D FoxMelee{Resident.Handle(TextureID::CharactersFoxFoxMelee)};
+    const Texture2D FoxHit{Resident.Handle(TextureID::CharactersFoxFoxHit)};
+    const Texture2D FoxDie{Resident.Handle(TextureID::CharactersFoxFoxDie)};
+    const Texture2D FoxPush{Resident.Handle(TextureID::CharactersFoxFoxPush)};
+    const Texture2D FoxSleeping{Resident.Handle(TextureID::CharactersFoxFoxSleeping)};
+    const Texture2D FoxItemGot{Resident.Handle(TextureID::CharactersFoxFoxItemGot)};
+
+    const Texture2D FoxPortraitAngry{Resident.Handle(TextureID::PortraitsFoxAngry)};
+    const Texture2D FoxPortraitDead{Resident.Handle(TextureID::PortraitsFoxDead)};
+    const Texture2D FoxPortraitFrame{Resident.Handle(TextureID::PortraitsFoxFrame)};
+    const Texture2D FoxPortraitHappy{Resident.Handle(TextureID::PortraitsFoxHappy)};
+    const Texture2D FoxPortraitHurt{Resident.Handle(TextureID::PortraitsFoxHurt)};
+    const Texture2D FoxPortraitNervous{Resident.Handle(TextureID::PortraitsFoxNervous)};
+    const Texture2D FoxPortraitSad{Resident.Handle(TextureID::PortraitsFoxSad)};
+    const Texture2D FoxPortraitSleeping{Resident.Handle(TextureID::PortraitsFoxSleeping)};
+
+    const Texture2D HeartFull{Resident.Handle(TextureID::PropsHeart)};
+    const Texture2D HeartHalf{Resident.Handle(TextureID::PropsHeartHalf)};
+    const Texture2D HeartEmpty{Resident.Handle(TextureID::PropsHeartEmpty)};
+
+    const Texture2D ButtonW{Resident.Handle(TextureID::ButtonsW)};
+    const Texture2D ButtonA{Resident.Handle(TextureID::ButtonsA)};
+    const Texture2D ButtonS{Resident.Handle(TextureID::ButtonsS)};
+    const Texture2D ButtonD{Resident.Handle(TextureID::ButtonsD)};
+    const Texture2D ButtonL{Resident.Handle(TextureID::ButtonsL)};
+    const Texture2D ButtonM{Resident.Handle(TextureID::ButtonsM)};
+    const Texture2D Shift{Resident.Handle(TextureID::ButtonsShift)};
+    const Texture2D Space{Resident.Handle(TextureID::ButtonsSpace)};
+    const Texture2D Lmouse{Resident.Handle(TextureID::ButtonsLmouse)};
+
+    const Texture2D Map{Resident.Handle(TextureID::MapsCodexMap)};
+    const Texture2D MiniMap{Resident.Handle(TextureID::MapsMiniMap)};
+    const Texture2D DungeonMap{Resident.Handle(TextureID::MapsDungeonMap)};
+    const Texture2D PauseBackground{Resident.Handle(TextureID::MapsPauseBackground)};
     
-    const Texture2D BearBrownAttack{LoadTexture("sprites/enemies/bear/brown_attack.png")};
-    const Texture2D BearBrownDeath{LoadTexture("sprites/enemies/bear/brown_death.png")};
-    const Texture2D BearBrownHurt{LoadTexture("sprites/enemies/bear/brown_hurt.png")};
-    const Texture2D BearBrownIdle{LoadTexture("sprites/enemies/bear/brown_idle.png")};
-    const Texture2D BearBrownWalk{LoadTexture("sprites/enemies/bear/brown_walk.png")};
-    const Texture2D BearGreyAttack{LoadTexture("sprites/enemies/bear/grey_attack.png")};
-    const Texture2D BearGreyDeath{LoadTexture("sprites/enemies/bear/grey_death.png")};
-    const Texture2D BearGreyHurt{LoadTexture("sprites/enemies/bear/grey_hurt.png")};
-    const Texture2D BearGreyIdle{LoadTexture("sprites/enemies/bear/grey_idle.png")};
-    const Texture2D BearGreyWalk{LoadTexture("sprites/enemies/bear/grey_walk.png")};
-    const Texture2D BearLightBrownAttack{LoadTexture("sprites/enemies/bear/lightbrown_attack.png")};
-    const Texture2D BearLightBrownDeath{LoadTexture("sprites/enemies/bear/lightbrown_death.png")};
-    const Texture2D BearLightBrownHurt{LoadTexture("sprites/enemies/bear/lightbrown_hurt.png")};
-    const Texture2D BearLightBrownIdle{LoadTexture("sprites/enemies/bear/lightbrown_idle.png")};
-    const Texture2D BearLightBrownWalk{LoadTexture("sprites/enemies/bear/lightbrown_walk.png")};
-    const Texture2D BearWhiteAttack{LoadTexture("sprites/enemies/bear/white_attack.png")};
-    const Texture2D BearWhiteDeath{LoadTexture("sprites/enemies/bear/white_death.png")};
-    const Texture2D BearWhiteHurt{LoadTexture("sprites/enemies/bear/white_hurt.png")};
-    const Texture2D BearWhiteIdle{LoadTexture("sprites/enemies/bear/white_idle.png")};
-    const Texture2D BearWhiteWalk{LoadTexture("sprites/enemies/bear/white_walk.png")};
-
-    const Texture2D BeholderAquaAttack{LoadTexture("sprites/enemies/beholder/aqua_attack.png")};
-    const Texture2D BeholderAquaDeath{LoadTexture("sprites/enemies/beholder/aqua_death.png")};
-    const Texture2D BeholderAquaHurt{LoadTexture("sprites/enemies/beholder/aqua_hurt.png")};
-    const Texture2D BeholderAquaIdle{LoadTexture("sprites/enemies/beholder/aqua_idle.png")};
-    const Texture2D BeholderAquaProjectile{LoadTexture("sprites/enemies/beholder/aqua_projectile.png")};
-    const Texture2D BeholderAquaWalk{LoadTexture("sprites/enemies/beholder/aqua_walk.png")};
-    const Texture2D BeholderBlackAttack{LoadTexture("sprites/enemies/beholder/black_attack.png")};
-    const Texture2D BeholderBlackDeath{LoadTexture("sprites/enemies/beholder/black_death.png")};
-    const Texture2D BeholderBlackHurt{LoadTexture("sprites/enemies/beholder/black_hurt.png")};
-    const Texture2D BeholderBlackIdle{LoadTexture("sprites/enemies/beholder/black_idle.png")};
-    const Texture2D BeholderBlackProjectile{LoadTexture("sprites/enemies/beholder/black_projectile.png")};
-    const Texture2D BeholderBlackWalk{LoadTexture("sprites/enemies/beholder/black_walk.png")};
-    const Texture2D BeholderBlueAttack{LoadTexture("sprites/enemies/beholder/blue_attack.png")};
-    const Texture2D BeholderBlueDeath{LoadTexture("sprites/enemies/beholder/blue_death.png")};
-    const Texture2D BeholderBlueHurt{LoadTexture("sprites/enemies/beholder/blue_hurt.png")};
-    const Texture2D BeholderBlueIdle{LoadTexture("sprites/enemies/beholder/blue_idle.png")};
-    const Texture2D BeholderBlueProjectile{LoadTexture("sprites/enemies/beholder/blue_projectile.png")};
-    const Texture2D BeholderBlueWalk{LoadTexture("sprites/enemies/beholder/blue_walk.png")};
-    const Texture2D BeholderGreenAttack{LoadTexture("sprites/enemies/beholder/green_attack.png")};
-    const Texture2D BeholderGreenDeath{LoadTexture("sprites/enemies/beholder/green_death.png")};
-    const Texture2D BeholderGreenHurt{LoadTexture("sprites/enemies/beholder/green_hurt.png")};
-    const Texture2D BeholderGreenIdle{LoadTexture("sprites/enemies/beholder/green_idle.png")};
-    const Texture2D BeholderGreenProjectile{LoadTexture("sprites/enemies/beholder/green_projectile.png")};
-    const Texture2D BeholderGreenWalk{LoadTexture("sprites/enemies/beholder/green_walk.png")};
-    const Texture2D BeholderRedAttack{LoadTexture("sprites/enemies/beholder/red_attack.png")};
-    const Texture2D BeholderRedDeath{LoadTexture("sprites/enemies/beholder/red_death.png")};
-    const Texture2D BeholderRedHurt{LoadTexture("sprites/enemies/beholder/red_hurt.png")};
-    const Texture2D BeholderRedIdle{LoadTexture("sprites/enemies/beholder/red_idle.png")};
-    const Texture2D BeholderRedProjectile{LoadTexture("sprites/enemies/beholder/red_projectile.png")};
-    const Texture2D BeholderRedWalk{LoadTexture("sprites/enemies/beholder/red_walk.png")};
-
-    const Texture2D CreatureAquaAttack{LoadTexture("sprites/enemies/creature/aqua_attack.png")};
-    const Texture2D CreatureAquaDeath{LoadTexture("sprites/enemies/creature/aqua_death.png")};
-    const Texture2D CreatureAquaHurt{LoadTexture("sprites/enemies/creature/aqua_hurt.png")};
-    const Texture2D CreatureAquaIdle{LoadTexture("sprites/enemies/creature/aqua_idle.png")};
-    const Texture2D CreatureAquaWalk{LoadTexture("sprites/enemies/creature/aqua_walk.png")};
-    const Texture2D CreatureGreyAttack{LoadTexture("sprites/enemies/creature/grey_attack.png")};
-    const Texture2D CreatureGreyDeath{LoadTexture("sprites/enemies/creature/grey_death.png")};
-    const Texture2D CreatureGreyHurt{LoadTexture("sprites/enemies/creature/grey_hurt.png")};
-    const Texture2D CreatureGreyIdle{LoadTexture("sprites/enemies/creature/grey_idle.png")};
-    const Texture2D CreatureGreyWalk{LoadTexture("sprites/enemies/creature/grey_walk.png")};
-    const Texture2D CreatureOrangeAttack{LoadTexture("sprites/enemies/creature/orange_attack.png")};
-    const Texture2D CreatureOrangeDeath{LoadTexture("sprites/enemies/creature/orange_death.png")};
-    const Texture2D CreatureOrangeHurt{LoadTexture("sprites/enemies/creature/orange_hurt.png")};
-    const Texture2D CreatureOrangeIdle{LoadTexture("sprites/enemies/creature/orange_idle.png")};
-    const Texture2D CreatureOrangeWalk{LoadTexture("sprites/enemies/creature/orange_walk.png")};
-    const Texture2D CreaturePurpleAttack{LoadTexture("sprites/enemies/creature/purple_attack.png")};
-    const Texture2D CreaturePurpleDeath{LoadTexture("sprites/enemies/creature/purple_death.png")};
-    const Texture2D CreaturePurpleHurt{LoadTexture("sprites/enemies/creature/purple_hurt.png")};
-    const Texture2D CreaturePurpleIdle{LoadTexture("sprites/enemies/creature/purple_idle.png")};
-    const Texture2D CreaturePurpleWalk{LoadTexture("sprites/enemies/creature/purple_walk.png")};
-    const Texture2D CreatureRedAttack{LoadTexture("sprites/enemies/creature/red_attack.png")};
-    const Texture2D CreatureRedDeath{LoadTexture("sprites/enemies/creature/red_death.png")};
-    const Texture2D CreatureRedHurt{LoadTexture("sprites/enemies/creature/red_hurt.png")};
-    const Texture2D CreatureRedIdle{LoadTexture("sprites/enemies/creature/red_idle.png")};
-    const Texture2D CreatureRedWalk{LoadTexture("sprites/enemies/creature/red_walk.png")};
-
-    const Texture2D GhostBlackAttack{LoadTexture("sprites/enemies/ghost/black_attack.png")};
-    const Texture2D GhostBlackDeath{LoadTexture("sprites/enemies/ghost/black_death.png")};
-    const Texture2D GhostBlackHurt{LoadTexture("sprites/enemies/ghost/black_hurt.png")};
-    const Texture2D GhostBlackIdle{LoadTexture("sprites/enemies/ghost/black_idle.png")};
-    const Texture2D GhostBlackWalk{LoadTexture("sprites/enemies/ghost/black_walk.png")};
-    const Texture2D GhostBlueAttack{LoadTexture("sprites/enemies/ghost/blue_attack.png")};
-    const Texture2D GhostBlueDeath{LoadTexture("sprites/enemies/ghost/blue_death.png")};
-    const Texture2D GhostBlueHurt{LoadTexture("sprites/enemies/ghost/blue_hurt.png")};
-    const Texture2D GhostBlueIdle{LoadTexture("sprites/enemies/ghost/blue_idle.png")};
-    const Texture2D GhostBlueWalk{LoadTexture("sprites/enemies/ghost/blue_walk.png")};
-    const Texture2D GhostGreenAttack{LoadTexture("sprites/enemies/ghost/green_attack.png")};
-    const Texture2D GhostGreenDeath{LoadTexture("sprites/enemies/ghost/green_death.png")};
-    const Texture2D GhostGreenHurt{LoadTexture("sprites/enemies/ghost/green_hurt.png")};
-    const Texture2D GhostGreenIdle{LoadTexture("sprites/enemies/ghost/green_idle.png")};
-    const Texture2D GhostGreenWalk{LoadTexture("sprites/enemies/ghost/green_walk.png")};
-    const Texture2D GhostRedAttack{LoadTexture("sprites/enemies/ghost/red_attack.png")};
-    const Texture2D GhostRedDeath{LoadTexture("sprites/enemies/ghost/red_death.png")};
-    const Texture2D GhostRedHurt{LoadTexture("sprites/enemies/ghost/red_hurt.png")};
-    const Texture2D GhostRedIdle{LoadTexture("sprites/enemies/ghost/red_idle.png")};
-    const Texture2D GhostRedWalk{LoadTexture("sprites/enemies/ghost/red_walk.png")};
-    const Texture2D GhostWhiteAttack{LoadTexture("sprites/enemies/ghost/white_attack.png")};
-    const Texture2D GhostWhiteDeath{LoadTexture("sprites/enemies/ghost/white_death.png")};
-    const Texture2D GhostWhiteHurt{LoadTexture("sprites/enemies/ghost/white_hurt.png")};
-    const Texture2D GhostWhiteIdle{LoadTexture("sprites/enemies/ghost/white_idle.png")};
-    const Texture2D GhostWhiteWalk{LoadTexture("sprites/enemies/ghost/white_walk.png")};
-    const Texture2D GhostYellowAttack{LoadTexture("sprites/enemies/ghost/yellow_attack.png")};
-    const Texture2D GhostYellowDeath{LoadTexture("sprites/enemies/ghost/yellow_death.png")};
-    const Texture2D GhostYellowHurt{LoadTexture("sprites/enemies/ghost/yellow_hurt.png")};
-    const Texture2D GhostYellowIdle{LoadTexture("sprites/enemies/ghost/yellow_idle.png")};
-    const Texture2D GhostYellowWalk{LoadTexture("sprites/enemies/ghost/yellow_walk.png")};
-
-    const Texture2D ImpBlueAttack{LoadTexture("sprites/enemies/imp/blue_attack.png")};
-    const Texture2D ImpBlueDeath{LoadTexture("sprites/enemies/imp/blue_death.png")};
-    const Texture2D ImpBlueHurt{LoadTexture("sprites/enemies/imp/blue_hurt.png")};
-    const Texture2D ImpBlueIdle{LoadTexture("sprites/enemies/imp/blue_idle.png")};
-    const Texture2D ImpBlueProjectile{LoadTexture("sprites/enemies/imp/blue_projectile.png")};
-    const Texture2D ImpBlueWalk{LoadTexture("sprites/enemies/imp/blue_walk.png")};
-    const Texture2D ImpGreenAttack{LoadTexture("sprites/enemies/imp/green_attack.png")};
-    const Texture2D ImpGreenDeath{LoadTexture("sprites/enemies/imp/green_death.png")};
-    const Texture2D ImpGreenHurt{LoadTexture("sprites/enemies/imp/green_hurt.png")};
-    const Texture2D ImpGreenIdle{LoadTexture("sprites/enemies/imp/green_idle.png")};
-    const Texture2D ImpGreenProjectile{LoadTexture("sprites/enemies/imp/green_projectile.png")};
-    const Texture2D ImpGreenWalk{LoadTexture("sprites/enemies/imp/green_walk.png")};
-    const Texture2D ImpGreyAttack{LoadTexture("sprites/enemies/imp/grey_attack.png")};
-    const Texture2D ImpGreyDeath{LoadTexture("sprites/enemies/imp/grey_death.png")};
-    const Texture2D ImpGreyHurt{LoadTexture("sprites/enemies/imp/grey_hurt.png")};
-    const Texture2D ImpGreyIdle{LoadTexture("sprites/enemies/imp/grey_idle.png")};
-    const Texture2D ImpGreyProjectile{LoadTexture("sprites/enemies/imp/grey_projectile.png")};
-    const Texture2D ImpGreyWalk{LoadTexture("sprites/enemies/imp/grey_walk.png")};
-    const Texture2D ImpRedAttack{LoadTexture("sprites/enemies/imp/red_attack.png")};
-    const Texture2D ImpRedDeath{LoadTexture("sprites/enemies/imp/red_death.png")};
-    const Texture2D ImpRedHurt{LoadTexture("sprites/enemies/imp/red_hurt.png")};
-    const Texture2D ImpRedIdle{LoadTexture("sprites/enemies/imp/red_idle.png")};
-    const Texture2D ImpRedProjectile{LoadTexture("sprites/enemies/imp/red_projectile.png")};
-    const Texture2D ImpRedWalk{LoadTexture("sprites/enemies/imp/red_walk.png")};
-    const Texture2D ImpYellowAttack{LoadTexture("sprites/enemies/imp/yellow_attack.png")};
-    const Texture2D ImpYellowDeath{LoadTexture("sprites/enemies/imp/yellow_death.png")};
-    const Texture2D ImpYellowHurt{LoadTexture("sprites/enemies/imp/yellow_hurt.png")};
-    const Texture2D ImpYellowIdle{LoadTexture("sprites/enemies/imp/yellow_idle.png")};
-    const Texture2D ImpYellowProjectile{LoadTexture("sprites/enemies/imp/yellow_projectile.png")};
-    const Texture2D ImpYellowWalk{LoadTexture("sprites/enemies/imp/yellow_walk.png")};
-
-    const Texture2D MushroomBlueAttack{LoadTexture("sprites/enemies/mushroom/blue_attack.png")};
-    const Texture2D MushroomBlueDeath{LoadTexture("sprites/enemies/mushroom/blue_death.png")};
-    const Texture2D MushroomBlueHurt{LoadTexture("sprites/enemies/mushroom/blue_hurt.png")};
-    const Texture2D MushroomBlueIdle{LoadTexture("sprites/enemies/mushroom/blue_idle.png")};
-    const Texture2D MushroomBlueWalk{LoadTexture("sprites/enemies/mushroom/blue_walk.png")};
-    const Texture2D MushroomBrownAttack{LoadTexture("sprites/enemies/mushroom/brown_attack.png")};
-    const Texture2D MushroomBrownDeath{LoadTexture("sprites/enemies/mushroom/brown_death.png")};
-    const Texture2D MushroomBrownHurt{LoadTexture("sprites/enemies/mushroom/brown_hurt.png")};
-    const Texture2D MushroomBrownIdle{LoadTexture("sprites/enemies/mushroom/brown_idle.png")};
-    const Texture2D MushroomBrownWalk{LoadTexture("sprites/enemies/mushroom/brown_walk.png")};
-    const Texture2D MushroomGreenAttack{LoadTexture("sprites/enemies/mushroom/green_attack.png")};
-    const Texture2D MushroomGreenDeath{LoadTexture("sprites/enemies/mushroom/green_death.png")};
-    const Texture2D MushroomGreenHurt{LoadTexture("sprites/enemies/mushroom/green_hurt.png")};
-    const Texture2D MushroomGreenIdle{LoadTexture("sprites/enemies/mushroom/green_idle.png")};
-    const Texture2D MushroomGreenWalk{LoadTexture("sprites/enemies/mushroom/green_walk.png")};
-    const Texture2D MushroomPinkAttack{LoadTexture("sprites/enemies/mushroom/pink_attack.png")};
-    const Texture2D MushroomPinkDeath{LoadTexture("sprites/enemies/mushroom/pink_death.png")};
-    const Texture2D MushroomPinkHurt{LoadTexture("sprites/enemies/mushroom/pink_hurt.png")};
-    const Texture2D MushroomPinkIdle{LoadTexture("sprites/enemies/mushroom/pink_idle.png")};
-    const Texture2D MushroomPinkWalk{LoadTexture("sprites/enemies/mushroom/pink_walk.png")};
-    const Texture2D MushroomRedAttack{LoadTexture("sprites/enemies/mushroom/red_attack.png")};
-    const Texture2D MushroomRedDeath{LoadTexture("sprites/enemies/mushroom/red_death.png")};
-    const Texture2D MushroomRedHurt{LoadTexture("sprites/enemies/mushroom/red_hurt.png")};
-    const Texture2D MushroomRedIdle{LoadTexture("sprites/enemies/mushroom/red_idle.png")};
-    const Texture2D MushroomRedWalk{LoadTexture("sprites/enemies/mushroom/red_walk.png")};
-    const Texture2D MushroomTealAttack{LoadTexture("sprites/enemies/mushroom/teal_attack.png")};
-    const Texture2D MushroomTealDeath{LoadTexture("sprites/enemies/mushroom/teal_death.png")};
-    const Texture2D MushroomTealHurt{LoadTexture("sprites/enemies/mushroom/teal_hurt.png")};
-    const Texture2D MushroomTealIdle{LoadTexture("sprites/enemies/mushroom/teal_idle.png")};
-    const Texture2D MushroomTealWalk{LoadTexture("sprites/enemies/mushroom/teal_walk.png")};
-
-    const Texture2D NecromancerBlueAttack{LoadTexture("sprites/enemies/necromancer/blue_attack.png")};
-    const Texture2D NecromancerBlueDeath{LoadTexture("sprites/enemies/necromancer/blue_death.png")};
-    const Texture2D NecromancerBlueHurt{LoadTexture("sprites/enemies/necromancer/blue_hurt.png")};
-    const Texture2D NecromancerBlueIdle{LoadTexture("sprites/enemies/necromancer/blue_idle.png")};
-    const Texture2D NecromancerBlueProjectile{LoadTexture("sprites/enemies/necromancer/blue_projectile.png")};
-    const Texture2D NecromancerBlueWalk{LoadTexture("sprites/enemies/necromancer/blue_walk.png")};
-    const Texture2D NecromancerBrownAttack{LoadTexture("sprites/enemies/necromancer/brown_attack.png")};
-    const Texture2D NecromancerBrownDeath{LoadTexture("sprites/enemies/necromancer/brown_death.png")};
-    const Texture2D NecromancerBrownHurt{LoadTexture("sprites/enemies/necromancer/brown_hurt.png")};
-    const Texture2D NecromancerBrownIdle{LoadTexture("sprites/enemies/necromancer/brown_idle.png")};
-    const Texture2D NecromancerBrownProjectile{LoadTexture("sprites/enemies/necromancer/brown_projectile.png")};
-    const Texture2D NecromancerBrownWalk{LoadTexture("sprites/enemies/necromancer/brown_walk.png")};
-    const Texture2D NecromancerPurpleAttack{LoadTexture("sprites/enemies/necromancer/purple_attack.png")};
-    const Texture2D NecromancerPurpleDeath{LoadTexture("sprites/enemies/necromancer/purple_death.png")};
-    const Texture2D NecromancerPurpleHurt{LoadTexture("sprites/enemies/necromancer/purple_hurt.png")};
-    const Texture2D NecromancerPurpleIdle{LoadTexture("sprites/enemies/necromancer/purple_idle.png")};
-    const Texture2D NecromancerPurpleProjectile{LoadTexture("sprites/enemies/necromancer/purple_projectile.png")};
-    const Texture2D NecromancerPurpleWalk{LoadTexture("sprites/enemies/necromancer/purple_walk.png")};
-    const Texture2D NecromancerRedAttack{LoadTexture("sprites/enemies/necromancer/red_attack.png")};
-    const Texture2D NecromancerRedDeath{LoadTexture("sprites/enemies/necromancer/red_death.png")};
-    const Texture2D NecromancerRedHurt{LoadTexture("sprites/enemies/necromancer/red_hurt.png")};
-    const Texture2D NecromancerRedIdle{LoadTexture("sprites/enemies/necromancer/red_idle.png")};
-    const Texture2D NecromancerRedProjectile{LoadTexture("sprites/enemies/necromancer/red_projectile.png")};
-    const Texture2D NecromancerRedWalk{LoadTexture("sprites/enemies/necromancer/red_walk.png")};
-
-    const Texture2D ShadowBlueAttack{LoadTexture("sprites/enemies/shadow/blue_attack.png")};
-    const Texture2D ShadowBlueDeath{LoadTexture("sprites/enemies/shadow/blue_death.png")};
-    const Texture2D ShadowBlueHurt{LoadTexture("sprites/enemies/shadow/blue_hurt.png")};
-    const Texture2D ShadowBlueIdle{LoadTexture("sprites/enemies/shadow/blue_idle.png")};
-    const Texture2D ShadowBlueWalk{LoadTexture("sprites/enemies/shadow/blue_walk.png")};
-    const Texture2D ShadowRedAttack{LoadTexture("sprites/enemies/shadow/red_attack.png")};
-    const Texture2D ShadowRedDeath{LoadTexture("sprites/enemies/shadow/red_death.png")};
-    const Texture2D ShadowRedHurt{LoadTexture("sprites/enemies/shadow/red_hurt.png")};
-    const Texture2D ShadowRedIdle{LoadTexture("sprites/enemies/shadow/red_idle.png")};
-    const Texture2D ShadowRedWalk{LoadTexture("sprites/enemies/shadow/red_walk.png")};
-    const Texture2D ShadowTealAttack{LoadTexture("sprites/enemies/shadow/teal_attack.png")};
-    const Texture2D ShadowTealDeath{LoadTexture("sprites/enemies/shadow/teal_death.png")};
-    const Texture2D ShadowTealHurt{LoadTexture("sprites/enemies/shadow/teal_hurt.png")};
-    const Texture2D ShadowTealIdle{LoadTexture("sprites/enemies/shadow/teal_idle.png")};
-    const Texture2D ShadowTealWalk{LoadTexture("sprites/enemies/shadow/teal_walk.png")};
-    const Texture2D ShadowYellowAttack{LoadTexture("sprites/enemies/shadow/yellow_attack.png")};
-    const Texture2D ShadowYellowDeath{LoadTexture("sprites/enemies/shadow/yellow_death.png")};
-    const Texture2D ShadowYellowHurt{LoadTexture("sprites/enemies/shadow/yellow_hurt.png")};
-    const Texture2D ShadowYellowIdle{LoadTexture("sprites/enemies/shadow/yellow_idle.png")};
-    const Texture2D ShadowYellowWalk{LoadTexture("sprites/enemies/shadow/yellow_walk.png")};
-
-    const Texture2D SpiderBlackAttack{LoadTexture("sprites/enemies/spider/black_attack.png")};
-    const Texture2D SpiderBlackDeath{LoadTexture("sprites/enemies/spider/black_death.png")};
-    const Texture2D SpiderBlackHurt{LoadTexture("sprites/enemies/spider/black_hurt.png")};
-    const Texture2D SpiderBlackIdle{LoadTexture("sprites/enemies/spider/black_idle.png")};
-    const Texture2D SpiderBlackWalk{LoadTexture("sprites/enemies/spider/black_walk.png")};
-    const Texture2D SpiderBlueAttack{LoadTexture("sprites/enemies/spider/blue_attack.png")};
-    const Texture2D SpiderBlueDeath{LoadTexture("sprites/enemies/spider/blue_death.png")};
-    const Texture2D SpiderBlueHurt{LoadTexture("sprites/enemies/spider/blue_hurt.png")};
-    const Texture2D SpiderBlueIdle{LoadTexture("sprites/enemies/spider/blue_idle.png")};
-    const Texture2D SpiderBlueWalk{LoadTexture("sprites/enemies/spider/blue_walk.png")};
-    const Texture2D SpiderBrownAttack{LoadTexture("sprites/enemies/spider/brown_attack.png")};
-    const Texture2D SpiderBrownDeath{LoadTexture("sprites/enemies/spider/brown_death.png")};
-    const Texture2D SpiderBrownHurt{LoadTexture("sprites/enemies/spider/brown_hurt.png")};
-    const Texture2D SpiderBrownIdle{LoadTexture("sprites/enemies/spider/brown_idle.png")};
-    const Texture2D SpiderBrownWalk{LoadTexture("sprites/enemies/spider/brown_walk.png")};
-    const Texture2D SpiderGreenAttack{LoadTexture("sprites/enemies/spider/green_attack.png")};
-    const Texture2D SpiderGreenDeath{LoadTexture("sprites/enemies/spider/green_death.png")};
-    const Texture2D SpiderGreenHurt{LoadTexture("sprites/enemies/spider/green_hurt.png")};
-    const Texture2D SpiderGreenIdle{LoadTexture("sprites/enemies/spider/green_idle.png")};
-    const Texture2D SpiderGreenWalk{LoadTexture("sprites/enemies/spider/green_walk.png")};
-    const Texture2D SpiderRedAttack{LoadTexture("sprites/enemies/spider/red_attack.png")};
-    const Texture2D SpiderRedDeath{LoadTexture("sprites/enemies/spider/red_death.png")};
-    const Texture2D SpiderRedHurt{LoadTexture("sprites/enemies/spider/red_hurt.png")};
-    const Texture2D SpiderRedIdle{LoadTexture("sprites/enemies/spider/red_idle.png")};
-    const Texture2D SpiderRedWalk{LoadTexture("sprites/enemies/spider/red_walk.png")};
-
-    const Texture2D ToadBlueAttack{LoadTexture("sprites/enemies/toad/blue_attack.png")};
-    const Texture2D ToadBlueDeath{LoadTexture("sprites/enemies/toad/blue_death.png")};
-    const Texture2D ToadBlueHurt{LoadTexture("sprites/enemies/toad/blue_hurt.png")};
-    const Texture2D ToadBlueIdle{LoadTexture("sprites/enemies/toad/blue_idle.png")};
-    const Texture2D ToadBlueWalk{LoadTexture("sprites/enemies/toad/blue_walk.png")};
-    const Texture2D ToadGreenAttack{LoadTexture("sprites/enemies/toad/green_attack.png")};
-    const Texture2D ToadGreenDeath{LoadTexture("sprites/enemies/toad/green_death.png")};
-    const Texture2D ToadGreenHurt{LoadTexture("sprites/enemies/toad/green_hurt.png")};
-    const Texture2D ToadGreenIdle{LoadTexture("sprites/enemies/toad/green_idle.png")};
-    const Texture2D ToadGreenWalk{LoadTexture("sprites/enemies/toad/green_walk.png")};
-    const Texture2D ToadPinkAttack{LoadTexture("sprites/enemies/toad/pink_attack.png")};
-    const Texture2D ToadPinkDeath{LoadTexture("sprites/enemies/toad/pink_death.png")};
-    const Texture2D ToadPinkHurt{LoadTexture("sprites/enemies/toad/pink_hurt.png")};
-    const Texture2D ToadPinkIdle{LoadTexture("sprites/enemies/toad/pink_idle.png")};
-    const Texture2D ToadPinkWalk{LoadTexture("sprites/enemies/toad/pink_walk.png")};
-    const Texture2D ToadRedAttack{LoadTexture("sprites/enemies/toad/red_attack.png")};
-    const Texture2D ToadRedDeath{LoadTexture("sprites/enemies/toad/red_death.png")};
-    const Texture2D ToadRedHurt{LoadTexture("sprites/enemies/toad/red_hurt.png")};
-    const Texture2D ToadRedIdle{LoadTexture("sprites/enemies/toad/red_idle.png")};
-    const Texture2D ToadRedWalk{LoadTexture("sprites/enemies/toad/red_walk.png")};
-    const Texture2D ToadWhiteAttack{LoadTexture("sprites/enemies/toad/white_attack.png")};
-    const Texture2D ToadWhiteDeath{LoadTexture("sprites/enemies/toad/white_death.png")};
-    const Texture2D ToadWhiteHurt{LoadTexture("sprites/enemies/toad/white_hurt.png")};
-    const Texture2D ToadWhiteIdle{LoadTexture("sprites/enemies/toad/white_idle.png")};
-    const Texture2D ToadWhiteWalk{LoadTexture("sprites/enemies/toad/white_walk.png")};
-
-    const Texture2D CrowFlySleep{LoadTexture("sprites/npc/wildlife/crow/crow_fly_sleep.png")};
-    const Texture2D CrowFlying{LoadTexture("sprites/npc/wildlife/crow/crow_flying.png")};
-    const Texture2D CrowGroundSleep{LoadTexture("sprites/npc/wildlife/crow/crow_ground_sleep.png")};
-    const Texture2D CrowIdle{LoadTexture("sprites/npc/wildlife/crow/crow_idle.png")};
-    const Texture2D CrowIdleTwo{LoadTexture("sprites/npc/wildlife/crow/crow_idle2.png")};
-    const Texture2D CrowWalk{LoadTexture("sprites/npc/wildlife/crow/crow_walk.png")};
-
-    const Texture2D FoxFamilyAngry{LoadTexture("sprites/npc/wildlife/fox/fox_family_angry.png")};
-    const Texture2D FoxFamilyIdle{LoadTexture("sprites/npc/wildlife/fox/fox_family_idle.png")};
-    const Texture2D FoxFamilyIdleTwo{LoadTexture("sprites/npc/wildlife/fox/fox_family_idle2.png")};
-    const Texture2D FoxFamilyLazy{LoadTexture("sprites/npc/wildlife/fox/fox_family_lazy.png")};
-    const Texture2D FoxFamilyRun{LoadTexture("sprites/npc/wildlife/fox/fox_family_run.png")};
-    const Texture2D FoxFamilySleep{LoadTexture("sprites/npc/wildlife/fox/fox_family_sleep.png")};
-    const Texture2D FoxFamilyWalk{LoadTexture("sprites/npc/wildlife/fox/fox_family_walk.png")};
-
-    const Texture2D SquirrelEat{LoadTexture("sprites/npc/wildlife/squirrel/squirrel_eat.png")};
-    const Texture2D SquirrelIdle{LoadTexture("sprites/npc/wildlife/squirrel/squirrel_idle.png")};
-    const Texture2D SquirrelIdleTwo{LoadTexture("sprites/npc/wildlife/squirrel/squirrel_idle2.png")};
-    const Texture2D SquirrelJump{LoadTexture("sprites/npc/wildlife/squirrel/squirrel_jump.png")};
-    const Texture2D SquirrelRun{LoadTexture("sprites/npc/wildlife/squirrel/squirrel_run.png")};
-    const Texture2D SquirrelSleep{LoadTexture("sprites/npc/wildlife/squirrel/squirrel_sleep.png")};
-    const Texture2D SquirrelWalk{LoadTexture("sprites/npc/wildlife/squirrel/squirrel_walk.png")};
+    const Texture2D BearBrownAttack{Resident.Handle(TextureID::EnemiesBearBrownAttack)};
+    const Texture2D BearBrownDeath{Resident.Handle(TextureID::EnemiesBearBrownDeath)};
+    const Texture2D BearBrownHurt{Resident.Handle(TextureID::EnemiesBearBrownHurt)};
+    const Texture2D BearBrownIdle{Resident.Handle(TextureID::EnemiesBearBrownIdle)};
+    const Texture2D BearBrownWalk{Resident.Handle(TextureID::EnemiesBearBrownWalk)};
+    const Texture2D BearGreyAttack{Resident.Handle(TextureID::EnemiesBearGreyAttack)};
+    const Texture2D BearGreyDeath{Resident.Handle(TextureID::EnemiesBearGreyDeath)};
+    const Texture2D BearGreyHurt{Resident.Handle(TextureID::EnemiesBearGreyHurt)};
+    const Texture2D BearGreyIdle{Resident.Handle(TextureID::EnemiesBearGreyIdle)};
+    const Texture2D BearGreyWalk{Resident.Handle(TextureID::EnemiesBearGreyWalk)};
+    const Texture2D BearLightBrownAttack{Resident.Handle(TextureID::EnemiesBearLightbrownAttack)};
+    const Texture2D BearLightBrownDeath{Resident.Handle(TextureID::EnemiesBearLightbrownDeath)};
+    const Texture2D BearLightBrownHurt{Resident.Handle(TextureID::EnemiesBearLightbrownHurt)};
+    const Texture2D BearLightBrownIdle{Resident.Handle(TextureID::EnemiesBearLightbrownIdle)};
+    const Texture2D BearLightBrownWalk{Resident.Handle(TextureID::EnemiesBearLightbrownWalk)};
+    const Texture2D BearWhiteAttack{Resident.Handle(TextureID::EnemiesBearWhiteAttack)};
+    const Texture2D BearWhiteDeath{Resident.Handle(TextureID::EnemiesBearWhiteDeath)};
+    const Texture2D BearWhiteHurt{Resident.Handle(TextureID::EnemiesBearWhiteHurt)};
+    const Texture2D BearWhiteIdle{Resident.Handle(TextureID::EnemiesBearWhiteIdle)};
+    const Texture2D BearWhiteWalk{Resident.Handle(TextureID::EnemiesBearWhiteWalk)};
+
+    const Texture2D BeholderAquaAttack{Resident.Handle(TextureID::EnemiesBeholderAquaAttack)};
+    const Texture2D BeholderAquaDeath{Resident.Handle(TextureID::EnemiesBeholderAquaDeath)};
+    const Texture2D BeholderAquaHurt{Resident.Handle(TextureID::EnemiesBeholderAquaHurt)};
+    const Texture2D BeholderAquaIdle{Resident.Handle(TextureID::EnemiesBeholderAquaIdle)};
+    const Texture2D BeholderAquaProjectile{Resident.Handle(TextureID::EnemiesBeholderAquaProjectile)};
+    const Texture2D BeholderAquaWalk{Resident.Handle(TextureID::EnemiesBeholderAquaWalk)};
+    const Texture2D BeholderBlackAttack{Resident.Handle(TextureID::EnemiesBeholderBlackAttack)};
+    const Texture2D BeholderBlackDeath{Resident.Handle(TextureID::EnemiesBeholderBlackDeath)};
+    const Texture2D BeholderBlackHurt{Resident.Handle(TextureID::EnemiesBeholderBlackHurt)};
+    const Texture2D BeholderBlackIdle{Resident.Handle(TextureID::EnemiesBeholderBlackIdle)};
+    const Texture2D BeholderBlackProjectile{Resident.Handle(TextureID::EnemiesBeholderBlackProjectile)};
+    const Texture2D BeholderBlackWalk{Resident.Handle(TextureID::EnemiesBeholderBlackWalk)};
+    const Texture2D BeholderBlueAttack{Resident.Handle(TextureID::EnemiesBeholderBlueAttack)};
+    const Texture2D BeholderBlueDeath{Resident.Handle(TextureID::EnemiesBeholderBlueDeath)};
+    const Texture2D BeholderBlueHurt{Resident.Handle(TextureID::EnemiesBeholderBlueHurt)};
+    const Texture2D BeholderBlueIdle{Resident.Handle(TextureID::EnemiesBeholderBlueIdle)};
+    const Texture2D BeholderBlueProjectile{Resident.Handle(TextureID::EnemiesBeholderBlueProjectile)};
+    const Texture2D BeholderBlueWalk{Resident.Handle(TextureID::EnemiesBeholderBlueWalk)};
+    const Texture2D BeholderGreenAttack{Resident.Handle(TextureID::EnemiesBeholderGreenAttack)};
+    const Texture2D BeholderGreenDeath{Resident.Handle(TextureID::EnemiesBeholderGreenDeath)};
+    const Texture2D BeholderGreenHurt{Resident.Handle(TextureID::EnemiesBeholderGreenHurt)};
+    const Texture2D BeholderGreenIdle{Resident.Handle(TextureID::EnemiesBeholderGreenIdle)};
+    const Texture2D BeholderGreenProjectile{Resident.Handle(TextureID::EnemiesBeholderGreenProjectile)};
+    const Texture2D BeholderGreenWalk{Resident.Handle(TextureID::EnemiesBeholderGreenWalk)};
+    const Texture2D BeholderRedAttack{Resident.Handle(TextureID::EnemiesBeholderRedAttack)};
+    const Texture2D BeholderRedDeath{Resident.Handle(TextureID::EnemiesBeholderRedDeath)};
+    const Texture2D BeholderRedHurt{Resident.Handle(TextureID::EnemiesBeholderRedHurt)};
+    const Texture2D BeholderRedIdle{Resident.Handle(TextureID::EnemiesBeholderRedIdle)};
+    const Texture2D BeholderRedProjectile{Resident.Handle(TextureID::EnemiesBeholderRedProjectile)};
+    const Texture2D BeholderRedWalk{Resident.Handle(TextureID::EnemiesBeholderRedWalk)};
+
+    const Texture2D CreatureAquaAttack{Resident.Handle(TextureID::EnemiesCreatureAquaAttack)};
+    const Texture2D CreatureAquaDeath{Resident.Handle(TextureID::EnemiesCreatureAquaDeath)};
+    const Texture2D CreatureAquaHurt{Resident.Handle(TextureID::EnemiesCreatureAquaHurt)};
+    const Texture2D CreatureAquaIdle{Resident.Handle(TextureID::EnemiesCreatureAquaIdle)};
+    const Texture2D CreatureAquaWalk{Resident.Handle(TextureID::EnemiesCreatureAquaWalk)};
+    const Texture2D CreatureGreyAttack{Resident.Handle(TextureID::EnemiesCreatureGreyAttack)};
+    const Texture2D CreatureGreyDeath{Resident.Handle(TextureID::EnemiesCreatureGreyDeath)};
+    const Texture2D CreatureGreyHurt{Resident.Handle(TextureID::EnemiesCreatureGreyHurt)};
+    const Texture2D CreatureGreyIdle{Resident.Handle(TextureID::EnemiesCreatureGreyIdle)};
+    const Texture2D CreatureGreyWalk{Resident.Handle(TextureID::EnemiesCreatureGreyWalk)};
+    const Texture2D CreatureOrangeAttack{Resident.Handle(TextureID::EnemiesCreatureOrangeAttack)};
+    const Texture2D CreatureOrangeDeath{Resident.Handle(TextureID::EnemiesCreatureOrangeDeath)};
+    const Texture2D CreatureOrangeHurt{Resident.Handle(TextureID::EnemiesCreatureOrangeHurt)};
+    const Texture2D CreatureOrangeIdle{Resident.Handle(TextureID::EnemiesCreatureOrangeIdle)};
+    const Texture2D CreatureOrangeWalk{Resident.Handle(TextureID::EnemiesCreatureOrangeWalk)};
+    const Texture2D CreaturePurpleAttack{Resident.Handle(TextureID::EnemiesCreaturePurpleAttack)};
+    const Texture2D CreaturePurpleDeath{Resident.Handle(TextureID::EnemiesCreaturePurpleDeath)};
+    const Texture2D CreaturePurpleHurt{Resident.Handle(TextureID::EnemiesCreaturePurpleHurt)};
+    const Texture2D CreaturePurpleIdle{Resident.Handle(TextureID::EnemiesCreaturePurpleIdle)};
+    const Texture2D CreaturePurpleWalk{Resident.Handle(TextureID::EnemiesCreaturePurpleWalk)};
+    const Texture2D CreatureRedAttack{Resident.Handle(TextureID::EnemiesCreatureRedAttack)};
+    const Texture2D CreatureRedDeath{Resident.Handle(TextureID::EnemiesCreatureRedDeath)};
+    const Texture2D CreatureRedHurt{Resident.Handle(TextureID::EnemiesCreatureRedHurt)};
+    const Texture2D CreatureRedIdle{Resident.Handle(TextureID::EnemiesCreatureRedIdle)};
+    const Texture2D CreatureRedWalk{Resident.Handle(TextureID::EnemiesCreatureRedWalk)};
+
+    const Texture2D GhostBlackAttack{Resident.Handle(TextureID::EnemiesGhostBlackAttack)};
+    const Texture2D GhostBlackDeath{Resident.Handle(TextureID::EnemiesGhostBlackDeath)};
+    const Texture2D GhostBlackHurt{Resident.Handle(TextureID::EnemiesGhostBlackHurt)};
+    const Texture2D GhostBlackIdle{Resident.Handle(TextureID::EnemiesGhostBlackIdle)};
+    const Texture2D GhostBlackWalk{Resident.Handle(TextureID::EnemiesGhostBlackWalk)};
+    const Texture2D GhostBlueAttack{Resident.Handle(TextureID::EnemiesGhostBlueAttack)};
+    const Texture2D GhostBlueDeath{Resident.Handle(TextureID::EnemiesGhostBlueDeath)};
+    const Texture2D GhostBlueHurt{Resident.Handle(TextureID::EnemiesGhostBlueHurt)};
+    const Texture2D GhostBlueIdle{Resident.Handle(TextureID::EnemiesGhostBlueIdle)};
+    const Texture2D GhostBlueWalk{Resident.Handle(TextureID::EnemiesGhostBlueWalk)};
+    const Texture2D GhostGreenAttack{Resident.Handle(TextureID::EnemiesGhostGreenAttack)};
+    const Texture2D GhostGreenDeath{Resident.Handle(TextureID::EnemiesGhostGreenDeath)};
+    const Texture2D GhostGreenHurt{Resident.Handle(TextureID::EnemiesGhostGreenHurt)};
+    const Texture2D GhostGreenIdle{Resident.Handle(TextureID::EnemiesGhostGreenIdle)};
+    const Texture2D GhostGreenWalk{Resident.Handle(TextureID::EnemiesGhostGreenWalk)};
+    const Texture2D GhostRedAttack{Resident.Handle(TextureID::EnemiesGhostRedAttack)};
+    const Texture2D GhostRedDeath{Resident.Handle(TextureID::EnemiesGhostRedDeath)};
+    const Texture2D GhostRedHurt{Resident.Handle(TextureID::EnemiesGhostRedHurt)};
+    const Texture2D GhostRedIdle{Resident.Handle(TextureID::EnemiesGhostRedIdle)};
+    const Texture2D GhostRedWalk{Resident.Handle(TextureID::EnemiesGhostRedWalk)};
+    const Texture2D GhostWhiteAttack{Resident.Handle(TextureID::EnemiesGhostWhiteAttack)};
+    const Texture2D GhostWhiteDeath{Resident.Handle(TextureID::EnemiesGhostWhiteDeath)};
+    const Texture2D GhostWhiteHurt{Resident.Handle(TextureID::EnemiesGhostWhiteHurt)};
+    const Texture2D GhostWhiteIdle{Resident.Handle(TextureID::EnemiesGhostWhiteIdle)};
+    const Texture2D GhostWhiteWalk{Resident.Handle(TextureID::EnemiesGhostWhiteWalk)};
+    const Texture2D GhostYellowAttack{Resident.Handle(TextureID::EnemiesGhostYellowAttack)};
+    const Texture2D GhostYellowDeath{Resident.Handle(TextureID::EnemiesGhostYellowDeath)};
+    const Texture2D GhostYellowHurt{Resident.Handle(TextureID::EnemiesGhostYellowHurt)};
+    const Texture2D GhostYellowIdle{Resident.Handle(TextureID::EnemiesGhostYellowIdle)};
+    const Texture2D GhostYellowWalk{Resident.Handle(TextureID::EnemiesGhostYellowWalk)};
+
+    const Texture2D ImpBlueAttack{Resident.Handle(TextureID::EnemiesImpBlueAttack)};
+    const Texture2D ImpBlueDeath{Resident.Handle(TextureID::EnemiesImpBlueDeath)};
+    const Texture2D ImpBlueHurt{Resident.Handle(TextureID::EnemiesImpBlueHurt)};
+    const Texture2D ImpBlueIdle{Resident.Handle(TextureID::EnemiesImpBlueIdle)};
+    const Texture2D ImpBlueProjectile{Resident.Handle(TextureID::EnemiesImpBlueProjectile)};
+    const Texture2D ImpBlueWalk{Resident.Handle(TextureID::EnemiesImpBlueWalk)};
+    const Texture2D ImpGreenAttack{Resident.Handle(TextureID::EnemiesImpGreenAttack)};
+    const Texture2D ImpGreenDeath{Resident.Handle(TextureID::EnemiesImpGreenDeath)};
+    const Texture2D ImpGreenHurt{Resident.Handle(TextureID::EnemiesImpGreenHurt)};
+    const Texture2D ImpGreenIdle{Resident.Handle(TextureID::EnemiesImpGreenIdle)};
+    const Texture2D ImpGreenProjectile{Resident.Handle(TextureID::EnemiesImpGreenProjectile)};
+    const Texture2D ImpGreenWalk{Resident.Handle(TextureID::EnemiesImpGreenWalk)};
+    const Texture2D ImpGreyAttack{Resident.Handle(TextureID::EnemiesImpGreyAttack)};
+    const Texture2D ImpGreyDeath{Resident.Handle(TextureID::EnemiesImpGreyDeath)};
+    const Texture2D ImpGreyHurt{Resident.Handle(TextureID::EnemiesImpGreyHurt)};
+    const Texture2D ImpGreyIdle{Resident.Handle(TextureID::EnemiesImpGreyIdle)};
+    const Texture2D ImpGreyProjectile{Resident.Handle(TextureID::EnemiesImpGreyProjectile)};
+    const Texture2D ImpGreyWalk{Resident.Handle(TextureID::EnemiesImpGreyWalk)};
+    const Texture2D ImpRedAttack{Resident.Handle(TextureID::EnemiesImpRedAttack)};
+    const Texture2D ImpRedDeath{Resident.Handle(TextureID::EnemiesImpRedDeath)};
+    const Texture2D ImpRedHurt{Resident.Handle(TextureID::EnemiesImpRedHurt)};
+    const Texture2D ImpRedIdle{Resident.Handle(TextureID::EnemiesImpRedIdle)};
+    const Texture2D ImpRedProjectile{Resident.Handle(TextureID::EnemiesImpRedProjectile)};
+    const Texture2D ImpRedWalk{Resident.Handle(TextureID::EnemiesImpRedWalk)};
+    const Texture2D ImpYellowAttack{Resident.Handle(TextureID::EnemiesImpYellowAttack)};
+    const Texture2D ImpYellowDeath{Resident.Handle(TextureID::EnemiesImpYellowDeath)};
+    const Texture2D ImpYellowHurt{Resident.Handle(TextureID::EnemiesImpYellowHurt)};
+    const Texture2D ImpYellowIdle{Resident.Handle(TextureID::EnemiesImpYellowIdle)};
+    const Texture2D ImpYellowProjectile{Resident.Handle(TextureID::EnemiesImpYellowProjectile)};
+    const Texture2D ImpYellowWalk{Resident.Handle(TextureID::EnemiesImpYellowWalk)};
+
+    const Texture2D MushroomBlueAttack{Resident.Handle(TextureID::EnemiesMushroomBlueAttack)};
+    const Texture2D MushroomBlueDeath{Resident.Handle(TextureID::EnemiesMushroomBlueDeath)};
+    const Texture2D MushroomBlueHurt{Resident.Handle(TextureID::EnemiesMushroomBlueHurt)};
+    const Texture2D MushroomBlueIdle{Resident.Handle(TextureID::EnemiesMushroomBlueIdle)};
+    const Texture2D MushroomBlueWalk{Resident.Handle(TextureID::EnemiesMushroomBlueWalk)};
+    const Texture2D MushroomBrownAttack{Resident.Handle(TextureID::EnemiesMushroomBrownAttack)};
+    const Texture2D MushroomBrownDeath{Resident.Handle(TextureID::EnemiesMushroomBrownDeath)};
+    const Texture2D MushroomBrownHurt{Resident.Handle(TextureID::EnemiesMushroomBrownHurt)};
+    const Texture2D MushroomBrownIdle{Resident.Handle(TextureID::EnemiesMushroomBrownIdle)};
+    const Texture2D MushroomBrownWalk{Resident.Handle(TextureID::EnemiesMushroomBrownWalk)};
+    const Texture2D MushroomGreenAttack{Resident.Handle(TextureID::EnemiesMushroomGreenAttack)};
+    const Texture2D MushroomGreenDeath{Resident.Handle(TextureID::EnemiesMushroomGreenDeath)};
+    const Texture2D MushroomGreenHurt{Resident.Handle(TextureID::EnemiesMushroomGreenHurt)};
+    const Texture2D MushroomGreenIdle{Resident.Handle(TextureID::EnemiesMushroomGreenIdle)};
+    const Texture2D MushroomGreenWalk{Resident.Handle(TextureID::EnemiesMushroomGreenWalk)};
+    const Texture2D MushroomPinkAttack{Resident.Handle(TextureID::EnemiesMushroomPinkAttack)};
+    const Texture2D MushroomPinkDeath{Resident.Handle(TextureID::EnemiesMushroomPinkDeath)};
+    const Texture2D MushroomPinkHurt{Resident.Handle(TextureID::EnemiesMushroomPinkHurt)};
+    const Texture2D MushroomPinkIdle{Resident.Handle(TextureID::EnemiesMushroomPinkIdle)};
+    const Texture2D MushroomPinkWalk{Resident.Handle(TextureID::EnemiesMushroomPinkWalk)};
+    const Texture2D MushroomRedAttack{Resident.Handle(TextureID::EnemiesMushroomRedAttack)};
+    const Texture2D MushroomRedDeath{Resident.Handle(TextureID::EnemiesMushroomRedDeath)};
+    const Texture2D MushroomRedHurt{Resident.Handle(TextureID::EnemiesMushroomRedHurt)};
+    const Texture2D MushroomRedIdle{Resident.Handle(TextureID::EnemiesMushroomRedIdle)};
+    const Texture2D MushroomRedWalk{Resident.Handle(TextureID::EnemiesMushroomRedWalk)};
+    const Texture2D MushroomTealAttack{Resident.Handle(TextureID::EnemiesMushroomTealAttack)};
+    const Texture2D MushroomTealDeath{Resident.Handle(TextureID::EnemiesMushroomTealDeath)};
+    const Texture2D MushroomTealHurt{Resident.Handle(TextureID::EnemiesMushroomTealHurt)};
+    const Texture2D MushroomTealIdle{Resident.Handle(TextureID::EnemiesMushroomTealIdle)};
+    const Texture2D MushroomTealWalk{Resident.Handle(TextureID::EnemiesMushroomTealWalk)};
+
+    const Texture2D NecromancerBlueAttack{Resident.Handle(TextureID::EnemiesNecromancerBlueAttack)};
+    const Texture2D NecromancerBlueDeath{Resident.Handle(TextureID::EnemiesNecromancerBlueDeath)};
+    const Texture2D NecromancerBlueHurt{Resident.Handle(TextureID::EnemiesNecromancerBlueHurt)};
+    const Texture2D NecromancerBlueIdle{Resident.Handle(TextureID::EnemiesNecromancerBlueIdle)};
+    const Texture2D NecromancerBlueProjectile{Resident.Handle(TextureID::EnemiesNecromancerBlueProjectile)};
+    const Texture2D NecromancerBlueWalk{Resident.Handle(TextureID::EnemiesNecromancerBlueWalk)};
+    const Texture2D NecromancerBrownAttack{Resident.Handle(TextureID::EnemiesNecromancerBrownAttack)};
+    const Texture2D NecromancerBrownDeath{Resident.Handle(TextureID::EnemiesNecromancerBrownDeath)};
+    const Texture2D NecromancerBrownHurt{Resident.Handle(TextureID::EnemiesNecromancerBrownHurt)};
+    const Texture2D NecromancerBrownIdle{Resident.Handle(TextureID::EnemiesNecromancerBrownIdle)};
+    const Texture2D NecromancerBrownProjectile{Resident.Handle(TextureID::EnemiesNecromancerBrownProjectile)};
+    const Texture2D NecromancerBrownWalk{Resident.Handle(TextureID::EnemiesNecromancerBrownWalk)};
+    const Texture2D NecromancerPurpleAttack{Resident.Handle(TextureID::EnemiesNecromancerPurpleAttack)};
+    const Texture2D NecromancerPurpleDeath{Resident.Handle(TextureID::EnemiesNecromancerPurpleDeath)};
+    const Texture2D NecromancerPurpleHurt{Resident.Handle(TextureID::EnemiesNecromancerPurpleHurt)};
+    const Texture2D NecromancerPurpleIdle{Resident.Handle(TextureID::EnemiesNecromancerPurpleIdle)};
+    const Texture2D NecromancerPurpleProjectile{Resident.Handle(TextureID::EnemiesNecromancerPurpleProjectile)};
+    const Texture2D NecromancerPurpleWalk{Resident.Handle(TextureID::EnemiesNecromancerPurpleWalk)};
+    const Texture2D NecromancerRedAttack{Resident.Handle(TextureID::EnemiesNecromancerRedAttack)};
+    const Texture2D NecromancerRedDeath{Resident.Handle(TextureID::EnemiesNecromancerRedDeath)};
+    const Texture2D NecromancerRedHurt{Resident.Handle(TextureID::EnemiesNecromancerRedHurt)};
+    const Texture2D NecromancerRedIdle{Resident.Handle(TextureID::EnemiesNecromancerRedIdle)};
+    const Texture2D NecromancerRedProjectile{Resident.Handle(TextureID::EnemiesNecromancerRedProjectile)};
+    const Texture2D NecromancerRedWalk{Resident.Handle(TextureID::EnemiesNecromancerRedWalk)};
+
+    const Texture2D ShadowBlueAttack{Resident.Handle(TextureID::EnemiesShadowBlueAttack)};
+    const Texture2D ShadowBlueDeath{Resident.Handle(TextureID::EnemiesShadowBlueDeath)};
+    const Texture2D ShadowBlueHurt{Resident.Handle(TextureID::EnemiesShadowBlueHurt)};
+    const Texture2D ShadowBlueIdle{Resident.Handle(TextureID::EnemiesShadowBlueIdle)};
+    const Texture2D ShadowBlueWalk{Resident.Handle(TextureID::EnemiesShadowBlueWalk)};
+    const Texture2D ShadowRedAttack{Resident.Handle(TextureID::EnemiesShadowRedAttack)};
+    const Texture2D ShadowRedDeath{Resident.Handle(TextureID::EnemiesShadowRedDeath)};
+    const Texture2D ShadowRedHurt{Resident.Handle(TextureID::EnemiesShadowRedHurt)};
+    const Texture2D ShadowRedIdle{Resident.Handle(TextureID::EnemiesShadowRedIdle)};
+    const Texture2D ShadowRedWalk{Resident.Handle(TextureID::EnemiesShadowRedWalk)};
+    const Texture2D ShadowTealAttack{Resident.Handle(TextureID::EnemiesShadowTealAttack)};
+    const Texture2D ShadowTealDeath{Resident.Handle(TextureID::EnemiesShadowTealDeath)};
+    const Texture2D ShadowTealHurt{Resident.Handle(TextureID::EnemiesShadowTealHurt)};
+    const Texture2D ShadowTealIdle{Resident.Handle(TextureID::EnemiesShadowTealIdle)};
+    const Texture2D ShadowTealWalk{Resident.Handle(TextureID::EnemiesShadowTealWalk)};
+    const Texture2D ShadowYellowAttack{Resident.Handle(TextureID::EnemiesShadowYellowAttack)};
+    const Texture2D ShadowYellowDeath{Resident.Handle(TextureID::EnemiesShadowYellowDeath)};
+    const Texture2D ShadowYellowHurt{Resident.Handle(TextureID::EnemiesShadowYellowHurt)};
+    const Texture2D ShadowYellowIdle{Resident.Handle(TextureID::EnemiesShadowYellowIdle)};
+    const Texture2D ShadowYellowWalk{Resident.Handle(TextureID::EnemiesShadowYellowWalk)};
+
+    const Texture2D SpiderBlackAttack{Resident.Handle(TextureID::EnemiesSpiderBlackAttack)};
+    const Texture2D SpiderBlackDeath{Resident.Handle(TextureID::EnemiesSpiderBlackDeath)};
+    const Texture2D SpiderBlackHurt{Resident.Handle(TextureID::EnemiesSpiderBlackHurt)};
+    const Texture2D SpiderBlackIdle{Resident.Handle(TextureID::EnemiesSpiderBlackIdle)};
+    const Texture2D SpiderBlackWalk{Resident.Handle(TextureID::EnemiesSpiderBlackWalk)};
+    const Texture2D SpiderBlueAttack{Resident.Handle(TextureID::EnemiesSpiderBlueAttack)};
+    const Texture2D SpiderBlueDeath{Resident.Handle(TextureID::EnemiesSpiderBlueDeath)};
+    const Texture2D SpiderBlueHurt{Resident.Handle(TextureID::EnemiesSpiderBlueHurt)};
+    const Texture2D SpiderBlueIdle{Resident.Handle(TextureID::EnemiesSpiderBlueIdle)};
+    const Texture2D SpiderBlueWalk{Resident.Handle(TextureID::EnemiesSpiderBlueWalk)};
+    const Texture2D SpiderBrownAttack{Resident.Handle(TextureID::EnemiesSpiderBrownAttack)};
+    const Texture2D SpiderBrownDeath{Resident.Handle(TextureID::EnemiesSpiderBrownDeath)};
+    const Texture2D SpiderBrownHurt{Resident.Handle(TextureID::EnemiesSpiderBrownHurt)};
+    const Texture2D SpiderBrownIdle{Resident.Handle(TextureID::EnemiesSpiderBrownIdle)};
+    const Texture2D SpiderBrownWalk{Resident.Handle(TextureID::EnemiesSpiderBrownWalk)};
+    const Texture2D SpiderGreenAttack{Resident.Handle(TextureID::EnemiesSpiderGreenAttack)};
+    const Texture2D SpiderGreenDeath{Resident.Handle(TextureID::EnemiesSpiderGreenDeath)};
+    const Texture2D SpiderGreenHurt{Resident.Handle(TextureID::EnemiesSpiderGreenHurt)};
+    const Texture2D SpiderGreenIdle{Resident.Handle(TextureID::EnemiesSpiderGreenIdle)};
+    const Texture2D SpiderGreenWalk{Resident.Handle(TextureID::EnemiesSpiderGreenWalk)};
+    const Texture2D SpiderRedAttack{Resident.Handle(TextureID::EnemiesSpiderRedAttack)};
+    const Texture2D SpiderRedDeath{Resident.Handle(TextureID::EnemiesSpiderRedDeath)};
+    const Texture2D SpiderRedHurt{Resident.Handle(TextureID::EnemiesSpiderRedHurt)};
+    const Texture2D SpiderRedIdle{Resident.Handle(TextureID::EnemiesSpiderRedIdle)};
+    const Texture2D SpiderRedWalk{Resident.Handle(TextureID::EnemiesSpiderRedWalk)};
+
+    const Texture2D ToadBlueAttack{Resident.Handle(TextureID::EnemiesToadBlueAttack)};
+    const Texture2D ToadBlueDeath{Resident.Handle(TextureID::EnemiesToadBlueDeath)};
+    const Texture2D ToadBlueHurt{Resident.Handle(TextureID::EnemiesToadBlueHurt)};
+    const Texture2D ToadBlueIdle{Resident.Handle(TextureID::EnemiesToadBlueIdle)};
+    const Texture2D ToadBlueWalk{Resident.Handle(TextureID::EnemiesToadBlueWalk)};
+    const Texture2D ToadGreenAttack{Resident.Handle(TextureID::EnemiesToadGreenAttack)};
+    const Texture2D ToadGreenDeath{Resident.Handle(TextureID::EnemiesToadGreenDeath)};
+    const Texture2D ToadGreenHurt{Resident.Handle(TextureID::EnemiesToadGreenHurt)};
+    const Texture2D ToadGreenIdle{Resident.Handle(TextureID::EnemiesToadGreenIdle)};
+    const Texture2D ToadGreenWalk{Resident.Handle(TextureID::EnemiesToadGreenWalk)};
+    const Texture2D ToadPinkAttack{Resident.Handle(TextureID::EnemiesToadPinkAttack)};
+    const Texture2D ToadPinkDeath{Resident.Handle(TextureID::EnemiesToadPinkDeath)};
+    const Texture2D ToadPinkHurt{Resident.Handle(TextureID::EnemiesToadPinkHurt)};
+    const Texture2D ToadPinkIdle{Resident.Handle(TextureID::EnemiesToadPinkIdle)};
+    const Texture2D ToadPinkWalk{Resident.Handle(TextureID::EnemiesToadPinkWalk)};
+    const Texture2D ToadRedAttack{Resident.Handle(TextureID::EnemiesToadRedAttack)};
+    const Texture2D ToadRedDeath{Resident.Handle(TextureID::EnemiesToadRedDeath)};
+    const Texture2D ToadRedHurt{Resident.Handle(TextureID::EnemiesToadRedHurt)};
+    const Texture2D ToadRedIdle{Resident.Handle(TextureID::EnemiesToadRedIdle)};
+    const Texture2D ToadRedWalk{Resident.Handle(TextureID::EnemiesToadRedWalk)};
+    const Texture2D ToadWhiteAttack{Resident.Handle(TextureID::EnemiesToadWhiteAttack)};
+    const Texture2D ToadWhiteDeath{Resident.Handle(TextureID::EnemiesToadWhiteDeath)};
+    const Texture2D ToadWhiteHurt{Resident.Handle(TextureID::EnemiesToadWhiteHurt)};
+    const Texture2D ToadWhiteIdle{Resident.Handle(TextureID::EnemiesToadWhiteIdle)};
+    const Texture2D ToadWhiteWalk{Resident.Handle(TextureID::EnemiesToadWhiteWalk)};
+
+    const Texture2D CrowFlySleep{Resident.Handle(TextureID::NpcWildlifeCrowCrowFlySleep)};
+    const Texture2D CrowFlying{Resident.Handle(TextureID::NpcWildlifeCrowCrowFlying)};
+    const Texture2D CrowGroundSleep{Resident.Handle(TextureID::NpcWildlifeCrowCrowGroundSleep)};
+    const Texture2D CrowIdle{Resident.Handle(TextureID::NpcWildlifeCrowCrowIdle)};
+    const Texture2D CrowIdleTwo{Resident.Handle(TextureID::NpcWildlifeCrowCrowIdle2)};
+    const Texture2D CrowWalk{Resident.Handle(TextureID::NpcWildlifeCrowCrowWalk)};
+
+    const Texture2D FoxFamilyAngry{Resident.Handle(TextureID::NpcWildlifeFoxFoxFamilyAngry)};
+    const Texture2D FoxFamilyIdle{Resident.Handle(TextureID::NpcWildlifeFoxFoxFamilyIdle)};
+    const Texture2D FoxFamilyIdleTwo{Resident.Handle(TextureID::NpcWildlifeFoxFoxFamilyIdle2)};
+    const Texture2D FoxFamilyLazy{Resident.Handle(TextureID::NpcWildlifeFoxFoxFamilyLazy)};
+    const Texture2D FoxFamilyRun{Resident.Handle(TextureID::NpcWildlifeFoxFoxFamilyRun)};
+    const Texture2D FoxFamilySleep{Resident.Handle(TextureID::NpcWildlifeFoxFoxFamilySleep)};
+    const Texture2D FoxFamilyWalk{Resident.Handle(TextureID::NpcWildlifeFoxFoxFamilyWalk)};
+
+    const Texture2D SquirrelEat{Resident.Handle(TextureID::NpcWildlifeSquirrelSquirrelEat)};
+    const Texture2D SquirrelIdle{Resident.Handle(TextureID::NpcWildlifeSquirrelSquirrelIdle)};
+    const Texture2D SquirrelIdleTwo{Resident.Handle(TextureID::NpcWildlifeSquirrelSquirrelIdle2)};
+    const Texture2D SquirrelJump{Resident.Handle(TextureID::NpcWildlifeSquirrelSquirrelJump)};
+    const Texture2D SquirrelRun{Resident.Handle(TextureID::NpcWildlifeSquirrelSquirrelRun)};
+    const Texture2D SquirrelSleep{Resident.Handle(TextureID::NpcWildlifeSquirrelSquirrelSleep)};
+    const Texture2D SquirrelWalk{Resident.Handle(TextureID::NpcWildlifeSquirrelSquirrelWalk)};
 };
 
 #endif // gametextures_hpp
\ No newline at end of file
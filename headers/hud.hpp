@@ -8,14 +8,19 @@ class HUD
 public:
     explicit HUD(const GameTexture& GameTextures);
     
-    void Tick();
-    void Draw(float Health, Emotion State);
+    void Tick(float Health, Emotion State);
+    void Draw(UILayer& Interface) const;
     
 private:
+    void Rebuild();
+
     const GameTexture& GameTextures;
     Texture2D Fox{};
+    std::vector<Quad> Hearts{};
 
+    float Health{-1.f};
     float Scale{2.f};
+    Emotion State{Emotion::DEFAULT};
 };
 
-#endif // HUD_HPP
\ No newline at end of file
+#endif // HUD_HPP
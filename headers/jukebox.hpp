@@ -0,0 +1,69 @@
+#ifndef JUKEBOX_HPP
+#define JUKEBOX_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <raylib.h>
+
+enum class Track
+{
+    FOREST, DUNGEON, PAUSE
+};
+
+// Owns the music streams and refills them on its own thread so a long frame never starves the buffers.
+// The game thread only posts commands; they travel through a single producer, single consumer ring
+// and every raylib music call happens on the streaming thread.
+class Jukebox
+{
+public:
+    Jukebox();
+    ~Jukebox();
+    Jukebox(const Jukebox&) = delete;
+    Jukebox& operator=(const Jukebox&) = delete;
+
+    void Play(const Track Theme, const float Volume) {Post({Action::PLAY, Theme, Volume});}
+    void Pause(const Track Theme) {Post({Action::PAUSE, Theme});}
+    void Resume(const Track Theme) {Post({Action::RESUME, Theme});}
+    void SetVolume(const Track Theme, const float Volume) {Post({Action::VOLUME, Theme, Volume});}
+    void Crossfade(const Track From, const Track To, const float Volume, const float Seconds);
+
+private:
+    enum class Action
+    {
+        PLAY, PAUSE, RESUME, VOLUME, FADEIN, FADEOUT
+    };
+
+    struct Command
+    {
+        Action Type{};
+        Track Theme{};
+        float Volume{};
+        float Seconds{};
+    };
+
+    struct Stream
+    {
+        Music Source{};
+        float Volume{};
+        float Gain{1.f};            // crossfade level on top of Volume
+        float Rate{};               // gain change per second, negative while fading out
+        bool Playing{false};
+    };
+
+    bool Post(const Command& Order);
+    void Apply(const Command& Order);
+    void Run();
+
+    static constexpr size_t Capacity{32};
+
+    std::array<Stream, 3> Streams{};
+    std::array<Command, Capacity> Ring{};
+    std::atomic<size_t> Head{};         // next slot the game thread writes
+    std::atomic<size_t> Tail{};         // next slot the streaming thread reads
+    std::atomic<bool> Running{true};
+    std::thread Worker{};
+};
+
+#endif // JUKEBOX_HPP
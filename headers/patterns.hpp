@@ -0,0 +1,98 @@
+#ifndef PATTERNS_HPP
+#define PATTERNS_HPP
+
+#include <array>
+#include <span>
+#include "archetype.hpp"
+#include "projectiles.hpp"
+
+enum class PatternShape
+{
+    RADIAL, SPIRAL, AIMED, WAVE
+};
+
+// One boss attack described as data, an Emitter turns it into projectiles
+struct BulletPattern
+{
+    PatternShape Shape{PatternShape::AIMED};
+    int Count{1};                           // projectiles per shot
+    int Shots{1};                           // shots before the script moves on
+    float Interval{1.f};                    // seconds between shots
+    float Spread{0.f};                      // degrees covered by an aimed fan, or swept by a wave
+    float Spin{0.f};                        // degrees the pattern turns between shots
+    float Speed{Projectiles::Speed};
+    float Life{Projectiles::Lifetime};
+    float Damage{1.f};
+};
+
+namespace Pattern
+{
+    // evenly spaced ring around the shooter
+    constexpr BulletPattern Radial(const int Count, const int Shots, const float Interval, const float Speed, const float Life)
+    {
+        return BulletPattern{.Shape = PatternShape::RADIAL, .Count = Count, .Shots = Shots, .Interval = Interval, .Spin = 180.f / Count, .Speed = Speed, .Life = Life};
+    }
+
+    // a few arms that turn a little every shot
+    constexpr BulletPattern Spiral(const int Arms, const int Shots, const float Interval, const float Spin, const float Life)
+    {
+        return BulletPattern{.Shape = PatternShape::SPIRAL, .Count = Arms, .Shots = Shots, .Interval = Interval, .Spin = Spin, .Life = Life};
+    }
+
+    // fan centred on the fox
+    constexpr BulletPattern Aimed(const int Count, const float Spread, const int Shots, const float Interval)
+    {
+        return BulletPattern{.Shape = PatternShape::AIMED, .Count = Count, .Shots = Shots, .Interval = Interval, .Spread = Spread};
+    }
+
+    // tight fan that sweeps back and forth across the fox
+    constexpr BulletPattern Wave(const int Count, const float Spread, const int Shots, const float Interval, const float Life)
+    {
+        return BulletPattern{.Shape = PatternShape::WAVE, .Count = Count, .Shots = Shots, .Interval = Interval, .Spread = Spread, .Spin = 25.f, .Life = Life};
+    }
+
+    // the old forest boss fired its next volley once the last one had faded, about 1.015 s apart
+    inline constexpr float OldVolleyInterval{Projectiles::Lifetime};
+
+    // forest bosses keep the old three way volley and add a ring now and then
+    inline constexpr std::array<BulletPattern, 2> Boss
+    {{
+        Aimed(3, 90.f, 3, OldVolleyInterval),
+        Radial(8, 2, 0.6f, 160.f, 1.5f)
+    }};
+
+    // the dungeon fight runs through every shape in turn
+    inline constexpr std::array<BulletPattern, 5> FinalBoss
+    {{
+        Aimed(5, 60.f, 4, 0.4f),
+        Spiral(4, 60, 0.06f, 9.f, 3.f),
+        Radial(20, 4, 0.5f, 150.f, 3.f),
+        Wave(3, 80.f, 24, 0.1f, 2.5f),
+        Spiral(6, 40, 0.08f, -13.f, 3.f)
+    }};
+
+    std::span<const BulletPattern> GetScript(const EnemyType Type);
+}
+
+// Steps one shooter through its script on the fixed projectile step
+class Emitter
+{
+public:
+    Emitter() = default;
+    explicit Emitter(std::span<const BulletPattern> Script);
+
+    void Tick(const float DeltaTime, Projectiles& Missiles, const SpriteSheet& Sheet, const Vector2 Origin, const Vector2 Target, const float Scale);
+    void Reset() {ShotTime = Script.empty() ? 0.f : Script[Current].Interval;}
+
+private:
+    void Fire(const BulletPattern& Pattern, Projectiles& Missiles, const SpriteSheet& Sheet, const Vector2 Origin, const Vector2 Target, const float Scale);
+
+    std::span<const BulletPattern> Script{};
+    size_t Current{};
+    int ShotsFired{};
+    float ShotTime{};
+    float Accumulator{};
+    float Phase{};                          // degrees, turned by Spin after every shot
+};
+
+#endif // PATTERNS_HPP
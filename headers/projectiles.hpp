@@ -0,0 +1,55 @@
+#ifndef PROJECTILES_HPP
+#define PROJECTILES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "prop.hpp"
+
+class Character;
+
+// Every projectile in flight, stored column by column so the bulk passes only touch what they need.
+// Dead slots go on a free list and are handed out again by the next Spawn.
+class Projectiles
+{
+public:
+    Projectiles() = default;
+
+    void Spawn(const SpriteSheet& Sheet, const std::uint8_t Row, const Vector2 WorldPos, const Vector2 Velocity, const float Scale, const float Damage, const float Life = Lifetime);
+    void Tick(const float DeltaTime);
+    void Collide(Character& Fox, Props& Props, std::pmr::vector<Prop>& Trees);
+    void Collide(Character& Fox);
+    void Draw(const GameTexture& Textures, const Vector2 CharacterWorldPos) const;
+    void DrawHitboxes(const Vector2 CharacterWorldPos, const Color RecColor) const;
+    void Clear();
+    void Reserve(const size_t Capacity);
+
+    size_t Count() const {return Live.size() - Free.size();}
+
+    static constexpr float Speed{187.2f};          // the old 1.3px Trajectory step at 144fps
+    static constexpr float Range{190.f};           // distance a straight shot covers before it fades
+    static constexpr float Lifetime{Range / Speed};
+    static constexpr float Step{1.f / 144.f};      // fixed update step, projectiles move the same at any frame rate
+    static constexpr float MaxCatchUp{0.1f};       // most time one Tick will simulate after a stall
+
+private:
+    void Advance();
+    void Collide(Character& Fox, const std::vector<Rectangle>& Solids);
+    void Release(const size_t Slot);
+    Rectangle GetHitbox(const size_t Slot, const Vector2 CharacterWorldPos) const;
+
+    std::vector<float> X{};
+    std::vector<float> Y{};
+    std::vector<float> VelocityX{};
+    std::vector<float> VelocityY{};
+    std::vector<float> Life{};
+    std::vector<float> Scale{};
+    std::vector<float> Damage{};
+    std::vector<const SpriteSheet*> Sheet{};
+    std::vector<std::uint8_t> Row{};
+    std::vector<std::uint8_t> Live{};
+    std::vector<std::uint32_t> Free{};
+    float Accumulator{};
+};
+
+#endif // PROJECTILES_HPP
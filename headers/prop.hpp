@@ -1,8 +1,11 @@
 #ifndef PROP_HPP
 #define PROP_HPP
 
+#include <array>
 #include <vector>
 #include <string>
+#include <string_view>
+#include <memory_resource>
 #include <tuple>
 #include <unordered_map>
 #include "sprite.hpp"
@@ -14,7 +17,6 @@ enum class PropType
     TREE, 
     ROCK, 
     BOULDER, 
-    GRASS, 
     FLOWER,
     rHOUSELEFT, rHOUSERIGHT, DOOR,
     bHOUSELEFT, bHOUSERIGHT,
@@ -41,17 +43,75 @@ enum class Progress
     ACT_O, ACT_I, ACT_II, ACT_III, ACT_IV, ACT_V, ACT_VI, ACT_VII, ACT_VIII, ACT_IX, ACT_X
 };
 
+// Items a chest can hold or an altar piece stands for. Props keep the id and look the name up
+// in ItemNames, so no prop owns a string.
+enum class ItemID
+{
+    NONE,
+    SILVER_BRACELET,
+    CRYPTEX,
+    TOP_LEFT_ALTAR_PIECE, TOP_ALTAR_PIECE, TOP_RIGHT_ALTAR_PIECE,
+    BOTTOM_LEFT_ALTAR_PIECE, BOTTOM_ALTAR_PIECE, BOTTOM_RIGHT_ALTAR_PIECE,
+    COUNT
+};
+
+inline constexpr std::array<std::string_view, static_cast<size_t>(ItemID::COUNT)> ItemNames
+{
+    "None",
+    "Silver Bracelet",
+    "Cryptex",
+    "Top Left Altar Piece", "Top Altar Piece", "Top Right Altar Piece",
+    "Bottom Left Altar Piece", "Bottom Altar Piece", "Bottom Right Altar Piece"
+};
+
 struct Props;
+class Dialogue;
+
+// Quest flags for one world. Every prop in the world points at the same one, so an NPC
+// finishing an act is seen by the chests and altar pieces without any process-wide state.
+struct Questline
+{
+    std::unordered_map<PropType, std::pair<Progress, PropType>> Acts
+    {
+        {PropType::NPC_DIANA, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
+        {PropType::NPC_JADE, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
+        {PropType::NPC_SON, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
+        {PropType::NPC_RUMBY, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
+        {PropType::NPC_O, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
+        {PropType::TREASURE, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
+    };
+
+    int PiecesReceived{0};
+    int PiecesAdded{0};
+    bool SonSaved{false};
+    bool FinalAct{false};
+    bool BraceletReceived{false};
+    bool CryptexReceived{false};
+    bool FinalChestKey{false};
+    bool FinalChestSpawned{false};
+    bool FirstPieceInserted{false};
+
+    std::vector<std::tuple<ItemID, bool, bool, bool>> AltarPieces {
+            // {Item, ItemUnlocked, ItemVisible, ItemInserted}
+            {ItemID::TOP_LEFT_ALTAR_PIECE, false, false, false}, 
+            {ItemID::TOP_ALTAR_PIECE, false, false, false}, 
+            {ItemID::TOP_RIGHT_ALTAR_PIECE, false, false, false}, 
+            {ItemID::BOTTOM_LEFT_ALTAR_PIECE, false, false, false},
+            {ItemID::BOTTOM_ALTAR_PIECE, false, false, false}, 
+            {ItemID::BOTTOM_RIGHT_ALTAR_PIECE, false, false, false}
+    };
+};
 
 class Prop 
 {
 public:
     // Constructor for inanimate props
-    Prop(const Texture2D& Texture, 
+    Prop(const SpriteSheet& Sheet, 
          const Vector2 Pos, 
          const PropType Type, 
          const GameTexture& GameTextures, 
-         const GameAudio& Audio,
+         GameAudio& Audio,
+         Questline& Quest,
          const float Scale = 4.f, 
          const bool Moveable = false, 
          const bool Interactable = false,
@@ -62,8 +122,9 @@ public:
          const Vector2 Pos, 
          const PropType Type, 
          const GameTexture& GameTextures, 
-         const GameAudio& Audio,
-         const std::string& ItemName = "None", 
+         GameAudio& Audio,
+         Questline& Quest,
+         const ItemID Contents = ItemID::NONE, 
          const bool Spawned = false, 
          const bool Interactable = false);      
 
@@ -72,7 +133,8 @@ public:
          const Vector2 Pos, 
          const PropType Type, 
          const GameTexture& GameTextures,
-         const GameAudio& Audio, 
+         GameAudio& Audio, 
+         Questline& Quest,
          const Texture2D& Item, 
          const float Scale = 4.f, 
          const bool Moveable = false, 
@@ -80,17 +142,18 @@ public:
          const Progress TriggerAct = Progress::ACT_O, 
          const PropType TriggerNPC = PropType::NPC_O, 
          const bool Spawn = true,
-         const std::string& ItemName = "None", 
+         const ItemID Contents = ItemID::NONE, 
          const float ItemScale = 2.f);
     
     void Tick(const float DeltaTime);
-    void Draw(const Vector2 CharacterWorldPos);
+    void Draw(const Vector2 CharacterWorldPos, Dialogue& Speech);
+    void CollectTextures(std::vector<Texture2D>& Into) const;
 
-    void NpcTick(const float DeltaTime);
-    void AltarTick(const float DeltaTime);
+    void NpcTick();
     void OpenChest(const float DeltaTime);
     void TreasureTick(const float DeltaTime);
     void CheckVisibility(const Vector2 CharacterWorldPos);
+    bool IsAnimating() const;
     void InsertAltarPiece();
     void TalkToNpc();
     void UpdateNpcInactive();
@@ -110,12 +173,13 @@ public:
     constexpr bool IsActive() const {return Active;}
     constexpr bool IsOpened() const {return Opened;}
     constexpr bool IsSpawned() const {return Spawned;}
-    bool IsFinalAct() const {return FinalAct;}
+    bool IsFinalAct() const {return Quest.FinalAct;}
     bool WithinScreen(const Vector2 CharacterWorldPos);
     
     constexpr Vector2 GetWorldPos() const {return WorldPos;}
     constexpr PropType GetType() const {return Type;}
-    std::string GetItemName() const {return ItemName;}
+    constexpr ItemID GetContents() const {return Contents;}
+    std::string_view GetItemName() const {return ItemNames.at(static_cast<size_t>(Contents));}
     Rectangle GetCollisionRec(const Vector2 CharacterWorldPos);
     Rectangle GetInteractRec(const Vector2 CharacterWorldPos);
     
@@ -123,16 +187,17 @@ public:
     void SetOpened(const bool Input) {Opened = Input;}
     void SetSpawned(const bool Input) {Spawned = Input;}
     void UndoMovement() {WorldPos = PrevWorldPos;}
-    bool CheckMovement(Background& Map, const Vector2 CharWorldPos, const Vector2 Direction, const float Speed, std::vector<std::vector<Prop>>& Props);
+    bool CheckMovement(Background& Map, const Vector2 CharWorldPos, const Vector2 Direction, const float Speed, std::pmr::vector<std::pmr::vector<Prop>>& Props);
 
-    void DrawPropText();
-    void DrawSpeech();
+    void DrawPropText(Dialogue& Speech);
+    void DrawSpeech(Dialogue& Speech);
     
 private:
     Sprite Object{};
     const PropType Type{};
     const GameTexture& GameTextures;
-    const GameAudio& Audio;
+    GameAudio& Audio;
+    Questline& Quest;
     Vector2 WorldPos{};
     Vector2 PrevWorldPos{};
     float Scale {4.f};
@@ -158,51 +223,25 @@ private:
     bool MuteNewInfo{false};
     bool ReadyToProgress{false};
 
-    static inline std::unordered_map<PropType, std::pair<Progress, PropType>> QuestlineProgress
-    {
-        {PropType::NPC_DIANA, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
-        {PropType::NPC_JADE, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
-        {PropType::NPC_SON, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
-        {PropType::NPC_RUMBY, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
-        {PropType::NPC_O, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
-        {PropType::TREASURE, std::make_pair(Progress::ACT_O, PropType::NPC_O)},
-    };
-
     // Treasure variables
     bool ReceiveItem{false};
     bool InsertPiece{false};
     const Texture2D Item{};
-    const std::string ItemName{};
+    const ItemID Contents{ItemID::NONE};
     float ItemScale{};
     Vector2 ItemPos{};
     float RunningTime{};
-    static inline int PiecesReceived{0};
-    static inline int PiecesAdded{0};
-    static inline bool SonSaved{false};
-    static inline bool FinalAct{false};
-    static inline bool BraceletReceived{false};
-    static inline bool CryptexReceived{false};
-    static inline bool FinalChestKey{false};
-    static inline bool FinalChestSpawned{false};
-    static inline bool FirstPieceInserted{false};
-
-    static inline std::vector<std::tuple<std::string, bool, bool, bool>> AltarPieces {
-            // {"ItemName", ItemUnlocked, ItemVisible, ItemInserted}
-            {"Top Left Altar Piece", false, false, false}, 
-            {"Top Altar Piece", false, false, false}, 
-            {"Top Right Altar Piece", false, false, false}, 
-            {"Bottom Left Altar Piece", false, false, false},
-            {"Bottom Altar Piece", false, false, false}, 
-            {"Bottom Right Altar Piece", false, false, false}
-    };
 };
 
 struct Props
 {
-    Props(const std::vector<std::vector<Prop>>& Under, const std::vector<std::vector<Prop>>& Over);
+    // both groups keep the allocator they were built with, so an area's props stay in its arena
+    Props(std::pmr::vector<std::pmr::vector<Prop>>&& Under, std::pmr::vector<std::pmr::vector<Prop>>&& Over);
+
+    std::pmr::vector<std::pmr::vector<Prop>> Under{};
+    std::pmr::vector<std::pmr::vector<Prop>> Over{};
 
-    std::vector<std::vector<Prop>> Under{};
-    std::vector<std::vector<Prop>> Over{};
+    static constexpr size_t GrassGroup{4};      // grass moved to the Scene but is still drawn before this group
 };
 
 #endif // PROP_HPP
\ No newline at end of file
@@ -1,17 +1,30 @@
 #ifndef RANDOMIZER_HPP
 #define RANDOMIZER_HPP
 
-#include <random>
+#include <cstdint>
 
+// SplitMix64 generator: eight bytes of state and a handful of multiplies per draw. Split hands
+// out an independent child stream, so every entity can roll on its own generator and the whole
+// world still replays exactly from the one seed it started with.
 class Randomizer
 {
 public:
-    Randomizer() = default;
-    
-    int Randomize(std::uniform_int_distribution<int>& Range);
+    explicit Randomizer(const uint64_t Seed = 0) : State{Seed} {}
+
+    uint64_t Next()
+    {
+        uint64_t Mixed{State += Gamma};
+        Mixed = (Mixed ^ (Mixed >> 30)) * 0xBF58476D1CE4E5B9u;
+        Mixed = (Mixed ^ (Mixed >> 27)) * 0x94D049BB133111EBu;
+        return Mixed ^ (Mixed >> 31);
+    }
+
+    Randomizer Split() {return Randomizer{Next()};}
+    int Randomize(const int Min, const int Max);
+
 private:
-    std::random_device Seed;
-    std::mt19937 RandomEngine{std::mt19937{Seed()}};
+    static constexpr uint64_t Gamma{0x9E3779B97F4A7C15u};
+    uint64_t State{};
 };
 
-#endif // RANDOMIZER_HPP
\ No newline at end of file
+#endif // RANDOMIZER_HPP
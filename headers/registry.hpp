@@ -0,0 +1,173 @@
+#ifndef REGISTRY_HPP
+#define REGISTRY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <tuple>
+#include <utility>
+
+// Handle to an entity, the generation catches handles that outlived their entity
+struct Entity
+{
+    std::uint32_t Index{};
+    std::uint32_t Generation{};
+
+    constexpr bool operator==(const Entity&) const = default;
+};
+
+// Sparse set: components stay packed in Dense for iteration, Sparse maps an entity index to its dense slot.
+// All three arrays allocate from Memory, so a pool built for an area lives in that area's arena.
+template <typename T>
+class Pool
+{
+public:
+    explicit Pool(std::pmr::memory_resource* Memory = std::pmr::get_default_resource())
+        : Dense{Memory}, Owners{Memory}, Sparse{Memory} {}
+
+    // an owner only ever has one slot, emplacing again replaces the component in place
+    template <typename... Args>
+    T& Emplace(const Entity Owner, Args&&... Arguments)
+    {
+        if (Has(Owner)) {
+            T& Existing{Get(Owner)};
+            Existing = T{std::forward<Args>(Arguments)...};
+            return Existing;
+        }
+
+        if (Owner.Index >= Sparse.size()) {
+            Sparse.resize(Owner.Index + 1, Empty);
+        }
+
+        Sparse[Owner.Index] = static_cast<std::uint32_t>(Dense.size());
+        Owners.emplace_back(Owner);
+        return Dense.emplace_back(T{std::forward<Args>(Arguments)...});
+    }
+
+    // swap the last component into the hole so Dense stays packed
+    void Remove(const Entity Owner)
+    {
+        if (!Has(Owner)) {
+            return;
+        }
+
+        std::uint32_t Slot{Sparse[Owner.Index]};
+        Dense[Slot] = std::move(Dense.back());
+        Owners[Slot] = Owners.back();
+        Sparse[Owners[Slot].Index] = Slot;
+
+        Dense.pop_back();
+        Owners.pop_back();
+        Sparse[Owner.Index] = Empty;
+    }
+
+    bool Has(const Entity Owner) const
+    {
+        return Owner.Index < Sparse.size() && Sparse[Owner.Index] != Empty && Owners[Sparse[Owner.Index]] == Owner;
+    }
+
+    T& Get(const Entity Owner) {return Dense[Sparse[Owner.Index]];}
+    const T& Get(const Entity Owner) const {return Dense[Sparse[Owner.Index]];}
+    T* Find(const Entity Owner) {return Has(Owner) ? &Get(Owner) : nullptr;}
+
+    size_t Size() const {return Dense.size();}
+    void Reserve(const size_t Count) {Dense.reserve(Count); Owners.reserve(Count);}
+    void ReserveIndices(const size_t Count) {Sparse.reserve(Count);}
+
+    std::pmr::vector<T>& Data() {return Dense;}
+    const std::pmr::vector<Entity>& Entities() const {return Owners;}
+
+private:
+    static constexpr std::uint32_t Empty{std::numeric_limits<std::uint32_t>::max()};
+
+    std::pmr::vector<T> Dense;
+    std::pmr::vector<Entity> Owners;
+    std::pmr::vector<std::uint32_t> Sparse;
+};
+
+// Owns every entity and one pool per component type, the component list is fixed at compile time
+template <typename... Components>
+class Registry
+{
+public:
+    explicit Registry(std::pmr::memory_resource* Memory = std::pmr::get_default_resource())
+        : Pools{Pool<Components>{Memory}...}, Generations{Memory}, FreeIndices{Memory} {}
+
+    Entity Create()
+    {
+        if (!FreeIndices.empty()) {
+            std::uint32_t Index{FreeIndices.back()};
+            FreeIndices.pop_back();
+            return Entity{Index, Generations[Index]};
+        }
+
+        Generations.emplace_back(0);
+        return Entity{static_cast<std::uint32_t>(Generations.size() - 1), 0};
+    }
+
+    // drops every component, old handles stop being Valid once the generation moves on
+    void Destroy(const Entity Handle)
+    {
+        if (!Valid(Handle)) {
+            return;
+        }
+
+        (std::get<Pool<Components>>(Pools).Remove(Handle), ...);
+        ++Generations[Handle.Index];
+        FreeIndices.emplace_back(Handle.Index);
+    }
+
+    bool Valid(const Entity Handle) const
+    {
+        return Handle.Index < Generations.size() && Generations[Handle.Index] == Handle.Generation;
+    }
+
+    template <typename T, typename... Args>
+    T& Emplace(const Entity Handle, Args&&... Arguments) {return Storage<T>().Emplace(Handle, std::forward<Args>(Arguments)...);}
+
+    template <typename T>
+    T& Get(const Entity Handle) {return Storage<T>().Get(Handle);}
+
+    template <typename T>
+    bool Has(const Entity Handle) const {return std::get<Pool<T>>(Pools).Has(Handle);}
+
+    template <typename T>
+    void Remove(const Entity Handle) {Storage<T>().Remove(Handle);}
+
+    template <typename T>
+    Pool<T>& Storage() {return std::get<Pool<T>>(Pools);}
+
+    // Calls Function(Entity, First&, Rest&...) for every entity that has all of the components.
+    // The walk is driven by First's pool, so list the rarest component first. Do not add or
+    // remove First components from inside Function.
+    template <typename First, typename... Rest, typename Function>
+    void Each(Function&& Fn)
+    {
+        Pool<First>& Driver{Storage<First>()};
+        std::pmr::vector<First>& Dense{Driver.Data()};
+        const std::pmr::vector<Entity>& Owners{Driver.Entities()};
+
+        for (size_t i{}; i < Dense.size(); ++i) {
+            const Entity Handle{Owners[i]};
+            if ((Storage<Rest>().Has(Handle) && ...)) {
+                Fn(Handle, Dense[i], Storage<Rest>().Get(Handle)...);
+            }
+        }
+    }
+
+    size_t Alive() const {return Generations.size() - FreeIndices.size();}
+    // room for Count entities, every pool's sparse index grows with the entity count
+    void Reserve(const size_t Count)
+    {
+        Generations.reserve(Count);
+        (std::get<Pool<Components>>(Pools).ReserveIndices(Count), ...);
+    }
+
+private:
+    std::tuple<Pool<Components>...> Pools;
+    std::pmr::vector<std::uint32_t> Generations;
+    std::pmr::vector<std::uint32_t> FreeIndices;
+};
+
+#endif // REGISTRY_HPP
@@ -0,0 +1,69 @@
+#ifndef RESIDENCY_HPP
+#define RESIDENCY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <span>
+#include <vector>
+#include <raylib.h>
+#include "assetregistry.hpp"
+
+// Keeps GPU textures inside a memory budget. Every TextureID has a slot here, and Handle gives
+// out stand-ins with the real size but an id naming that slot, so they can be copied freely.
+// Use swaps in the uploaded texture, loading it if it was never drawn or has been evicted,
+// and the least recently drawn textures are unloaded whenever a load would go over budget.
+class TextureResidency
+{
+public:
+    explicit TextureResidency(const size_t Budget = DefaultBudget);
+    ~TextureResidency();
+    TextureResidency(const TextureResidency&) = delete;
+    TextureResidency(TextureResidency&&) = default;
+    TextureResidency& operator=(const TextureResidency&) = delete;
+    TextureResidency& operator=(TextureResidency&&) = default;
+
+    Texture2D Handle(const TextureID ID) const;
+    Texture2D Use(const Texture2D& Handle);
+    void Preload(std::span<const TextureID> IDs);
+    void Prefetch(std::span<const Texture2D> Handles);
+    bool Settle();
+    void NextFrame() {++Frame;}
+    void SetBudget(const size_t Bytes);
+    size_t GetResidentBytes() const {return ResidentBytes;}
+
+    static constexpr size_t DefaultBudget{32u << 20};
+    static constexpr unsigned int FirstHandle{0x40000000};     // far above any id the driver hands out
+
+private:
+    struct Slot
+    {
+        Texture2D Resident{};
+        size_t Bytes{};
+        uint64_t LastUse{};
+        bool Missing{false};
+    };
+
+    struct Decoded
+    {
+        size_t Index{};
+        Image Pixels{};
+        bool Owned{false};
+    };
+
+    static std::vector<Decoded> Decode(const std::vector<size_t> Indices);
+    std::vector<size_t> Wanted(std::span<const size_t> Indices) const;
+    void Upload(std::vector<Decoded>&& Images);
+    void Load(const size_t Index);
+    void Upload(const size_t Index, const Image& Pixels);
+    void Evict(Slot& Entry);
+    void MakeRoom(const size_t Bytes);
+
+    std::vector<Slot> Slots{};      // indexed by TextureID
+    size_t Budget{};
+    size_t ResidentBytes{};
+    uint64_t Frame{1};
+    std::future<std::vector<Decoded>> Pending{};    // a Prefetch still decoding
+};
+
+#endif // RESIDENCY_HPP
@@ -0,0 +1,104 @@
+#ifndef SCENE_HPP
+#define SCENE_HPP
+
+#include <array>
+#include "registry.hpp"
+#include "character.hpp"
+
+// Which pass an entity is drawn in, relative to the fox
+enum class DrawLayer
+{
+    UNDER, OVER
+};
+
+struct Position
+{
+    Vector2 World{};
+};
+
+struct Appearance
+{
+    Sprite Object{};
+    float Scale{4.f};
+    DrawLayer Layer{};
+};
+
+// Collision box as a fraction of the whole texture, same as Prop::GetCollisionRec
+struct Hitbox
+{
+    float X{};
+    float Y{};
+    float Width{1.f};
+    float Height{1.f};
+};
+
+// Grass that sways while something walks through it
+struct Sway
+{
+    bool Active{false};
+};
+
+// Which of a critter's sheets is showing
+enum class NPC 
+{
+    IDLE, IDLETWO, WALK, MISC, SLEEP
+};
+
+// Fox family, squirrels and crows, animated through the shared Animator and facing left or right
+struct Critter
+{
+    std::array<Sprite, 5> Sprites{};        // indexed by NPC
+    std::array<int, 5> Clips{Animator::NoClips<5>()};
+    const EnemyArchetype* Archetype{};
+    float Scale{3.2f};
+    NPC Current{NPC::IDLE};
+    int PlayingClip{Animator::NoClip};
+    Vector2 ScreenPos{};
+    Vector2 PrevWorldPos{};
+    Direction Face{Direction::DOWN};
+    bool Visible{false};                    // set while drawing, ticks only run for critters on screen
+    bool Flying{false};                     // crows are never blocked and never trample grass
+};
+
+// Idle wandering, each critter rolls its next action from its own stream
+struct Wander
+{
+    Randomizer Random{};
+    Vector2 Step{0.6f, 0.6f};
+    Vector2 Travelled{};
+    Vector2 Range{};
+    float ActionTime{};
+    float IdleTime{};
+    int ActionState{};
+    bool Walking{false};
+    bool IdleTwo{false};
+    bool Misc{false};
+    bool Sleeping{false};
+};
+
+using Scene = Registry<Position, Appearance, Hitbox, Sway, Critter, Wander>;
+
+namespace Systems
+{
+    Entity SpawnGrass(Scene& Scenery, const SpriteSheet& Sheet, const Vector2 WorldPos, const DrawLayer Layer);
+    // SceneBytes is what ReserveScene asks the scene's memory for, so an arena sized with it
+    // holds the whole scene in one block
+    size_t SceneBytes(const size_t Grass, const size_t Critters);
+    void ReserveScene(Scene& Scenery, const size_t Grass, const size_t Critters);
+    Entity SpawnCritter(Scene& Scenery, const std::array<Sprite, 5>& Sprites, const EnemyType Race, const Vector2 WorldPos, const float Scale, Animator& Animations, const Randomizer Random);
+
+    bool WithinScreen(const Position& Where, const Appearance& Look, const Vector2 CharacterWorldPos);
+    Rectangle GetHitbox(const Position& Where, const Appearance& Look, const Hitbox& Box, const Vector2 CharacterWorldPos);
+    bool WithinScreen(const Position& Where, const Critter& Animal, const Vector2 CharacterWorldPos);
+    Rectangle GetHitbox(const Critter& Animal);
+
+    void Roam(Scene& Scenery, Props& Props, std::pmr::vector<Prop>& Trees, std::pmr::vector<Enemy>& Enemies, Background& World, Animator& Animations, const Vector2 CharacterWorldPos);
+    void Trample(Scene& Scenery, Character& Fox, std::pmr::vector<Enemy>& Enemies);
+    void Draw(Scene& Scenery, const GameTexture& Textures, const DrawLayer Layer, const Vector2 CharacterWorldPos);
+    void DrawCritters(Scene& Scenery, const GameTexture& Textures, const Animator& Animations, const bool Flying, const Vector2 CharacterWorldPos);
+    void CollectTextures(Scene& Scenery, std::vector<Texture2D>& Into);
+    void DrawHitboxes(Scene& Scenery, const DrawLayer Layer, const Vector2 CharacterWorldPos, const Color RecColor);
+    void DrawCritterHitboxes(Scene& Scenery, const bool Flying, const Color RecColor);
+}
+
+#endif // SCENE_HPP
@@ -0,0 +1,91 @@
+#ifndef SPAWN_HPP
+#define SPAWN_HPP
+
+#include <array>
+#include <cstddef>
+#include "prop.hpp"
+#include "archetype.hpp"
+#include "spritesheet.hpp"
+
+// Compact description of a still prop. Game::SpawnProps turns a table of these into Props,
+// the optional fields default the same way the inanimate Prop constructor does.
+struct PropSpawn
+{
+    TextureID Texture{};
+    Vector2 WorldPos{};
+    PropType Type{};
+    float Scale{4.f};
+    bool Moveable{false};
+    bool Interactable{false};
+    bool Invisible{false};
+};
+
+// Compact description of a creature. Wildlife (Type NPC) only uses the first five sheets.
+struct EnemySpawn
+{
+    std::array<SheetID, 6> Sheets{};
+    EnemyType Race{};
+    EnemyType Type{};
+    Vector2 WorldPos{};
+    float Scale{3.2f};
+    int Health{3};
+    EnemyType BossSpawner{EnemyType::DEFAULT};
+};
+
+namespace Placement
+{
+    // the forest map is drawn at Background's scale of 4
+    constexpr float MapWidth{GetAsset(TextureID::MapsCodexMap).Width * 4.f};
+    constexpr float MapHeight{GetAsset(TextureID::MapsCodexMap).Height * 4.f};
+
+    constexpr bool OnMap(const Vector2 WorldPos)
+    {
+        return WorldPos.x >= 0.f && WorldPos.x <= MapWidth && WorldPos.y >= 0.f && WorldPos.y <= MapHeight;
+    }
+
+    constexpr bool InRange(const SheetID ID, const SheetID First, const SheetID Last)
+    {
+        return static_cast<size_t>(ID) >= static_cast<size_t>(First) && static_cast<size_t>(ID) <= static_cast<size_t>(Last);
+    }
+
+    // chests, NPCs and altar pieces need an item or a name, so they are built by hand
+    template <typename Table>
+    constexpr bool Props(const Table& Spawns)
+    {
+        for (const PropSpawn& Spawn:Spawns) {
+            if (Spawn.Texture >= TextureID::COUNT || Spawn.Scale <= 0.f || !OnMap(Spawn.WorldPos) ||
+                Spawn.Type == PropType::TREASURE || Spawn.Type == PropType::BIGTREASURE || Spawn.Type == PropType::ANIMATEDALTAR ||
+                Spawn.Type == PropType::NPC_DIANA || Spawn.Type == PropType::NPC_JADE || Spawn.Type == PropType::NPC_SON || Spawn.Type == PropType::NPC_RUMBY)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // monsters need monster sheets with a row per facing, wildlife a left and a right row
+    template <typename Table>
+    constexpr bool Enemies(const Table& Spawns)
+    {
+        for (const EnemySpawn& Spawn:Spawns) {
+            if (Spawn.Scale <= 0.f || !OnMap(Spawn.WorldPos)) {
+                return false;
+            }
+
+            const bool Wildlife{Spawn.Type == EnemyType::NPC};
+            const SheetID First{Wildlife ? SheetID::FoxFamilyIdle : SheetID::BearBrownIdle};
+            const SheetID Last{Wildlife ? SheetID::CrowWalk : SheetID::NecromancerRedProjectile};
+            for (size_t i{}; i < 5; ++i) {
+                if (!InRange(Spawn.Sheets[i], First, Last)) {
+                    return false;
+                }
+            }
+            if (!Wildlife && (Spawn.Health <= 0 || (Spawn.Sheets[5] != SheetID::Placeholder && !InRange(Spawn.Sheets[5], First, Last)))) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+#endif // SPAWN_HPP
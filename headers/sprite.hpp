@@ -1,24 +1,26 @@
 #ifndef SPRITE_HPP
 #define SPRITE_HPP
 
-#include <raylib.h>
+#include <cstdint>
+#include <type_traits>
+#include "spritesheet.hpp"
 
 struct Sprite
 {
     Sprite() = default;
-    explicit Sprite(const Texture2D& Texture, const int MaxFramesX = 1, const int MaxFramesY = 1, const float UpdateSpeed = 1.f/8.f);
+    explicit Sprite(const SpriteSheet& Sheet);
     void Tick(float DeltaTime);
-    Rectangle GetSourceRec();
-    Rectangle GetPosRec(const Vector2& ScreenPos, const float Scale);
+    const Rectangle& GetSourceRec() const {return Sheet->GetFrame(FrameX, FrameY);}
+    const Rectangle& GetSourceRec(const int Frame) const {return Sheet->GetFrame(Frame, FrameY);}
+    Rectangle GetPosRec(const Vector2& ScreenPos, const float Scale) const;
 
-    const Texture2D Texture{};
-    int MaxFramesX{};
-    int MaxFramesY{};
-    int FrameX{};
-    int FrameY{};
-    int PreviousFrame{};
-    float UpdateTime{1.f/8.f};
+    // frame data is shared through the sheet, an instance only carries its animation state
+    const SpriteSheet* Sheet{};
     float RunningTime{};
+    std::uint8_t FrameX{};
+    std::uint8_t FrameY{};
 };
 
-#endif // SPRITE_HPP
\ No newline at end of file
+static_assert(std::is_trivially_copyable_v<Sprite>, "Sprite should stay a handle plus a few bytes of state");
+
+#endif // SPRITE_HPP
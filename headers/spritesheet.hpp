@@ -0,0 +1,261 @@
+#ifndef SPRITESHEET_HPP
+#define SPRITESHEET_HPP
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+#include "gametextures.hpp"
+
+// Every animated sprite sheet in the game
+enum class SheetID
+{
+    // Fox
+    FoxIdle, FoxWalk, FoxRun, FoxMelee, FoxHit, FoxDie, FoxPush, FoxItemGot, FoxSleeping,
+    PauseFoxMelee,
+    // Monsters
+    BearBrownIdle, BearBrownWalk, BearBrownAttack, BearBrownHurt, BearBrownDeath,
+    BearLightBrownIdle, BearLightBrownWalk, BearLightBrownAttack, BearLightBrownHurt, BearLightBrownDeath,
+    ToadGreenIdle, ToadGreenWalk, ToadGreenAttack, ToadGreenHurt, ToadGreenDeath,
+    ToadPinkIdle, ToadPinkWalk, ToadPinkAttack, ToadPinkHurt, ToadPinkDeath,
+    MushroomRedIdle, MushroomRedWalk, MushroomRedAttack, MushroomRedHurt, MushroomRedDeath,
+    MushroomBrownIdle, MushroomBrownWalk, MushroomBrownAttack, MushroomBrownHurt, MushroomBrownDeath,
+    MushroomBlueIdle, MushroomBlueWalk, MushroomBlueAttack, MushroomBlueHurt, MushroomBlueDeath,
+    MushroomGreenIdle, MushroomGreenWalk, MushroomGreenAttack, MushroomGreenHurt, MushroomGreenDeath,
+    SpiderBrownIdle, SpiderBrownWalk, SpiderBrownAttack, SpiderBrownHurt, SpiderBrownDeath,
+    SpiderRedIdle, SpiderRedWalk, SpiderRedAttack, SpiderRedHurt, SpiderRedDeath,
+    SpiderBlackIdle, SpiderBlackWalk, SpiderBlackAttack, SpiderBlackHurt, SpiderBlackDeath,
+    ShadowYellowIdle, ShadowYellowWalk, ShadowYellowAttack, ShadowYellowHurt, ShadowYellowDeath,
+    ShadowTealIdle, ShadowTealWalk, ShadowTealAttack, ShadowTealHurt, ShadowTealDeath,
+    ImpRedIdle, ImpRedWalk, ImpRedAttack, ImpRedHurt, ImpRedDeath, ImpRedProjectile,
+    CreatureOrangeIdle, CreatureOrangeWalk, CreatureOrangeAttack, CreatureOrangeHurt, CreatureOrangeDeath,
+    BeholderBlackIdle, BeholderBlackWalk, BeholderBlackAttack, BeholderBlackHurt, BeholderBlackDeath, BeholderBlackProjectile,
+    NecromancerRedIdle, NecromancerRedWalk, NecromancerRedAttack, NecromancerRedHurt, NecromancerRedDeath, NecromancerRedProjectile,
+    // Wildlife
+    FoxFamilyIdle, FoxFamilyIdleTwo, FoxFamilyWalk, FoxFamilyLazy, FoxFamilySleep,
+    SquirrelIdle, SquirrelIdleTwo, SquirrelWalk, SquirrelEat,
+    CrowIdle, CrowIdleTwo, CrowFlying, CrowWalk,
+    // Props
+    GrassAnimation, TreasureChestBig, TreasureChest,
+    Didi, Jade, Son, Rumby,
+    AltarTopLeftAnimated, AltarTopAnimated, AltarTopRightAnimated,
+    AltarBotLeftAnimated, AltarBotAnimated, AltarBotRightAnimated,
+    Placeholder,
+    COUNT
+};
+
+struct SheetLayout
+{
+    SheetID ID{};
+    const Texture2D GameTexture::* Texture{};
+    int FramesX{1};
+    int FramesY{1};
+    float UpdateTime{1.f/8.f};
+};
+
+// Frame layout of each sheet, declared once and indexed by SheetID
+inline constexpr std::array<SheetLayout, static_cast<size_t>(SheetID::COUNT)> SheetLayouts
+{{
+    // Fox
+    {SheetID::FoxIdle, &GameTexture::FoxIdle, 4, 4},
+    {SheetID::FoxWalk, &GameTexture::FoxWalk, 4, 4},
+    {SheetID::FoxRun, &GameTexture::FoxRun, 4, 4},
+    {SheetID::FoxMelee, &GameTexture::FoxMelee, 4, 4},
+    {SheetID::FoxHit, &GameTexture::FoxHit, 2, 4},
+    {SheetID::FoxDie, &GameTexture::FoxDie, 1, 4},
+    {SheetID::FoxPush, &GameTexture::FoxPush, 4, 4},
+    {SheetID::FoxItemGot, &GameTexture::FoxItemGot, 1, 4},
+    {SheetID::FoxSleeping, &GameTexture::FoxSleeping, 4, 1},
+    {SheetID::PauseFoxMelee, &GameTexture::FoxMelee, 4, 1},
+    // Monsters
+    {SheetID::BearBrownIdle, &GameTexture::BearBrownIdle, 4, 4},
+    {SheetID::BearBrownWalk, &GameTexture::BearBrownWalk, 4, 4},
+    {SheetID::BearBrownAttack, &GameTexture::BearBrownAttack, 4, 4},
+    {SheetID::BearBrownHurt, &GameTexture::BearBrownHurt, 1, 4},
+    {SheetID::BearBrownDeath, &GameTexture::BearBrownDeath, 11, 4},
+    {SheetID::BearLightBrownIdle, &GameTexture::BearLightBrownIdle, 4, 4},
+    {SheetID::BearLightBrownWalk, &GameTexture::BearLightBrownWalk, 4, 4},
+    {SheetID::BearLightBrownAttack, &GameTexture::BearLightBrownAttack, 4, 4},
+    {SheetID::BearLightBrownHurt, &GameTexture::BearLightBrownHurt, 1, 4},
+    {SheetID::BearLightBrownDeath, &GameTexture::BearLightBrownDeath, 11, 4},
+    {SheetID::ToadGreenIdle, &GameTexture::ToadGreenIdle, 4, 4},
+    {SheetID::ToadGreenWalk, &GameTexture::ToadGreenWalk, 4, 4},
+    {SheetID::ToadGreenAttack, &GameTexture::ToadGreenAttack, 4, 4},
+    {SheetID::ToadGreenHurt, &GameTexture::ToadGreenHurt, 1, 4},
+    {SheetID::ToadGreenDeath, &GameTexture::ToadGreenDeath, 11, 4},
+    {SheetID::ToadPinkIdle, &GameTexture::ToadPinkIdle, 4, 4},
+    {SheetID::ToadPinkWalk, &GameTexture::ToadPinkWalk, 4, 4},
+    {SheetID::ToadPinkAttack, &GameTexture::ToadPinkAttack, 4, 4},
+    {SheetID::ToadPinkHurt, &GameTexture::ToadPinkHurt, 1, 4},
+    {SheetID::ToadPinkDeath, &GameTexture::ToadPinkDeath, 11, 4},
+    {SheetID::MushroomRedIdle, &GameTexture::MushroomRedIdle, 4, 4},
+    {SheetID::MushroomRedWalk, &GameTexture::MushroomRedWalk, 4, 4},
+    {SheetID::MushroomRedAttack, &GameTexture::MushroomRedAttack, 4, 4},
+    {SheetID::MushroomRedHurt, &GameTexture::MushroomRedHurt, 4, 4},
+    {SheetID::MushroomRedDeath, &GameTexture::MushroomRedDeath, 11, 4},
+    {SheetID::MushroomBrownIdle, &GameTexture::MushroomBrownIdle, 4, 4},
+    {SheetID::MushroomBrownWalk, &GameTexture::MushroomBrownWalk, 4, 4},
+    {SheetID::MushroomBrownAttack, &GameTexture::MushroomBrownAttack, 4, 4},
+    {SheetID::MushroomBrownHurt, &GameTexture::MushroomBrownHurt, 4, 4},
+    {SheetID::MushroomBrownDeath, &GameTexture::MushroomBrownDeath, 11, 4},
+    {SheetID::MushroomBlueIdle, &GameTexture::MushroomBlueIdle, 4, 4},
+    {SheetID::MushroomBlueWalk, &GameTexture::MushroomBlueWalk, 4, 4},
+    {SheetID::MushroomBlueAttack, &GameTexture::MushroomBlueAttack, 4, 4},
+    {SheetID::MushroomBlueHurt, &GameTexture::MushroomBlueHurt, 4, 4},
+    {SheetID::MushroomBlueDeath, &GameTexture::MushroomBlueDeath, 11, 4},
+    {SheetID::MushroomGreenIdle, &GameTexture::MushroomGreenIdle, 4, 4},
+    {SheetID::MushroomGreenWalk, &GameTexture::MushroomGreenWalk, 4, 4},
+    {SheetID::MushroomGreenAttack, &GameTexture::MushroomGreenAttack, 4, 4},
+    {SheetID::MushroomGreenHurt, &GameTexture::MushroomGreenHurt, 4, 4},
+    {SheetID::MushroomGreenDeath, &GameTexture::MushroomGreenDeath, 11, 4},
+    {SheetID::SpiderBrownIdle, &GameTexture::SpiderBrownIdle, 4, 4},
+    {SheetID::SpiderBrownWalk, &GameTexture::SpiderBrownWalk, 4, 4},
+    {SheetID::SpiderBrownAttack, &GameTexture::SpiderBrownAttack, 4, 4},
+    {SheetID::SpiderBrownHurt, &GameTexture::SpiderBrownHurt, 1, 4},
+    {SheetID::SpiderBrownDeath, &GameTexture::SpiderBrownDeath, 11, 4},
+    {SheetID::SpiderRedIdle, &GameTexture::SpiderRedIdle, 4, 4},
+    {SheetID::SpiderRedWalk, &GameTexture::SpiderRedWalk, 4, 4},
+    {SheetID::SpiderRedAttack, &GameTexture::SpiderRedAttack, 4, 4},
+    {SheetID::SpiderRedHurt, &GameTexture::SpiderRedHurt, 1, 4},
+    {SheetID::SpiderRedDeath, &GameTexture::SpiderRedDeath, 11, 4},
+    {SheetID::SpiderBlackIdle, &GameTexture::SpiderBlackIdle, 4, 4},
+    {SheetID::SpiderBlackWalk, &GameTexture::SpiderBlackWalk, 4, 4},
+    {SheetID::SpiderBlackAttack, &GameTexture::SpiderBlackAttack, 4, 4},
+    {SheetID::SpiderBlackHurt, &GameTexture::SpiderBlackHurt, 1, 4},
+    {SheetID::SpiderBlackDeath, &GameTexture::SpiderBlackDeath, 11, 4},
+    {SheetID::ShadowYellowIdle, &GameTexture::ShadowYellowIdle, 4, 4},
+    {SheetID::ShadowYellowWalk, &GameTexture::ShadowYellowWalk, 4, 4},
+    {SheetID::ShadowYellowAttack, &GameTexture::ShadowYellowAttack, 4, 4},
+    {SheetID::ShadowYellowHurt, &GameTexture::ShadowYellowHurt, 1, 4},
+    {SheetID::ShadowYellowDeath, &GameTexture::ShadowYellowDeath, 11, 4},
+    {SheetID::ShadowTealIdle, &GameTexture::ShadowTealIdle, 4, 4},
+    {SheetID::ShadowTealWalk, &GameTexture::ShadowTealWalk, 4, 4},
+    {SheetID::ShadowTealAttack, &GameTexture::ShadowTealAttack, 4, 4},
+    {SheetID::ShadowTealHurt, &GameTexture::ShadowTealHurt, 1, 4},
+    {SheetID::ShadowTealDeath, &GameTexture::ShadowTealDeath, 11, 4},
+    {SheetID::ImpRedIdle, &GameTexture::ImpRedIdle, 4, 4},
+    {SheetID::ImpRedWalk, &GameTexture::ImpRedWalk, 4, 4},
+    {SheetID::ImpRedAttack, &GameTexture::ImpRedAttack, 4, 4},
+    {SheetID::ImpRedHurt, &GameTexture::ImpRedHurt, 1, 4},
+    {SheetID::ImpRedDeath, &GameTexture::ImpRedDeath, 11, 4},
+    {SheetID::ImpRedProjectile, &GameTexture::ImpRedProjectile, 4, 4},
+    {SheetID::CreatureOrangeIdle, &GameTexture::CreatureOrangeIdle, 4, 4},
+    {SheetID::CreatureOrangeWalk, &GameTexture::CreatureOrangeWalk, 4, 4},
+    {SheetID::CreatureOrangeAttack, &GameTexture::CreatureOrangeAttack, 4, 4},
+    {SheetID::CreatureOrangeHurt, &GameTexture::CreatureOrangeHurt, 1, 4},
+    {SheetID::CreatureOrangeDeath, &GameTexture::CreatureOrangeDeath, 11, 4},
+    {SheetID::BeholderBlackIdle, &GameTexture::BeholderBlackIdle, 4, 4},
+    {SheetID::BeholderBlackWalk, &GameTexture::BeholderBlackWalk, 4, 4},
+    {SheetID::BeholderBlackAttack, &GameTexture::BeholderBlackAttack, 4, 4},
+    {SheetID::BeholderBlackHurt, &GameTexture::BeholderBlackHurt, 4, 4},
+    {SheetID::BeholderBlackDeath, &GameTexture::BeholderBlackDeath, 11, 4},
+    {SheetID::BeholderBlackProjectile, &GameTexture::BeholderBlackProjectile, 4, 4},
+    {SheetID::NecromancerRedIdle, &GameTexture::NecromancerRedIdle, 4, 4},
+    {SheetID::NecromancerRedWalk, &GameTexture::NecromancerRedWalk, 4, 4},
+    {SheetID::NecromancerRedAttack, &GameTexture::NecromancerRedAttack, 4, 4},
+    {SheetID::NecromancerRedHurt, &GameTexture::NecromancerRedHurt, 1, 4},
+    {SheetID::NecromancerRedDeath, &GameTexture::NecromancerRedDeath, 11, 4},
+    {SheetID::NecromancerRedProjectile, &GameTexture::NecromancerRedProjectile, 4, 4},
+    // Wildlife
+    {SheetID::FoxFamilyIdle, &GameTexture::FoxFamilyIdle, 5, 2},
+    {SheetID::FoxFamilyIdleTwo, &GameTexture::FoxFamilyIdleTwo, 14, 2},
+    {SheetID::FoxFamilyWalk, &GameTexture::FoxFamilyWalk, 8, 2},
+    {SheetID::FoxFamilyLazy, &GameTexture::FoxFamilyLazy, 13, 2},
+    {SheetID::FoxFamilySleep, &GameTexture::FoxFamilySleep, 6, 2},
+    {SheetID::SquirrelIdle, &GameTexture::SquirrelIdle, 6, 2},
+    {SheetID::SquirrelIdleTwo, &GameTexture::SquirrelIdleTwo, 6, 2},
+    {SheetID::SquirrelWalk, &GameTexture::SquirrelWalk, 4, 2},
+    {SheetID::SquirrelEat, &GameTexture::SquirrelEat, 2, 2},
+    {SheetID::CrowIdle, &GameTexture::CrowIdle, 8, 2},
+    {SheetID::CrowIdleTwo, &GameTexture::CrowIdleTwo, 5, 2},
+    {SheetID::CrowFlying, &GameTexture::CrowFlying, 5, 2},
+    {SheetID::CrowWalk, &GameTexture::CrowWalk, 4, 2},
+    // Props
+    {SheetID::GrassAnimation, &GameTexture::GrassAnimation, 4, 1, 1.f/3.f},
+    {SheetID::TreasureChestBig, &GameTexture::TreasureChestBig, 4, 1, 1.f/4.f},
+    {SheetID::TreasureChest, &GameTexture::TreasureChest, 4, 1, 1.f/4.f},
+    {SheetID::Didi, &GameTexture::Didi, 4, 1, 1.f/8.f},
+    {SheetID::Jade, &GameTexture::Jade, 4, 1, 1.f/8.f},
+    {SheetID::Son, &GameTexture::Son, 4, 1, 1.f/8.f},
+    {SheetID::Rumby, &GameTexture::Rumby, 4, 1, 1.f/8.f},
+    {SheetID::AltarTopLeftAnimated, &GameTexture::AltarTopLeftAnimated, 14, 1, 1/14.f},
+    {SheetID::AltarTopAnimated, &GameTexture::AltarTopAnimated, 14, 1, 1/14.f},
+    {SheetID::AltarTopRightAnimated, &GameTexture::AltarTopRightAnimated, 14, 1, 1/14.f},
+    {SheetID::AltarBotLeftAnimated, &GameTexture::AltarBotLeftAnimated, 14, 1, 1/14.f},
+    {SheetID::AltarBotAnimated, &GameTexture::AltarBotAnimated, 14, 1, 1/14.f},
+    {SheetID::AltarBotRightAnimated, &GameTexture::AltarBotRightAnimated, 14, 1, 1/14.f},
+    {SheetID::Placeholder, &GameTexture::Placeholder, 1, 1}
+}};
+
+namespace Layout
+{
+    // table rows must line up with the SheetID enum
+    constexpr bool InOrder()
+    {
+        for (size_t i{}; i < SheetLayouts.size(); ++i) {
+            if (static_cast<size_t>(SheetLayouts[i].ID) != i) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    constexpr bool Valid()
+    {
+        for (const auto& Layout:SheetLayouts) {
+            if (Layout.Texture == nullptr || Layout.FramesX < 1 || Layout.FramesY < 1 || Layout.UpdateTime <= 0.f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // CheckDirection picks a row per facing, so every sheet in [First, Last] needs exactly Rows rows
+    constexpr bool Rows(const SheetID First, const SheetID Last, const int Rows)
+    {
+        for (auto i = static_cast<size_t>(First); i <= static_cast<size_t>(Last); ++i) {
+            if (SheetLayouts[i].FramesY != Rows) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+static_assert(Layout::InOrder(), "SheetLayouts rows are out of order with SheetID");
+static_assert(Layout::Valid(), "Sprite sheets need a texture, at least one frame and an update time");
+static_assert(Layout::Rows(SheetID::FoxIdle, SheetID::FoxItemGot, 4), "Fox sheets need one row per direction");
+static_assert(Layout::Rows(SheetID::BearBrownIdle, SheetID::NecromancerRedProjectile, 4), "Monster sheets need one row per direction");
+static_assert(Layout::Rows(SheetID::FoxFamilyIdle, SheetID::CrowWalk, 2), "Wildlife sheets need a left and a right row");
+
+// Sheet resolved against the loaded texture, with every frame's source rectangle precomputed
+struct SpriteSheet
+{
+    Texture2D Texture{};
+    int FramesX{1};
+    int FramesY{1};
+    float UpdateTime{1.f/8.f};
+    float FrameWidth{};
+    float FrameHeight{};
+    std::vector<Rectangle> Frames{};    // FramesX + 1 columns per row, Sprite::Tick runs one past the last frame
+
+    // facing rows wrap on single row sheets, same as the texture repeat the old source rects relied on
+    const Rectangle& GetFrame(const int FrameX, const int FrameY) const {return Frames[(FrameY % FramesY) * (FramesX + 1) + FrameX];}
+};
+
+class SpriteSheets
+{
+public:
+    explicit SpriteSheets(const GameTexture& Textures);
+
+    const SpriteSheet& operator[](const SheetID ID) const {return Sheets[static_cast<size_t>(ID)];}
+    const SpriteSheet& Still(const Texture2D& Texture);
+
+private:
+    std::array<SpriteSheet, static_cast<size_t>(SheetID::COUNT)> Sheets{};
+    std::unordered_map<unsigned int, SpriteSheet> Stills{};     // single frame sheets keyed by texture id
+    std::mutex StillsLock{};                                    // the world is built on several threads
+};
+
+#endif // SPRITESHEET_HPP
@@ -0,0 +1,85 @@
+#ifndef UI_HPP
+#define UI_HPP
+
+#include <vector>
+#include <string>
+#include "gametextures.hpp"
+
+// A single textured (or solid when Texture.id == 0) rectangle queued for the UI pass
+struct Quad
+{
+    Texture2D Texture{};
+    Rectangle Source{};
+    Rectangle Dest{};
+    Color Tint{WHITE};
+    int Layer{};
+};
+
+// Collects widgets' cached quads and draws them in batched passes, ordered by layer
+class UILayer
+{
+public:
+    UILayer() = default;
+
+    void Submit(const Quad& Item);
+    void Submit(const std::vector<Quad>& Items, const Vector2 Offset = Vector2{});
+    void Flush(const GameTexture& Textures);
+
+private:
+    std::vector<Quad> Queue{};
+};
+
+// Enemy HP bar, segments are only rebuilt when Health changes
+class HealthBar
+{
+public:
+    HealthBar() = default;
+
+    void Update(const GameTexture& GameTextures, const int Health, const int MaxHP);
+    void Draw(UILayer& Interface, const Vector2 Position) const;
+    constexpr float GetWidth() const {return Width;}
+
+private:
+    std::vector<Quad> Segments{};
+    int CachedHealth{-1};
+    int CachedMaxHP{-1};
+    float Scale{2.f};
+    float Width{};
+};
+
+struct MenuText
+{
+    std::string Text{};
+    int X{};
+    int Y{};
+    int FontSize{};
+};
+
+// Static menu screen, text is composed into a render texture once and the highlight is rebuilt on selection change
+class MenuPanel
+{
+public:
+    MenuPanel(const std::vector<MenuText>& Lines, const std::vector<Rectangle>& Options, const Color Highlight = Color{ 0, 238, 135, 100 });
+    ~MenuPanel();
+    MenuPanel(const MenuPanel&) = delete;
+    MenuPanel(MenuPanel&& Other) noexcept;
+    MenuPanel& operator=(const MenuPanel&) = delete;
+    MenuPanel& operator=(MenuPanel&&) = delete;
+
+    void Select(const int Option);
+    void Draw(UILayer& Interface);
+
+private:
+    void Compose();
+
+    std::vector<MenuText> Lines{};
+    std::vector<Rectangle> Options{};
+    RenderTexture2D Target{};
+    Rectangle Bounds{};
+    Quad Selection{};
+    Color Highlight{};
+    int Selected{-1};
+    bool Composed{false};
+};
+
+#endif // UI_HPP
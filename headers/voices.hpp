@@ -0,0 +1,146 @@
+#ifndef VOICES_HPP
+#define VOICES_HPP
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include <raylib.h>
+#include "assetregistry.hpp"
+#include "waveloader.hpp"
+#include "cuequeue.hpp"
+
+enum class Cue
+{
+    ALTARINSERT, BOSSDEATH, FOXATTACK, FOXATTACKTWO,
+    IMPACTHEAVY, IMPACTMEDIUM, MAPCHANGE, MONSTERATTACK,
+    MONSTERDEATH, MONSTERRANGEDATTACK, MOVECURSOR, NPCTALK,
+    PUSHING, SELECT, SLEEP, TRANSITION, TREASUREOPEN, WALKING
+};
+
+// Cues stay resident per group, COMMON ones for the whole session
+enum class CueGroup
+{
+    COMMON, FOREST, DUNGEON
+};
+
+struct CueInfo
+{
+    Cue ID{};
+    SoundID Sound{};
+    int Limit{1};               // voices this cue can have sounding at once
+    float Importance{1.f};      // higher wins when voices run out
+    CueGroup Group{CueGroup::COMMON};
+};
+
+inline constexpr std::array<CueInfo, static_cast<size_t>(Cue::WALKING) + 1> Cues
+{{
+    {Cue::ALTARINSERT, SoundID::AltarInsert, 1, 8.f, CueGroup::FOREST},
+    {Cue::BOSSDEATH, SoundID::BossDeath, 1, 9.f, CueGroup::COMMON},
+    {Cue::FOXATTACK, SoundID::Slash, 2, 7.f, CueGroup::COMMON},
+    {Cue::FOXATTACKTWO, SoundID::DoubleSlash, 1, 7.f, CueGroup::COMMON},
+    {Cue::IMPACTHEAVY, SoundID::ImpactHeavy, 3, 5.f, CueGroup::COMMON},
+    {Cue::IMPACTMEDIUM, SoundID::ImpactMedium, 2, 7.f, CueGroup::COMMON},
+    {Cue::MAPCHANGE, SoundID::MapChange, 1, 10.f, CueGroup::COMMON},
+    {Cue::MONSTERATTACK, SoundID::MonsterAttack, 3, 4.f, CueGroup::FOREST},
+    {Cue::MONSTERDEATH, SoundID::MonsterDeath, 3, 6.f, CueGroup::FOREST},
+    {Cue::MONSTERRANGEDATTACK, SoundID::MonsterRangedAttack, 3, 4.f, CueGroup::COMMON},
+    {Cue::MOVECURSOR, SoundID::MoveCursor, 1, 10.f, CueGroup::COMMON},
+    {Cue::NPCTALK, SoundID::NpcTalk, 2, 8.f, CueGroup::FOREST},
+    {Cue::PUSHING, SoundID::Push, 1, 3.f, CueGroup::FOREST},
+    {Cue::SELECT, SoundID::Select, 1, 10.f, CueGroup::COMMON},
+    {Cue::SLEEP, SoundID::MiniMap, 1, 8.f, CueGroup::COMMON},
+    {Cue::TRANSITION, SoundID::Transition, 1, 10.f, CueGroup::COMMON},
+    {Cue::TREASUREOPEN, SoundID::Treasure, 1, 8.f, CueGroup::FOREST},
+    {Cue::WALKING, SoundID::Footsteps, 4, 2.f, CueGroup::COMMON}
+}};
+
+namespace Mixing
+{
+    constexpr bool InOrder()
+    {
+        for (size_t i{}; i < Cues.size(); ++i) {
+            if (static_cast<size_t>(Cues[i].ID) != i) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    constexpr bool Decodable()
+    {
+        for (const auto& Info:Cues) {
+            if (GetAsset(Info.Sound).Frames == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+static_assert(Mixing::InOrder(), "Cues rows are out of order with Cue");
+static_assert(Mixing::Decodable(), "Cues need a WAV sound, streamed music cannot be loaded into voices");
+
+// Owns a fixed set of playback voices per cue. Every cue gets Limit copies of its sound so
+// instances never restart each other, and the whole mixer never has more than MaxVoices sounding.
+// When a cue or the mixer is full, the quietest claim loses: distant, unimportant voices are
+// stolen first and a new sound that ranks below everything playing is dropped.
+// Cues are decoded on a loader thread as their group is entered and released when it is left;
+// playing a cue that is not resident yet is simply dropped.
+// Positioned cues are panned and faded by their distance to the listener, and culled outright
+// past AudibleRadius before any voice is touched.
+// Play and PlayAt only queue the request, so they are safe from any thread and never touch the
+// audio device; Poll on the game thread drains the queue into voices once per frame.
+class Voices
+{
+public:
+    Voices();
+    ~Voices();
+    Voices(const Voices&) = delete;
+    Voices& operator=(const Voices&) = delete;
+
+    bool Play(const Cue Effect, const float Volume = 1.f) {return Requests.Push(CueEvent{Effect, Volume});}
+    bool PlayAt(const Cue Effect, const float Volume, const Vector2 Emitter) {return Requests.Push(CueEvent{Effect, Volume, Emitter, true});}
+    void SetListener(const Vector2 WorldPos) {Listener = WorldPos;}
+    void StopAll();
+    void Enter(const CueGroup Area);
+    void Poll();
+    bool IsReady(const Cue Effect) const {return !Pool[static_cast<size_t>(Effect)].empty();}
+    bool IsSettled() const;
+    int Sounding();
+
+    static constexpr int MaxVoices{12};
+    static constexpr float Falloff{200.f};         // distance at which a cue ranks at half its importance
+    static constexpr float AudibleRadius{700.f};   // roughly half the screen diagonal
+    static constexpr float PanWidth{640.f};        // horizontal distance that reaches the widest pan
+    static constexpr float MaxPan{0.35f};          // how far from centre a cue can be panned
+
+private:
+    enum class Residency
+    {
+        UNLOADED, LOADING, READY
+    };
+
+    struct Voice
+    {
+        Sound Instance{};
+        float Priority{};
+    };
+
+    bool Emit(const CueEvent& Event);
+    bool Start(const Cue Effect, const float Volume, const float Distance, const float Pan);
+    Voice* Claim(const Cue Effect, const float Priority);
+    Voice* Quietest(const float Priority);
+    bool Wanted(const size_t Index) const;
+    void Load(const size_t Index);
+    void Unload(const size_t Index);
+
+    std::array<std::vector<Voice>, Cues.size()> Pool{};
+    std::array<Residency, Cues.size()> State{};
+    CueGroup Current{CueGroup::COMMON};
+    std::vector<WaveLoader::Decoded> Arrived{};
+    CueQueue Requests{};
+    Vector2 Listener{};
+    WaveLoader Loader{};
+};
+
+#endif // VOICES_HPP
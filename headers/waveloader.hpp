@@ -0,0 +1,49 @@
+#ifndef WAVELOADER_HPP
+#define WAVELOADER_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <raylib.h>
+
+// Decodes audio files on a worker thread, or just looks them up when they are packed. Only the decode happens there; turning a Wave into
+// playable sounds touches the audio device and stays on the game thread, after Collect.
+class WaveLoader
+{
+public:
+    struct Decoded
+    {
+        size_t Key{};
+        Wave Samples{};
+        bool Owned{true};       // false when the samples live in the asset archive
+    };
+
+    WaveLoader();
+    ~WaveLoader();
+    WaveLoader(const WaveLoader&) = delete;
+    WaveLoader& operator=(const WaveLoader&) = delete;
+
+    void Request(const size_t Key, const char* Path);
+    void Collect(std::vector<Decoded>& Ready);
+
+private:
+    struct Job
+    {
+        size_t Key{};
+        const char* Path{};
+    };
+
+    void Run();
+
+    std::mutex Lock{};
+    std::condition_variable Wake{};
+    std::deque<Job> Pending{};
+    std::vector<Decoded> Finished{};
+    bool Quit{false};
+    std::thread Worker{};
+};
+
+#endif // WAVELOADER_HPP
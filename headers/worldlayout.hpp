@@ -0,0 +1,2731 @@
+#ifndef WORLDLAYOUT_HPP
+#define WORLDLAYOUT_HPP
+
+#include <array>
+#include <span>
+#include "spawn.hpp"
+
+// The static layout of the forest, held as read-only data. Game::SpawnProps and Game::SpawnEnemies
+// expand these tables at startup; props that carry an item or a name are still built in game.cpp.
+namespace World
+{
+    namespace Under
+    {
+        inline constexpr auto Placeholder{std::to_array<PropSpawn>({
+            {TextureID::PlaceholderPlaceholder, {0.f,0.f}, PropType::PLACEHOLDER, 4.f, false, true},
+        })};
+
+        inline constexpr auto DungeonEntrance{std::to_array<PropSpawn>({
+            {TextureID::PropsDungeonEntrance, {3520.f,60.f}, PropType::DUNGEONLEFT, 4.f},
+            {TextureID::PropsDungeonEntrance, {3520.f,60.f}, PropType::DUNGEONRIGHT, 4.f},
+            {TextureID::PropsDungeonEntrance, {3520.f,60.f}, PropType::DUNGEON, 4.f, false, true},
+        })};
+
+        inline constexpr auto Boulder{std::to_array<PropSpawn>({
+            {TextureID::PropsBoulder, {640.f,458.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {550.f,357.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {632.f,244.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {852.f,550.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {733.f,655.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {1748.f,556.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {655.f,1542.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {153.f,2145.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {930.f,2050.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {1138.f,2041.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {1053.f,1737.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {1430.f,2035.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {1639.f,2444.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {1655.f,2342.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {1735.f,2439.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {2234.f,1054.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {2136.f,1144.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {2055.f,1144.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {1150.f,1343.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {1544.f,945.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {1732.f,446.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {2636.f,650.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {2757.f,347.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {2935.f,244.f}, PropType::BOULDER},
+            {TextureID::PropsBoulder, {3056.f,543.f}, PropType::BOULDER},
+        })};
+
+        inline constexpr auto Bushes{std::to_array<PropSpawn>({
+            {TextureID::PropsBush, {383.f,1024.f}, PropType::BUSH},
+            {TextureID::PropsBush, {501.f,936.f}, PropType::BUSH},
+            {TextureID::PropsBush, {597.f,821.f}, PropType::BUSH},
+            {TextureID::PropsBush, {890.f,834.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1147.f,713.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1193.f,829.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1805.f,2534.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2659.f,718.f}, PropType::BUSH},
+            {TextureID::PropsBush, {655.f,2439.f}, PropType::BUSH},
+            {TextureID::PropsBush, {803.f,2122.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2090.f,1218.f}, PropType::BUSH},
+            {TextureID::PropsBush, {906.f,1934.f}, PropType::BUSH},
+            {TextureID::PropsBush, {906.f,2333.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1398.f,1934.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1584.f,641.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1405.f,2122.f}, PropType::BUSH},
+            {TextureID::PropsBush, {667.f,1625.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1286.f,1433.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2757.f,416.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1823.f,2120.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1823.f,2185.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2619.f,822.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2661.f,923.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2661.f,1026.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2661.f,1122.f}, PropType::BUSH},
+            {TextureID::PropsBush, {889.f,2222.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1063.f,1811.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3460.f,2100.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3460.f,2000.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3397.f,1700.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3397.f,1600.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3428.f,1500.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3397.f,1423.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3397.f,1313.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3397.f,1217.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3397.f,1117.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3397.f,1011.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3397.f,900.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3397.f,800.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3397.f,700.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3397.f,600.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2785.f,1827.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2758.f,1934.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2938.f,2022.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3125.f,2033.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3159.f,1422.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2657.f,1522.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2603.f,1634.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3767.f,2022.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3246.f,2234.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1770.f,734.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1594.f,334.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1465.f,222.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3152.f,1222.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2155.f,966.f}, PropType::BUSH, 3.f},
+            {TextureID::PropsBush, {2274.f,966.f}, PropType::BUSH, 3.f},
+            {TextureID::PropsBush, {2395.f,966.f}, PropType::BUSH, 3.f},
+            {TextureID::PropsBush, {2534.f,3525.f}, PropType::BUSH, 4.f},
+            {TextureID::PropsBush, {2749.f,3906.f}, PropType::BUSH, 3.f},
+            {TextureID::PropsBush, {2749.f,4006.f}, PropType::BUSH, 3.f},
+            {TextureID::PropsBush, {2550.f,3715.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3662.f,3956.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2655.f,3808.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1110.f,2116.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1839.f,2410.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1837.f,2309.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1861.f,2243.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2646.f,1811.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2974.f,1716.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2664.f,2308.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2686.f,2409.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3725.f,3811.f}, PropType::BUSH},
+            {TextureID::PropsBush, {884.f,208.f}, PropType::BUSH},
+            {TextureID::PropsBush, {795.f,338.f}, PropType::BUSH},
+            {TextureID::PropsBush, {491.f,434.f}, PropType::BUSH},
+            {TextureID::PropsBush, {577.f,643.f}, PropType::BUSH},
+            {TextureID::PropsBush, {567.f,544.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1593.f,538.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1599.f,438.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2728.f,618.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3394.f,531.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2894.f,325.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2754.f,527.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2789.f,2243.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2950.f,2144.f}, PropType::BUSH},
+            {TextureID::PropsBush, {441.f,310.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3212.f,209.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3366.f,423.f}, PropType::BUSH},
+            {TextureID::PropsBush, {3371.f,322.f}, PropType::BUSH},
+            {TextureID::PropsBush, {2538.f,3688.f}, PropType::BUSH, 3.f, false, false, true},
+            {TextureID::PropsBush, {2671.f,2500.f}, PropType::BUSH, 3.f, false, false, true},
+            {TextureID::PropsBush, {2740.f,2572.f}, PropType::BUSH, 3.f, false, false, true},
+            {TextureID::PropsBush, {2941.f,2629.f}, PropType::BUSH, 3.f, false, false, true},
+            {TextureID::PropsBush, {3544.f,2629.f}, PropType::BUSH, 3.f, false, false, true},
+            {TextureID::PropsBush, {3383.f,3505.f}, PropType::BUSH, 3.f, false, false, true},
+            {TextureID::PropsBush, {3345.f,3789.f}, PropType::BUSH, 3.f, false, false, true},
+            {TextureID::PropsBush, {3929.f,2941.f}, PropType::BUSH, 3.f, false, false, true},
+            {TextureID::PropsBush, {3875.f,2501.f}, PropType::BUSH, 3.f, false, false, true},
+            {TextureID::PropsBush, {3746.f,2567.f}, PropType::BUSH, 3.f, false, false, true},
+            {TextureID::PropsBush, {885.f,2764.f}, PropType::BUSH, 3.f, false, false, true},
+            {TextureID::PropsBush, {1181.f,2764.f}, PropType::BUSH, 3.f, false, false, true},
+            {TextureID::PropsBush, {3747.f,4000.f}, PropType::BUSH, 3.f, false, false, false},
+        })};
+
+        inline constexpr auto Walls{std::to_array<PropSpawn>({
+            // ---------------------------------------- Left Side Hill -----------------------------------
+            // Left Side Walls
+            {TextureID::PropsGrassWallLeft, {768.f, 2688.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {768.f, 2752.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {768.f, 2816.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {768.f, 2880.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {768.f, 2944.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {768.f, 3008.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {768.f, 3072.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {768.f, 3136.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {768.f, 3200.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {768.f, 3264.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {768.f, 3328.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {768.f, 3392.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {768.f, 3456.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {768.f, 3520.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallBotLeft, {768.f, 3584.f}, PropType::BOTTOMWALL},
+            // Bottom Walls
+            {TextureID::PropsGrassWallBottom, {896.f, 3584.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {960.f, 3584.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {832.f, 3584.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {1024.f, 3584.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {1216.f, 3584.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBotRight, {1280.f, 3584.f}, PropType::BOTTOMWALL},
+            // Bottom Right Walls
+            {TextureID::PropsGrassWallRight, {1280.f, 3520.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {1280.f, 3456.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {1280.f, 3392.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {1280.f, 3328.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallInnerRight, {1280.f, 3264.f}, PropType::RIGHTSIDEWALL},
+            // Bottom Walls
+            {TextureID::PropsGrassWallBottom, {1344.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {1408.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {1472.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {1536.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {1600.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {1664.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {1728.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {1792.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {1856.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBotRight, {1920.f, 3264.f}, PropType::BOTTOMWALL},
+            // Right Side Walls
+            {TextureID::PropsGrassWallRight, {1920.f, 3200.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {1920.f, 3136.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {1920.f, 3072.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {1920.f, 3008.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {1920.f, 2944.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {1920.f, 2880.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {1920.f, 2816.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {1920.f, 2752.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {1920.f, 2688.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallTopRight, {1920.f, 2624.f}, PropType::TOPWALL},
+            // Top Walls
+            {TextureID::PropsGrassWallTop, {1856.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {1792.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {1728.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {1664.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {1600.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {1536.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {1472.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {1408.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {1344.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {1280.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {1216.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {1152.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {1088.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {1024.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {960.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {896.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {832.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTopLeft, {768.f, 2624.f}, PropType::TOPWALL},
+            // Fences
+            {TextureID::PropsFenceDown, {832.f, 3662.f}, PropType::FENCE},
+            {TextureID::PropsFenceDown, {896.f, 3662.f}, PropType::FENCE},
+            {TextureID::PropsFenceDown, {960.f, 3662.f}, PropType::FENCE},
+            {TextureID::PropsFenceDown, {1024.f, 3662.f}, PropType::FENCE},
+            {TextureID::PropsFenceDown, {1216.f, 3662.f}, PropType::FENCE},
+            // ---------------------------------------- Garden Fences -----------------------------------
+            // Left Side
+            {TextureID::PropsFenceLeft, {1688.f, 3070.f}, PropType::FENCE},
+            {TextureID::PropsFenceLeft, {1688.f, 3198.f}, PropType::FENCE},
+            // Right Side
+            {TextureID::PropsFenceRight, {1925.f, 3070.f}, PropType::FENCE},
+            {TextureID::PropsFenceRight, {1925.f, 3128.f}, PropType::FENCE},
+            {TextureID::PropsFenceRight, {1925.f, 3198.f}, PropType::FENCE},
+            // Top Side
+            {TextureID::PropsFenceUp, {1728.f, 3070.f}, PropType::FENCE},
+            {TextureID::PropsFenceUp, {1856.f, 3070.f}, PropType::FENCE},
+            // Bottom Side
+            {TextureID::PropsFenceDown, {1728.f, 3215.f}, PropType::FENCE},
+            {TextureID::PropsFenceDown, {1792.f, 3215.f}, PropType::FENCE},
+            {TextureID::PropsFenceDown, {1856.f, 3215.f}, PropType::FENCE},
+            // ---------------------------------------- Left Side Inner Hill -----------------------------------
+            // Holes
+            {TextureID::PropsHole, {960.f, 3008.f}, PropType::HOLE},
+            {TextureID::PropsHole, {1088.f, 3008.f}, PropType::HOLE},
+            // Left Side Walls
+            {TextureID::PropsWallLeft, {896.f, 2816.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsWallLeft, {896.f, 2880.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsWallLeft, {896.f, 2944.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsWallLeft, {896.f, 3008.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsWallLeft, {896.f, 3072.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsWallLeft, {896.f, 3136.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsWallLeft, {896.f, 3200.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsWallBotLeft, {896.f, 3264.f}, PropType::BOTTOMWALL},
+            // Bottom Walls
+            {TextureID::PropsWallBottom, {960.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsWallBottom, {1024.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsWallBotRight, {1152.f, 3264.f}, PropType::BOTTOMWALL},
+            // Right Side Walls
+            {TextureID::PropsWallRight, {1152.f, 3200.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsWallRight, {1152.f, 3136.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsWallRight, {1152.f, 3072.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsWallRight, {1152.f, 3008.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsWallRight, {1152.f, 2944.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsWallRight, {1152.f, 2880.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsWallRight, {1152.f, 2816.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsWallTopRight, {1152.f, 2752.f}, PropType::TOPWALL},
+            // Top Walls
+            {TextureID::PropsGrassWallTop, {1088.f, 2752.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {1024.f, 2752.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {960.f, 2752.f}, PropType::TOPWALL},
+            {TextureID::PropsWallTopLeft, {896.f, 2752.f}, PropType::TOPWALL},
+            // ---------------------------------------- Right Side Hill -----------------------------------
+            // Left Side Walls
+            {TextureID::PropsGrassWallLeft, {2688.f, 2560.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2688.f, 2624.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2688.f, 2688.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2688.f, 2752.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2688.f, 2816.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2688.f, 2880.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2688.f, 2944.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2688.f, 3008.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2688.f, 3072.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2688.f, 3136.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2688.f, 3200.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2688.f, 3264.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2688.f, 3328.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2688.f, 3392.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallBotLeft, {2688.f, 3456.f}, PropType::BOTTOMWALL},
+            // Bottom Walls
+            {TextureID::PropsGrassWallBottom, {2752.f, 3456.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {2816.f, 3456.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {2880.f, 3456.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3264.f, 3456.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3328.f, 3456.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3392.f, 3456.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3456.f, 3456.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3520.f, 3456.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3584.f, 3456.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3648.f, 3456.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3712.f, 3456.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3776.f, 3456.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBotRight, {3840.f, 3456.f}, PropType::BOTTOMWALL},
+            // Right Side Walls
+            {TextureID::PropsGrassWallRight, {3840.f, 3392.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3840.f, 3328.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3840.f, 3264.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3840.f, 3200.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3840.f, 3136.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3840.f, 3072.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3840.f, 3008.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3840.f, 2944.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3840.f, 2880.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3840.f, 2816.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3840.f, 2752.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3840.f, 2688.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3840.f, 2624.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3840.f, 2560.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallTopRight, {3840.f, 2496.f}, PropType::TOPWALL},
+            // Top Side Walls
+            {TextureID::PropsGrassWallTop, {3776.f, 2496.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3712.f, 2496.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3648.f, 2496.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3584.f, 2496.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3520.f, 2496.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3456.f, 2496.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3392.f, 2496.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3328.f, 2496.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3264.f, 2496.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3200.f, 2496.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3136.f, 2496.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3072.f, 2496.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3008.f, 2496.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {2944.f, 2496.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {2880.f, 2496.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {2816.f, 2496.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {2752.f, 2496.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTopLeft, {2688.f, 2496.f}, PropType::TOPWALL},
+            // ---------------------------------------- Right Side Second Hill -----------------------------------
+            // Left Side Walls
+            {TextureID::PropsGrassWallLeft, {2752.f, 2624.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2752.f, 2688.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2752.f, 2752.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2752.f, 2816.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2752.f, 2880.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2752.f, 2944.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2752.f, 3008.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2752.f, 3072.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2752.f, 3136.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallLeft, {2752.f, 3200.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsGrassWallBotLeft, {2752.f, 3264.f}, PropType::BOTTOMWALL},
+            // Bottom Walls
+            {TextureID::PropsGrassWallBottom, {2816.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {2880.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {2944.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3136.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3200.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3264.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3328.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3392.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3456.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3520.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3584.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBottom, {3648.f, 3264.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsGrassWallBotRight, {3712.f, 3264.f}, PropType::BOTTOMWALL},
+            // Right Side Walls
+            {TextureID::PropsGrassWallRight, {3712.f, 3200.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3712.f, 3136.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3712.f, 3072.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3712.f, 3008.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3712.f, 2944.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3712.f, 2880.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3712.f, 2816.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3712.f, 2752.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3712.f, 2688.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallRight, {3712.f, 2624.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsGrassWallTopRight, {3712.f, 2560.f}, PropType::TOPWALL},
+            // Top Walls
+            {TextureID::PropsGrassWallTop, {3648.f, 2560.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3584.f, 2560.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3520.f, 2560.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3456.f, 2560.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3392.f, 2560.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3328.f, 2560.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3264.f, 2560.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3200.f, 2560.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3136.f, 2560.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3072.f, 2560.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3008.f, 2560.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {2944.f, 2560.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {2880.f, 2560.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {2816.f, 2560.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTopLeft, {2752.f, 2560.f}, PropType::TOPWALL},
+            // ---------------------------------------- Right Side Third Hill -----------------------------------
+            // Left Side Walls
+            {TextureID::PropsWallLeft, {2944.f, 2688.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsWallLeft, {2944.f, 2752.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsWallLeft, {2944.f, 2816.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsWallLeft, {2944.f, 2880.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsWallLeft, {2944.f, 2944.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsWallLeft, {2944.f, 3008.f}, PropType::LEFTSIDEWALL},
+            {TextureID::PropsWallBotLeft, {2944.f, 3072.f}, PropType::BOTTOMWALL},
+            // Bottom Walls
+            {TextureID::PropsWallBottom, {3008.f, 3072.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsWallBottom, {3136.f, 3072.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsWallBottom, {3200.f, 3072.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsWallBottom, {3264.f, 3072.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsWallBottom, {3328.f, 3072.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsWallBottom, {3456.f, 3072.f}, PropType::BOTTOMWALL},
+            {TextureID::PropsWallBotRight, {3520.f, 3072.f}, PropType::BOTTOMWALL},
+            // Right Side Walls
+            {TextureID::PropsWallRight, {3520.f, 3008.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsWallRight, {3520.f, 2944.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsWallRight, {3520.f, 2880.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsWallRight, {3520.f, 2816.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsWallRight, {3520.f, 2752.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsWallRight, {3520.f, 2688.f}, PropType::RIGHTSIDEWALL},
+            {TextureID::PropsWallTopRight, {3520.f, 2624.f}, PropType::TOPWALL},
+            // Bottom Walls
+            {TextureID::PropsGrassWallTop, {3456.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3392.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3328.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3264.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3200.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3136.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3072.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsGrassWallTop, {3008.f, 2624.f}, PropType::TOPWALL},
+            {TextureID::PropsWallTopLeft, {2944.f, 2624.f}, PropType::TOPWALL},
+            // Door
+            {TextureID::PropsDoorRed, {1612.f,2815.f}, PropType::DOOR, 4.f, false, true},
+            {TextureID::PropsDoorBlue, {3120.f,2685.f}, PropType::DOOR, 4.f, false, true},
+        })};
+
+        inline constexpr auto Stumps{std::to_array<PropSpawn>({
+            {TextureID::PropsTreeStump, {3056.f,1955.f}, PropType::STUMP, 4.f, false},
+            {TextureID::PropsTreeStump, {3274.f,3625.f}, PropType::STUMP, 5.f, false},
+            {TextureID::PropsTreeStump, {3352.f,3552.f}, PropType::STUMP, 4.f, false},
+            {TextureID::PropsTreeStump, {3293.f,3745.f}, PropType::STUMP, 3.5f, false},
+            {TextureID::PropsTreeStump, {3375.f,3667.f}, PropType::STUMP, 3.f, false},
+            {TextureID::PropsTreeStump, {3473.f,3649.f}, PropType::STUMP, 3.f, false},
+            {TextureID::PropsTreeStump, {3420.f,3736.f}, PropType::STUMP, 6.f, false},
+            {TextureID::PropsTreeStump, {3607.f,3795.f}, PropType::STUMP, 4.f, false},
+            {TextureID::PropsTreeStump, {3706.f,3748.f}, PropType::STUMP, 3.5f, false},
+            {TextureID::PropsTreeStump, {3857.f,3634.f}, PropType::STUMP, 4.f, false},
+            {TextureID::PropsTreeStump, {3630.f,3527.f}, PropType::STUMP, 6.f, false},
+            {TextureID::PropsTreeStump, {3636.f,3698.f}, PropType::STUMP, 3.5f, false},
+            {TextureID::PropsTreeStump, {3655.f,3877.f}, PropType::STUMP, 3.5f, false},
+            {TextureID::PropsAxeStump, {3439.f,3531.f}, PropType::STUMP, 4.f, false},
+        })};
+
+        inline constexpr auto Moveable{std::to_array<PropSpawn>({
+            {TextureID::PropsBoulder, {3525.f,3640.f}, PropType::BOULDER, 5.f, true},
+            {TextureID::PropsBoulder, {1025.f,2990.f}, PropType::BOULDER, 4.f, true},
+        })};
+
+        // in drawing order, the placeholder has to stay first
+        inline constexpr std::array<std::span<const PropSpawn>, 7> Groups{Placeholder, DungeonEntrance, Boulder, Bushes, Walls, Stumps, Moveable};
+    }
+
+    namespace Over
+    {
+        inline constexpr auto Bushes{std::to_array<PropSpawn>({
+            {TextureID::PropsBush, {1889.f,2965.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1889.f,2865.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1889.f,2765.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1889.f,2665.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1789.f,2665.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1689.f,2665.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1589.f,2665.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1489.f,2665.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1389.f,2665.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1289.f,2665.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1189.f,2665.f}, PropType::BUSH},
+            {TextureID::PropsBush, {1089.f,2665.f}, PropType::BUSH},
+            {TextureID::PropsBush, {989.f,2665.f}, PropType::BUSH},
+            {TextureID::PropsBush, {889.f,2665.f}, PropType::BUSH},
+            {TextureID::PropsBush, {789.f,2665.f}, PropType::BUSH},
+        })};
+
+        inline constexpr auto Houses{std::to_array<PropSpawn>({
+            {TextureID::PropsHouseRed, {1472.f,2688.f}, PropType::rHOUSELEFT},
+            {TextureID::PropsHouseRed, {1472.f,2688.f}, PropType::rHOUSERIGHT},
+            {TextureID::PropsHouseBlue, {3073.f,2495.f}, PropType::bHOUSELEFT},
+            {TextureID::PropsHouseBlue, {3073.f,2495.f}, PropType::bHOUSERIGHT},
+        })};
+
+        inline constexpr auto Boulder{std::to_array<PropSpawn>({
+            {TextureID::PropsBoulder, {945.f,2925.f}, PropType::BOULDER, 5.f},
+            {TextureID::PropsBoulder, {1090.f,2925.f}, PropType::BOULDER, 5.f},
+            {TextureID::PropsBoulder, {925.f,3060.f}, PropType::BOULDER, 5.f},
+            {TextureID::PropsBoulder, {1110.f,3060.f}, PropType::BOULDER, 5.f},
+        })};
+
+        inline constexpr auto Moveable{std::to_array<PropSpawn>({
+            {TextureID::PropsBoulder, {3525.f,3640.f}, PropType::BOULDER, 5.f, true},
+            {TextureID::PropsBoulder, {1025.f,2990.f}, PropType::BOULDER, 4.f, true},
+        })};
+
+        inline constexpr auto Stumps{std::to_array<PropSpawn>({
+            {TextureID::PropsRockStump, {440.f,1883.f}, PropType::STUMP, 5.f, false, true},
+        })};
+
+        // in drawing order, followed by the treasure, villager and altar groups built by hand
+        inline constexpr std::array<std::span<const PropSpawn>, 5> Groups{Bushes, Houses, Boulder, Moveable, Stumps};
+        inline constexpr size_t HandPlacedGroups{3};
+        inline constexpr size_t HandPlaced{8 + 4 + 6};
+    }
+
+    inline constexpr auto Trees{std::to_array<PropSpawn>({
+        // row1
+        {TextureID::PropsTreeGreen, {20.f,67.f}, PropType::TREE},      // 1
+        {TextureID::PropsTreeGreen, {120.f,67.f}, PropType::TREE},     // 2
+        {TextureID::PropsTreeGreen, {220.f,67.f}, PropType::TREE},     // 3
+        {TextureID::PropsTreeGreen, {320.f,67.f}, PropType::TREE},     // 4
+        {TextureID::PropsTreeGreen, {420.f,67.f}, PropType::TREE},     // 5
+        {TextureID::PropsTreeGreen, {520.f,67.f}, PropType::TREE},     // 6
+        {TextureID::PropsTreeGreen, {620.f,67.f}, PropType::TREE},     // 7
+        {TextureID::PropsTreeGreen, {720.f,67.f}, PropType::TREE},     // 8
+        {TextureID::PropsTreeGreen, {820.f,67.f}, PropType::TREE},     // 9
+        {TextureID::PropsTreeGreen, {920.f,67.f}, PropType::TREE},     // 10
+        {TextureID::PropsTreeGreen, {1020.f,67.f}, PropType::TREE},    // 11
+        {TextureID::PropsTreeGreen, {1120.f,67.f}, PropType::TREE},    // 12
+        {TextureID::PropsTreeGreen, {1220.f,67.f}, PropType::TREE},    // 13
+        {TextureID::PropsTreeGreen, {1320.f,67.f}, PropType::TREE},    // 14
+        {TextureID::PropsTreeGreen, {1420.f,67.f}, PropType::TREE},    // 15
+        {TextureID::PropsTreeGreen, {1520.f,67.f}, PropType::TREE},    // 16
+        {TextureID::PropsTreeGreen, {1620.f,67.f}, PropType::TREE},    // 17
+        {TextureID::PropsTreeGreen, {1720.f,67.f}, PropType::TREE},    // 18
+        {TextureID::PropsTreeGreen, {1820.f,67.f}, PropType::TREE},    // 19
+        {TextureID::PropsTreeGreen, {1920.f,67.f}, PropType::TREE},    // 20
+        {TextureID::PropsTreeGreen, {2020.f,67.f}, PropType::TREE},    // 21
+        {TextureID::PropsTreeGreen, {2120.f,67.f}, PropType::TREE},    // 22
+        {TextureID::PropsTreeGreen, {2220.f,67.f}, PropType::TREE},    // 23
+        {TextureID::PropsTreeGreen, {2320.f,67.f}, PropType::TREE},    // 24
+        {TextureID::PropsTreeGreen, {2420.f,67.f}, PropType::TREE},    // 25
+        {TextureID::PropsTreeGreen, {2520.f,67.f}, PropType::TREE},    // 26
+        {TextureID::PropsTreeGreen, {2620.f,67.f}, PropType::TREE},    // 27
+        {TextureID::PropsTreeGreen, {2720.f,67.f}, PropType::TREE},    // 28
+        {TextureID::PropsTreeGreen, {2820.f,67.f}, PropType::TREE},    // 29
+        {TextureID::PropsTreeGreen, {2920.f,67.f}, PropType::TREE},    // 30
+        {TextureID::PropsTreeGreen, {3020.f,67.f}, PropType::TREE},    // 31
+        {TextureID::PropsTreeGreen, {3120.f,67.f}, PropType::TREE},    // 32
+        {TextureID::PropsTreeGreen, {3220.f,67.f}, PropType::TREE},    // 33
+        {TextureID::PropsTreeGreen, {3320.f,67.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3420.f,67.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3700.f,67.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3800.f,67.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3900.f,67.f}, PropType::TREE},    // 38
+        {TextureID::PropsTreeGreen, {4000.f,67.f}, PropType::TREE},    // 39
+        // row2
+        {TextureID::PropsTreeGreen, {0.f,167.f}, PropType::TREE},       // 1
+        {TextureID::PropsTreeGreen, {200.f,167.f}, PropType::TREE},     // 3
+        {TextureID::PropsTreeGreen, {300.f,167.f}, PropType::TREE},     // 4
+        {TextureID::PropsTreeGreen, {400.f,167.f}, PropType::TREE},     // 5
+        {TextureID::PropsTreeGreen, {500.f,167.f}, PropType::TREE},     // 6
+        {TextureID::PropsTreeGreen, {700.f,167.f}, PropType::TREE},     // 8
+        {TextureID::PropsTreeGreen, {800.f,167.f}, PropType::TREE},     // 9
+        {TextureID::PropsTreeGreen, {900.f,167.f}, PropType::TREE},     // 10
+        {TextureID::PropsTreeGreen, {1400.f,167.f}, PropType::TREE},    // 15
+        {TextureID::PropsTreeGreen, {1500.f,167.f}, PropType::TREE},    // 16
+        {TextureID::PropsTreeGreen, {1600.f,167.f}, PropType::TREE},    // 17
+        {TextureID::PropsTreeGreen, {1900.f,167.f}, PropType::TREE},    // 20
+        {TextureID::PropsTreeGreen, {2000.f,167.f}, PropType::TREE},    // 21
+        {TextureID::PropsTreeGreen, {2100.f,167.f}, PropType::TREE},    // 22
+        {TextureID::PropsTreeGreen, {2200.f,167.f}, PropType::TREE},    // 23
+        {TextureID::PropsTreeGreen, {2500.f,167.f}, PropType::TREE},    // 26
+        {TextureID::PropsTreeGreen, {2600.f,167.f}, PropType::TREE},    // 27
+        {TextureID::PropsTreeGreen, {2700.f,167.f}, PropType::TREE},    // 28
+        {TextureID::PropsTreeGreen, {2800.f,167.f}, PropType::TREE},    // 29
+        {TextureID::PropsTreeGreen, {3000.f,167.f}, PropType::TREE},    // 31
+        {TextureID::PropsTreeGreen, {3100.f,167.f}, PropType::TREE},    // 32
+        {TextureID::PropsTreeGreen, {3200.f,167.f}, PropType::TREE},    // 33
+        {TextureID::PropsTreeGreen, {3300.f,167.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3400.f,167.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3720.f,167.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3920.f,167.f}, PropType::TREE},    // 38
+        // row3
+        {TextureID::PropsTreeGreen, {20.f,267.f}, PropType::TREE},      // 1
+        {TextureID::PropsTreeGreen, {120.f,267.f}, PropType::TREE},     // 2
+        {TextureID::PropsTreeGreen, {320.f,267.f}, PropType::TREE},     // 4
+        {TextureID::PropsTreeGreen, {420.f,267.f}, PropType::TREE},     // 5
+        {TextureID::PropsTreeGreen, {620.f,267.f}, PropType::TREE},     // 7
+        {TextureID::PropsTreeGreen, {720.f,267.f}, PropType::TREE},     // 8
+        {TextureID::PropsTreeGreen, {820.f,267.f}, PropType::TREE},     // 9
+        {TextureID::PropsTreeGreen, {1520.f,267.f}, PropType::TREE},    // 16
+        {TextureID::PropsTreeGreen, {1620.f,267.f}, PropType::TREE},    // 17
+        {TextureID::PropsTreeGreen, {1720.f,267.f}, PropType::TREE},    // 18
+        {TextureID::PropsTreeGreen, {1820.f,267.f}, PropType::TREE},    // 19
+        {TextureID::PropsTreeGreen, {1920.f,267.f}, PropType::TREE},    // 20
+        {TextureID::PropsTreeGreen, {2020.f,267.f}, PropType::TREE},    // 21
+        {TextureID::PropsTreeGreen, {2220.f,267.f}, PropType::TREE},    // 23
+        {TextureID::PropsTreeGreen, {2320.f,267.f}, PropType::TREE},    // 24
+        {TextureID::PropsTreeGreen, {2420.f,267.f}, PropType::TREE},    // 25
+        {TextureID::PropsTreeGreen, {2520.f,267.f}, PropType::TREE},    // 26
+        {TextureID::PropsTreeGreen, {2620.f,267.f}, PropType::TREE},    // 27
+        {TextureID::PropsTreeGreen, {2820.f,267.f}, PropType::TREE},    // 29
+        {TextureID::PropsTreeGreen, {2920.f,267.f}, PropType::TREE},    // 30
+        {TextureID::PropsTreeGreen, {3020.f,267.f}, PropType::TREE},    // 31
+        {TextureID::PropsTreeGreen, {3120.f,267.f}, PropType::TREE},    // 32
+        {TextureID::PropsTreeGreen, {3320.f,267.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3700.f,267.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3800.f,267.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3900.f,267.f}, PropType::TREE},    // 38
+        {TextureID::PropsTreeGreen, {4000.f,267.f}, PropType::TREE},    // 39
+        // row4
+        {TextureID::PropsTreeGreen, {0.f,367.f}, PropType::TREE},       // 1
+        {TextureID::PropsTreeGreen, {100.f,367.f}, PropType::TREE},     // 2
+        {TextureID::PropsTreeGreen, {200.f,367.f}, PropType::TREE},     // 3
+        {TextureID::PropsTreeGreen, {400.f,367.f}, PropType::TREE},     // 5
+        {TextureID::PropsTreeGreen, {500.f,367.f}, PropType::TREE},     // 6
+        {TextureID::PropsTreeGreen, {700.f,367.f}, PropType::TREE},     // 8
+        {TextureID::PropsTreeGreen, {800.f,367.f}, PropType::TREE},     // 9
+        {TextureID::PropsTreeGreen, {1500.f,367.f}, PropType::TREE},    // 16
+        {TextureID::PropsTreeGreen, {1600.f,367.f}, PropType::TREE},    // 17
+        {TextureID::PropsTreeGreen, {1800.f,367.f}, PropType::TREE},    // 19
+        {TextureID::PropsTreeGreen, {1900.f,367.f}, PropType::TREE},    // 20
+        {TextureID::PropsTreeGreen, {2400.f,367.f}, PropType::TREE},    // 25
+        {TextureID::PropsTreeGreen, {2500.f,367.f}, PropType::TREE},    // 26
+        {TextureID::PropsTreeGreen, {2600.f,367.f}, PropType::TREE},    // 27
+        {TextureID::PropsTreeGreen, {2700.f,367.f}, PropType::TREE},    // 28
+        {TextureID::PropsTreeGreen, {2800.f,367.f}, PropType::TREE},    // 29
+        {TextureID::PropsTreeGreen, {2900.f,367.f}, PropType::TREE},    // 30
+        {TextureID::PropsTreeGreen, {3000.f,367.f}, PropType::TREE},    // 31
+        {TextureID::PropsTreeGreen, {3100.f,367.f}, PropType::TREE},    // 32
+        {TextureID::PropsTreeGreen, {3200.f,367.f}, PropType::TREE},    // 33
+        {TextureID::PropsTreeGreen, {3300.f,367.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3400.f,367.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3720.f,367.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3820.f,367.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3920.f,367.f}, PropType::TREE},    // 38
+        //row5
+        {TextureID::PropsTreeGreen, {20.f,467.f}, PropType::TREE},      // 1
+        {TextureID::PropsTreeGreen, {120.f,467.f}, PropType::TREE},     // 2
+        {TextureID::PropsTreeGreen, {320.f,467.f}, PropType::TREE},     // 4
+        {TextureID::PropsTreeGreen, {520.f,467.f}, PropType::TREE},     // 6
+        {TextureID::PropsTreeGreen, {620.f,467.f}, PropType::TREE},     // 7
+        {TextureID::PropsTreeGreen, {720.f,467.f}, PropType::TREE},     // 8
+        {TextureID::PropsTreeGreen, {920.f,467.f}, PropType::TREE},     // 10
+        {TextureID::PropsTreeGreen, {1420.f,467.f}, PropType::TREE},    // 15
+        {TextureID::PropsTreeGreen, {1520.f,467.f}, PropType::TREE},    // 16
+        {TextureID::PropsTreeGreen, {1620.f,467.f}, PropType::TREE},    // 17
+        {TextureID::PropsTreeGreen, {1820.f,467.f}, PropType::TREE},    // 19
+        {TextureID::PropsTreeGreen, {2520.f,467.f}, PropType::TREE},    // 26
+        {TextureID::PropsTreeGreen, {2620.f,467.f}, PropType::TREE},    // 27
+        {TextureID::PropsTreeGreen, {2720.f,467.f}, PropType::TREE},    // 28
+        {TextureID::PropsTreeGreen, {2820.f,467.f}, PropType::TREE},    // 29
+        {TextureID::PropsTreeGreen, {2920.f,467.f}, PropType::TREE},    // 30
+        {TextureID::PropsTreeGreen, {3120.f,467.f}, PropType::TREE},    // 32
+        {TextureID::PropsTreeGreen, {3220.f,467.f}, PropType::TREE},    // 33
+        {TextureID::PropsTreeGreen, {3320.f,467.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3420.f,467.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3700.f,467.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3800.f,467.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3900.f,467.f}, PropType::TREE},    // 38
+        {TextureID::PropsTreeGreen, {4000.f,467.f}, PropType::TREE},    // 39
+        // row6
+        {TextureID::PropsTreeGreen, {0.f,567.f}, PropType::TREE},       // 1
+        {TextureID::PropsTreeGreen, {100.f,567.f}, PropType::TREE},     // 2
+        {TextureID::PropsTreeGreen, {500.f,567.f}, PropType::TREE},     // 6
+        {TextureID::PropsTreeGreen, {600.f,567.f}, PropType::TREE},     // 7
+        {TextureID::PropsTreeGreen, {800.f,567.f}, PropType::TREE},     // 9
+        {TextureID::PropsTreeGreen, {900.f,567.f}, PropType::TREE},     // 10
+        {TextureID::PropsTreeGreen, {1000.f,567.f}, PropType::TREE},    // 11
+        {TextureID::PropsTreeGreen, {1100.f,567.f}, PropType::TREE},    // 12
+        {TextureID::PropsTreeGreen, {1200.f,567.f}, PropType::TREE},    // 13
+        {TextureID::PropsTreeGreen, {1400.f,567.f}, PropType::TREE},    // 15
+        {TextureID::PropsTreeGreen, {1500.f,567.f}, PropType::TREE},    // 16
+        {TextureID::PropsTreeGreen, {1600.f,567.f}, PropType::TREE},    // 17
+        {TextureID::PropsTreeGreen, {1700.f,567.f}, PropType::TREE},    // 18
+        {TextureID::PropsTreeGreen, {2500.f,567.f}, PropType::TREE},    // 26
+        {TextureID::PropsTreeGreen, {2700.f,567.f}, PropType::TREE},    // 28
+        {TextureID::PropsTreeGreen, {3100.f,567.f}, PropType::TREE},    // 32
+        {TextureID::PropsTreeGreen, {3200.f,567.f}, PropType::TREE},    // 33
+        {TextureID::PropsTreeGreen, {3300.f,567.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3400.f,567.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3720.f,567.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3820.f,567.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3920.f,567.f}, PropType::TREE},    // 38
+        // row7
+        {TextureID::PropsTreeGreen, {20.f,667.f}, PropType::TREE},      // 1
+        {TextureID::PropsTreeGreen, {520.f,667.f}, PropType::TREE},     // 6
+        {TextureID::PropsTreeGreen, {620.f,667.f}, PropType::TREE},     // 6
+        {TextureID::PropsTreeGreen, {720.f,667.f}, PropType::TREE},     // 8
+        {TextureID::PropsTreeGreen, {820.f,667.f}, PropType::TREE},     // 9
+        {TextureID::PropsTreeGreen, {920.f,667.f}, PropType::TREE},     // 10
+        {TextureID::PropsTreeGreen, {1020.f,667.f}, PropType::TREE},    // 11
+        {TextureID::PropsTreeGreen, {1120.f,667.f}, PropType::TREE},    // 12
+        {TextureID::PropsTreeGreen, {1220.f,667.f}, PropType::TREE},    // 13
+        {TextureID::PropsTreeGreen, {1720.f,667.f}, PropType::TREE},    // 18
+        {TextureID::PropsTreeGreen, {1820.f,667.f}, PropType::TREE},    // 19
+        {TextureID::PropsTreeGreen, {2520.f,667.f}, PropType::TREE},    // 26
+        {TextureID::PropsTreeGreen, {2620.f,667.f}, PropType::TREE},    // 27
+        {TextureID::PropsTreeGreen, {3220.f,667.f}, PropType::TREE},    // 33
+        {TextureID::PropsTreeGreen, {3320.f,667.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3420.f,667.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3700.f,667.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3800.f,667.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3900.f,667.f}, PropType::TREE},    // 38
+        {TextureID::PropsTreeGreen, {4000.f,667.f}, PropType::TREE},    // 39
+        // row8
+        {TextureID::PropsTreeGreen, {0.f,767.f}, PropType::TREE},       // 1
+        {TextureID::PropsTreeGreen, {400.f,767.f}, PropType::TREE},     // 5
+        {TextureID::PropsTreeGreen, {500.f,767.f}, PropType::TREE},     // 6
+        {TextureID::PropsTreeGreen, {600.f,767.f}, PropType::TREE},     // 7
+        {TextureID::PropsTreeGreen, {800.f,767.f}, PropType::TREE},     // 9
+        {TextureID::PropsTreeGreen, {900.f,767.f}, PropType::TREE},     // 10
+        {TextureID::PropsTreeGreen, {1000.f,767.f}, PropType::TREE},    // 11
+        {TextureID::PropsTreeGreen, {1100.f,767.f}, PropType::TREE},    // 12
+        {TextureID::PropsTreeGreen, {1200.f,767.f}, PropType::TREE},    // 13
+        {TextureID::PropsTreeGreen, {1300.f,767.f}, PropType::TREE},    // 14
+        {TextureID::PropsTreeGreen, {1400.f,767.f}, PropType::TREE},    // 15
+        {TextureID::PropsTreeGreen, {1500.f,767.f}, PropType::TREE},    // 16
+        {TextureID::PropsTreeGreen, {1600.f,767.f}, PropType::TREE},    // 17
+        {TextureID::PropsTreeGreen, {2600.f,767.f}, PropType::TREE},    // 27
+        {TextureID::PropsTreeGreen, {3200.f,767.f}, PropType::TREE},    // 33
+        {TextureID::PropsTreeGreen, {3300.f,767.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3400.f,767.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3720.f,767.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3820.f,767.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3920.f,767.f}, PropType::TREE},    // 38
+        // row9
+        {TextureID::PropsTreeGreen, {20.f,867.f}, PropType::TREE},      // 1
+        {TextureID::PropsTreeGreen, {320.f,867.f}, PropType::TREE},     // 4
+        {TextureID::PropsTreeGreen, {420.f,867.f}, PropType::TREE},     // 5
+        {TextureID::PropsTreeGreen, {520.f,867.f}, PropType::TREE},     // 6
+        {TextureID::PropsTreeGreen, {1120.f,867.f}, PropType::TREE},    // 12
+        {TextureID::PropsTreeGreen, {1220.f,867.f}, PropType::TREE},    // 13
+        {TextureID::PropsTreeGreen, {1320.f,867.f}, PropType::TREE},    // 14
+        {TextureID::PropsTreeGreen, {1420.f,867.f}, PropType::TREE},    // 15
+        {TextureID::PropsTreeGreen, {1620.f,867.f}, PropType::TREE},    // 17
+        {TextureID::PropsTreeGreen, {1720.f,867.f}, PropType::TREE},    // 18
+        {TextureID::PropsTreeGreen, {1820.f,867.f}, PropType::TREE},    // 19
+        {TextureID::PropsTreeGreen, {2060.f,867.f}, PropType::TREE},    // 22
+        {TextureID::PropsTreeGreen, {2180.f,867.f}, PropType::TREE},    // 23
+        {TextureID::PropsTreeGreen, {2300.f,867.f}, PropType::TREE},    // 24
+        {TextureID::PropsTreeGreen, {2420.f,867.f}, PropType::TREE},    // 25
+        {TextureID::PropsTreeGreen, {2620.f,867.f}, PropType::TREE},    // 27
+        {TextureID::PropsTreeGreen, {3220.f,867.f}, PropType::TREE},    // 33
+        {TextureID::PropsTreeGreen, {3320.f,867.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3420.f,867.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3700.f,867.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3800.f,867.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3900.f,867.f}, PropType::TREE},    // 38
+        {TextureID::PropsTreeGreen, {4000.f,867.f}, PropType::TREE},    // 39
+        // row10
+        {TextureID::PropsTreeGreen, {0.f,967.f}, PropType::TREE},       // 1
+        {TextureID::PropsTreeGreen, {300.f,967.f}, PropType::TREE},     // 4
+        {TextureID::PropsTreeGreen, {400.f,967.f}, PropType::TREE},     // 5
+        {TextureID::PropsTreeGreen, {1100.f,967.f}, PropType::TREE},    // 12
+        {TextureID::PropsTreeGreen, {1200.f,967.f}, PropType::TREE},    // 13
+        {TextureID::PropsTreeGreen, {1300.f,967.f}, PropType::TREE},    // 14
+        {TextureID::PropsTreeGreen, {1500.f,967.f}, PropType::TREE},    // 16
+        {TextureID::PropsTreeGreen, {1600.f,967.f}, PropType::TREE},    // 17
+        {TextureID::PropsTreeGreen, {1900.f,967.f}, PropType::TREE},    // 20
+        {TextureID::PropsTreeGreen, {2000.f,967.f}, PropType::TREE},    // 21
+        {TextureID::PropsTreeGreen, {2100.f,967.f}, PropType::TREE},    // 22
+        {TextureID::PropsTreeGreen, {2300.f,967.f}, PropType::TREE},    // 24
+        {TextureID::PropsTreeGreen, {2500.f,967.f}, PropType::TREE},    // 26
+        {TextureID::PropsTreeGreen, {2600.f,967.f}, PropType::TREE},    // 27
+        {TextureID::PropsTreeGreen, {3200.f,967.f}, PropType::TREE},    // 33
+        {TextureID::PropsTreeGreen, {3300.f,967.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3400.f,967.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3720.f,967.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3820.f,967.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3920.f,967.f}, PropType::TREE},    // 38
+        // row11
+        {TextureID::PropsTreeGreen, {20.f,1067.f}, PropType::TREE},      // 1
+        {TextureID::PropsTreeGreen, {120.f,1067.f}, PropType::TREE},     // 2
+        {TextureID::PropsTreeGreen, {1820.f,1067.f}, PropType::TREE},    // 19
+        {TextureID::PropsTreeGreen, {1920.f,1067.f}, PropType::TREE},    // 20
+        {TextureID::PropsTreeGreen, {2220.f,1067.f}, PropType::TREE},    // 23
+        {TextureID::PropsTreeGreen, {2320.f,1067.f}, PropType::TREE},    // 24
+        {TextureID::PropsTreeGreen, {2620.f,1067.f}, PropType::TREE},    // 27
+        {TextureID::PropsTreeGreen, {2720.f,1067.f}, PropType::TREE},    // 28
+        {TextureID::PropsTreeGreen, {3120.f,1067.f}, PropType::TREE},    // 32
+        {TextureID::PropsTreeGreen, {3220.f,1067.f}, PropType::TREE},    // 33
+        {TextureID::PropsTreeGreen, {3320.f,1067.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3420.f,1067.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3700.f,1067.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3800.f,1067.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3900.f,1067.f}, PropType::TREE},    // 38
+        {TextureID::PropsTreeGreen, {4000.f,1067.f}, PropType::TREE},    // 39
+        // row12
+        {TextureID::PropsTreeGreen, {0.f,1167.f}, PropType::TREE},       // 1
+        {TextureID::PropsTreeGreen, {100.f,1167.f}, PropType::TREE},     // 2
+        {TextureID::PropsTreeGreen, {200.f,1167.f}, PropType::TREE},     // 3
+        {TextureID::PropsTreeGreen, {300.f,1167.f}, PropType::TREE},     // 4
+        {TextureID::PropsTreeGreen, {400.f,1167.f}, PropType::TREE},     // 5
+        {TextureID::PropsTreeGreen, {1100.f,1167.f}, PropType::TREE},    // 12
+        {TextureID::PropsTreeGreen, {1200.f,1167.f}, PropType::TREE},    // 13
+        {TextureID::PropsTreeGreen, {1500.f,1167.f}, PropType::TREE},    // 16
+        {TextureID::PropsTreeGreen, {1600.f,1167.f}, PropType::TREE},    // 17
+        {TextureID::PropsTreeGreen, {1700.f,1167.f}, PropType::TREE},    // 18
+        {TextureID::PropsTreeGreen, {1800.f,1167.f}, PropType::TREE},    // 19
+        {TextureID::PropsTreeGreen, {1900.f,1167.f}, PropType::TREE},    // 20
+        {TextureID::PropsTreeGreen, {2000.f,1167.f}, PropType::TREE},    // 21
+        {TextureID::PropsTreeGreen, {2100.f,1167.f}, PropType::TREE},    // 22
+        {TextureID::PropsTreeGreen, {2200.f,1167.f}, PropType::TREE},    // 23
+        {TextureID::PropsTreeGreen, {2300.f,1167.f}, PropType::TREE},    // 24
+        {TextureID::PropsTreeGreen, {2400.f,1167.f}, PropType::TREE},    // 25
+        {TextureID::PropsTreeGreen, {2500.f,1167.f}, PropType::TREE},    // 26
+        {TextureID::PropsTreeGreen, {2900.f,1167.f}, PropType::TREE},    // 30
+        {TextureID::PropsTreeGreen, {3000.f,1167.f}, PropType::TREE},    // 31
+        {TextureID::PropsTreeGreen, {3100.f,1167.f}, PropType::TREE},    // 32
+        {TextureID::PropsTreeGreen, {3300.f,1167.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3400.f,1167.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3720.f,1167.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3820.f,1167.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3920.f,1167.f}, PropType::TREE},    // 38
+        // row13
+        {TextureID::PropsTreeGreen, {20.f,1267.f}, PropType::TREE},      // 2
+        {TextureID::PropsTreeGreen, {120.f,1267.f}, PropType::TREE},     // 2
+        {TextureID::PropsTreeGreen, {220.f,1267.f}, PropType::TREE},     // 3
+        {TextureID::PropsTreeGreen, {320.f,1267.f}, PropType::TREE},     // 4
+        {TextureID::PropsTreeGreen, {420.f,1267.f}, PropType::TREE},     // 5
+        {TextureID::PropsTreeGreen, {520.f,1267.f}, PropType::TREE},     // 6
+        {TextureID::PropsTreeGreen, {1020.f,1267.f}, PropType::TREE},    // 11
+        {TextureID::PropsTreeGreen, {1220.f,1267.f}, PropType::TREE},    // 13
+        {TextureID::PropsTreeGreen, {1320.f,1267.f}, PropType::TREE},    // 14
+        {TextureID::PropsTreeGreen, {1820.f,1267.f}, PropType::TREE},    // 19
+        {TextureID::PropsTreeGreen, {1920.f,1267.f}, PropType::TREE},    // 20
+        {TextureID::PropsTreeGreen, {2420.f,1267.f}, PropType::TREE},    // 25
+        {TextureID::PropsTreeGreen, {2720.f,1267.f}, PropType::TREE},    // 28
+        {TextureID::PropsTreeFall, {2820.f,1267.f}, PropType::TREE},     // 29
+        {TextureID::PropsTreeGreen, {2920.f,1267.f}, PropType::TREE},    // 30
+        {TextureID::PropsTreeFall, {3020.f,1267.f}, PropType::TREE},     // 31
+        {TextureID::PropsTreeGreen, {3120.f,1267.f}, PropType::TREE},    // 32
+        {TextureID::PropsTreeGreen, {3220.f,1267.f}, PropType::TREE},    // 33
+        {TextureID::PropsTreeGreen, {3320.f,1267.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3420.f,1267.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3700.f,1267.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3800.f,1267.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3900.f,1267.f}, PropType::TREE},    // 38
+        {TextureID::PropsTreeGreen, {4000.f,1267.f}, PropType::TREE},    // 39
+        // row14
+        {TextureID::PropsTreeGreen, {0.f,1367.f}, PropType::TREE},       // 1
+        {TextureID::PropsTreeGreen, {100.f,1367.f}, PropType::TREE},     // 2
+        {TextureID::PropsTreeGreen, {200.f,1367.f}, PropType::TREE},     // 3
+        {TextureID::PropsTreeGreen, {300.f,1367.f}, PropType::TREE},     // 4
+        {TextureID::PropsTreeGreen, {400.f,1367.f}, PropType::TREE},     // 5
+        {TextureID::PropsTreeGreen, {700.f,1367.f}, PropType::TREE},     // 8
+        {TextureID::PropsTreeGreen, {800.f,1367.f}, PropType::TREE},     // 9
+        {TextureID::PropsTreeGreen, {1000.f,1367.f}, PropType::TREE},    // 11
+        {TextureID::PropsTreeGreen, {1100.f,1367.f}, PropType::TREE},    // 12
+        {TextureID::PropsTreeGreen, {1200.f,1367.f}, PropType::TREE},    // 13
+        {TextureID::PropsTreeGreen, {1300.f,1367.f}, PropType::TREE},    // 14
+        {TextureID::PropsTreeGreen, {1400.f,1367.f}, PropType::TREE},    // 15
+        {TextureID::PropsTreeGreen, {1500.f,1367.f}, PropType::TREE},    // 16
+        {TextureID::PropsTreeGreen, {1600.f,1367.f}, PropType::TREE},    // 17
+        {TextureID::PropsTreeGreen, {2600.f,1367.f}, PropType::TREE},    // 27
+        {TextureID::PropsTreeFall, {2700.f,1367.f}, PropType::TREE},     // 28
+        {TextureID::PropsTreeGreen, {2800.f,1367.f}, PropType::TREE},    // 29
+        {TextureID::PropsTreeGreen, {2900.f,1367.f}, PropType::TREE},    // 30
+        {TextureID::PropsTreeGreen, {3100.f,1367.f}, PropType::TREE},    // 32
+        {TextureID::PropsTreeGreen, {3200.f,1367.f}, PropType::TREE},    // 33
+        {TextureID::PropsTreeGreen, {3300.f,1367.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3400.f,1367.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3720.f,1367.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3820.f,1367.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3920.f,1367.f}, PropType::TREE},    // 38
+        // row15
+        {TextureID::PropsTreeGreen, {20.f,1467.f}, PropType::TREE},       // 1
+        {TextureID::PropsTreeGreen, {120.f,1467.f}, PropType::TREE},      // 2
+        {TextureID::PropsTreeGreen, {220.f,1467.f}, PropType::TREE},      // 3
+        {TextureID::PropsTreeGreen, {320.f,1467.f}, PropType::TREE},      // 4
+        {TextureID::PropsTreeGreen, {520.f,1467.f}, PropType::TREE},      // 6
+        {TextureID::PropsTreeGreen, {720.f,1467.f}, PropType::TREE},      // 8
+        {TextureID::PropsTreeGreen, {820.f,1467.f}, PropType::TREE},      // 9
+        {TextureID::PropsTreeGreen, {1420.f,1467.f}, PropType::TREE},     // 15
+        {TextureID::PropsTreeGreen, {1520.f,1467.f}, PropType::TREE},     // 16
+        {TextureID::PropsTreeGreen, {1720.f,1467.f}, PropType::TREE},     // 18
+        {TextureID::PropsTreeGreen, {1820.f,1467.f}, PropType::TREE},     // 19
+        {TextureID::PropsTreeGreen, {2420.f,1467.f}, PropType::TREE},     // 25
+        {TextureID::PropsTreeGreen, {2520.f,1467.f}, PropType::TREE},     // 26
+        {TextureID::PropsTreeGreen, {2620.f,1467.f}, PropType::TREE},     // 27
+        {TextureID::PropsTreeStump, {2835.f,1546.f}, PropType::STUMP},    // 29
+        {TextureID::PropsTreeFall, {2920.f,1467.f}, PropType::TREE},      // 30
+        {TextureID::PropsTreeStump, {3135.f,1546.f}, PropType::STUMP},    // 31
+        {TextureID::PropsTreeGreen, {3220.f,1467.f}, PropType::TREE},     // 33
+        {TextureID::PropsTreeGreen, {3420.f,1467.f}, PropType::TREE},     // 35
+        {TextureID::PropsTreeGreen, {3700.f,1467.f}, PropType::TREE},     // 36
+        {TextureID::PropsTreeGreen, {3800.f,1467.f}, PropType::TREE},     // 37
+        {TextureID::PropsTreeGreen, {3900.f,1467.f}, PropType::TREE},     // 38
+        // row16
+        {TextureID::PropsTreeGreen, {0.f,1567.f}, PropType::TREE},        // 1
+        {TextureID::PropsTreeGreen, {100.f,1567.f}, PropType::TREE},      // 2
+        {TextureID::PropsTreeGreen, {200.f,1567.f}, PropType::TREE},      // 3
+        {TextureID::PropsTreeGreen, {400.f,1567.f}, PropType::TREE},      // 5
+        {TextureID::PropsTreeGreen, {500.f,1567.f}, PropType::TREE},      // 6
+        {TextureID::PropsTreeGreen, {600.f,1567.f}, PropType::TREE},      // 7
+        {TextureID::PropsTreeGreen, {700.f,1567.f}, PropType::TREE},      // 8
+        {TextureID::PropsTreeGreen, {800.f,1567.f}, PropType::TREE},      // 9
+        {TextureID::PropsTreeGreen, {900.f,1567.f}, PropType::TREE},      // 10
+        {TextureID::PropsTreeGreen, {1000.f,1567.f}, PropType::TREE},     // 11
+        {TextureID::PropsTreeGreen, {1100.f,1567.f}, PropType::TREE},     // 12
+        {TextureID::PropsTreeGreen, {1200.f,1567.f}, PropType::TREE},     // 13
+        {TextureID::PropsTreeGreen, {1300.f,1567.f}, PropType::TREE},     // 14
+        {TextureID::PropsTreeGreen, {1500.f,1567.f}, PropType::TREE},     // 16
+        {TextureID::PropsTreeGreen, {1600.f,1567.f}, PropType::TREE},     // 17
+        {TextureID::PropsTreeGreen, {2500.f,1567.f}, PropType::TREE},     // 26
+        {TextureID::PropsTreeGreen, {2600.f,1567.f}, PropType::TREE},     // 27
+        {TextureID::PropsTreeGreen, {2700.f,1567.f}, PropType::TREE},     // 28
+        {TextureID::PropsTreeGreen, {2800.f,1567.f}, PropType::TREE},     // 29
+        {TextureID::PropsTreeStump, {2950.f,1658.f}, PropType::STUMP},    // 30
+        {TextureID::PropsTreeStump, {3050.f,1658.f}, PropType::STUMP},    // 31
+        {TextureID::PropsTreeFall, {3200.f,1567.f}, PropType::TREE},      // 33
+        {TextureID::PropsTreeGreen, {3300.f,1567.f}, PropType::TREE},     // 34
+        {TextureID::PropsTreeGreen, {3400.f,1567.f}, PropType::TREE},     // 35
+        {TextureID::PropsTreeGreen, {3720.f,1567.f}, PropType::TREE},     // 36
+        {TextureID::PropsTreeGreen, {3820.f,1567.f}, PropType::TREE},     // 37
+        {TextureID::PropsTreeGreen, {3920.f,1567.f}, PropType::TREE},     // 38
+        // row17
+        {TextureID::PropsTreeGreen, {20.f,1667.f}, PropType::TREE},       // 1
+        {TextureID::PropsTreeGreen, {120.f,1667.f}, PropType::TREE},      // 2
+        {TextureID::PropsTreeGreen, {720.f,1667.f}, PropType::TREE},      // 8
+        {TextureID::PropsTreeGreen, {820.f,1667.f}, PropType::TREE},      // 9
+        {TextureID::PropsTreeGreen, {920.f,1667.f}, PropType::TREE},      // 10
+        {TextureID::PropsTreeGreen, {1120.f,1667.f}, PropType::TREE},     // 12
+        {TextureID::PropsTreeGreen, {1220.f,1667.f}, PropType::TREE},     // 13
+        {TextureID::PropsTreeGreen, {1320.f,1667.f}, PropType::TREE},     // 14
+        {TextureID::PropsTreeGreen, {2920.f,1667.f}, PropType::TREE},     // 30
+        {TextureID::PropsTreeStump, {2635.f,1737.f}, PropType::STUMP},    // 32
+        {TextureID::PropsTreeStump, {2735.f,1737.f}, PropType::STUMP},    // 32
+        {TextureID::PropsTreeStump, {2835.f,1737.f}, PropType::STUMP},    // 31
+        {TextureID::PropsTreeStump, {3050.f,1737.f}, PropType::STUMP},    // 31
+        {TextureID::PropsTreeStump, {3220.f,1737.f}, PropType::STUMP},    // 32
+        {TextureID::PropsTreeGreen, {3320.f,1667.f}, PropType::TREE},     // 34
+        {TextureID::PropsTreeFall, {3420.f,1667.f}, PropType::TREE},      // 35
+        {TextureID::PropsTreeGreen, {3700.f,1667.f}, PropType::TREE},     // 36
+        {TextureID::PropsTreeGreen, {3800.f,1667.f}, PropType::TREE},     // 37
+        {TextureID::PropsTreeGreen, {3900.f,1667.f}, PropType::TREE},     // 38
+        {TextureID::PropsTreeGreen, {4000.f,1667.f}, PropType::TREE},     // 39
+        // row18
+        {TextureID::PropsTreeGreen, {0.f,1767.f}, PropType::TREE},       // 1
+        {TextureID::PropsTreeGreen, {100.f,1767.f}, PropType::TREE},     // 2
+        {TextureID::PropsTreeGreen, {800.f,1767.f}, PropType::TREE},     // 9
+        {TextureID::PropsTreeGreen, {900.f,1767.f}, PropType::TREE},     // 10
+        {TextureID::PropsTreeGreen, {1000.f,1767.f}, PropType::TREE},    // 11
+        {TextureID::PropsTreeGreen, {1100.f,1767.f}, PropType::TREE},    // 12
+        {TextureID::PropsTreeGreen, {1300.f,1767.f}, PropType::TREE},    // 14
+        {TextureID::PropsTreeGreen, {1400.f,1767.f}, PropType::TREE},    // 15
+        {TextureID::PropsTreeGreen, {2500.f,1767.f}, PropType::TREE},    // 26
+        {TextureID::PropsTreeGreen, {2600.f,1767.f}, PropType::TREE},    // 27
+        {TextureID::PropsTreeGreen, {2700.f,1767.f}, PropType::TREE},    // 28
+        {TextureID::PropsTreeGreen, {2800.f,1767.f}, PropType::TREE},    // 29
+        {TextureID::PropsTreeFall, {3000.f,1767.f}, PropType::TREE},     // 31
+        {TextureID::PropsTreeGreen, {3720.f,1767.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3820.f,1767.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3920.f,1767.f}, PropType::TREE},    // 38
+        // row19
+        {TextureID::PropsTreeGreen, {20.f,1867.f}, PropType::TREE},       // 1
+        {TextureID::PropsTreeGreen, {820.f,1867.f}, PropType::TREE},      // 9
+        {TextureID::PropsTreeGreen, {920.f,1867.f}, PropType::TREE},      // 10
+        {TextureID::PropsTreeGreen, {1020.f,1867.f}, PropType::TREE},     // 11
+        {TextureID::PropsTreeGreen, {1120.f,1867.f}, PropType::TREE},     // 12
+        {TextureID::PropsTreeGreen, {1220.f,1867.f}, PropType::TREE},     // 13
+        {TextureID::PropsTreeGreen, {1320.f,1867.f}, PropType::TREE},     // 14
+        {TextureID::PropsTreeGreen, {1420.f,1867.f}, PropType::TREE},     // 15
+        {TextureID::PropsTreeGreen, {1520.f,1867.f}, PropType::TREE},     // 16
+        {TextureID::PropsTreeGreen, {1620.f,1867.f}, PropType::TREE},     // 17
+        {TextureID::PropsTreeGreen, {2720.f,1867.f}, PropType::TREE},     // 28
+        {TextureID::PropsTreeGreen, {2820.f,1867.f}, PropType::TREE},     // 29
+        {TextureID::PropsTreeStump, {2954.f,1956.f}, PropType::STUMP},    // 29
+        {TextureID::PropsTreeGreen, {3120.f,1867.f}, PropType::TREE},     // 32
+        {TextureID::PropsTreeGreen, {3220.f,1867.f}, PropType::TREE},     // 33
+        {TextureID::PropsTreeGreen, {3320.f,1867.f}, PropType::TREE},     // 34
+        {TextureID::PropsTreeFall, {3420.f,1867.f}, PropType::TREE},      // 35
+        {TextureID::PropsTreeGreen, {3700.f,1867.f}, PropType::TREE},     // 36
+        {TextureID::PropsTreeGreen, {3800.f,1867.f}, PropType::TREE},     // 37
+        {TextureID::PropsTreeGreen, {3900.f,1867.f}, PropType::TREE},     // 38
+        {TextureID::PropsTreeGreen, {4000.f,1867.f}, PropType::TREE},     // 39
+        // row20
+        {TextureID::PropsTreeGreen, {0.f,1967.f}, PropType::TREE},        // 1
+        {TextureID::PropsTreeGreen, {100.f,1967.f}, PropType::TREE},      // 2
+        {TextureID::PropsTreeGreen, {700.f,1967.f}, PropType::TREE},      // 8
+        {TextureID::PropsTreeGreen, {800.f,1967.f}, PropType::TREE},      // 9
+        {TextureID::PropsTreeGreen, {1000.f,1967.f}, PropType::TREE},     // 11
+        {TextureID::PropsTreeGreen, {1100.f,1967.f}, PropType::TREE},     // 12
+        {TextureID::PropsTreeGreen, {1300.f,1967.f}, PropType::TREE},     // 14
+        {TextureID::PropsTreeGreen, {1500.f,1967.f}, PropType::TREE},     // 16
+        {TextureID::PropsTreeGreen, {1600.f,1967.f}, PropType::TREE},     // 17
+        {TextureID::PropsTreeGreen, {1800.f,1967.f}, PropType::TREE},     // 19
+        {TextureID::PropsTreeGreen, {1900.f,1967.f}, PropType::TREE},     // 20
+        {TextureID::PropsTreeGreen, {2600.f,1967.f}, PropType::TREE},     // 27
+        {TextureID::PropsTreeGreen, {2700.f,1967.f}, PropType::TREE},     // 28
+        {TextureID::PropsTreeGreen, {2900.f,1967.f}, PropType::TREE},     // 30
+        {TextureID::PropsTreeStump, {3035.f,2053.f}, PropType::STUMP},    // 30
+        {TextureID::PropsTreeGreen, {3100.f,1967.f}, PropType::TREE},     // 32
+        {TextureID::PropsTreeGreen, {3200.f,1967.f}, PropType::TREE},     // 33
+        {TextureID::PropsTreeGreen, {3400.f,1967.f}, PropType::TREE},     // 35
+        {TextureID::PropsTreeGreen, {3500.f,1967.f}, PropType::TREE},     // 35
+        {TextureID::PropsTreeGreen, {3600.f,1967.f}, PropType::TREE},     // 35
+        {TextureID::PropsTreeGreen, {3720.f,1967.f}, PropType::TREE},     // 36
+        {TextureID::PropsTreeGreen, {3820.f,1967.f}, PropType::TREE},     // 37
+        {TextureID::PropsTreeGreen, {3920.f,1967.f}, PropType::TREE},     // 38
+        // row21
+        {TextureID::PropsTreeGreen, {20.f,2067.f}, PropType::TREE},      // 1
+        {TextureID::PropsTreeGreen, {220.f,2067.f}, PropType::TREE},     // 3
+        {TextureID::PropsTreeGreen, {320.f,2067.f}, PropType::TREE},     // 4
+        {TextureID::PropsTreeGreen, {420.f,2067.f}, PropType::TREE},     // 5
+        {TextureID::PropsTreeGreen, {520.f,2067.f}, PropType::TREE},     // 6
+        {TextureID::PropsTreeGreen, {620.f,2067.f}, PropType::TREE},     // 7
+        {TextureID::PropsTreeGreen, {720.f,2067.f}, PropType::TREE},     // 8
+        {TextureID::PropsTreeGreen, {820.f,2067.f}, PropType::TREE},     // 9
+        {TextureID::PropsTreeGreen, {920.f,2067.f}, PropType::TREE},     // 10
+        {TextureID::PropsTreeGreen, {1020.f,2067.f}, PropType::TREE},    // 11
+        {TextureID::PropsTreeGreen, {1120.f,2067.f}, PropType::TREE},    // 12
+        {TextureID::PropsTreeGreen, {1320.f,2067.f}, PropType::TREE},    // 14
+        {TextureID::PropsTreeGreen, {1420.f,2067.f}, PropType::TREE},    // 15
+        {TextureID::PropsTreeGreen, {1820.f,2067.f}, PropType::TREE},    // 19
+        {TextureID::PropsTreeGreen, {2720.f,2067.f}, PropType::TREE},    // 28
+        {TextureID::PropsTreeGreen, {2820.f,2067.f}, PropType::TREE},    // 29
+        {TextureID::PropsTreeGreen, {2920.f,2067.f}, PropType::TREE},    // 30
+        {TextureID::PropsTreeGreen, {3220.f,2067.f}, PropType::TREE},    // 33
+        {TextureID::PropsTreeGreen, {3320.f,2067.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3420.f,2067.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3520.f,2067.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3620.f,2067.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3700.f,2067.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3800.f,2067.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3900.f,2067.f}, PropType::TREE},    // 38
+        {TextureID::PropsTreeGreen, {4000.f,2067.f}, PropType::TREE},    // 39
+        // row22
+        {TextureID::PropsTreeGreen, {0.f,2167.f}, PropType::TREE},       // 1
+        {TextureID::PropsTreeGreen, {100.f,2167.f}, PropType::TREE},     // 2
+        {TextureID::PropsTreeGreen, {200.f,2167.f}, PropType::TREE},     // 3
+        {TextureID::PropsTreeGreen, {300.f,2167.f}, PropType::TREE},     // 4
+        {TextureID::PropsTreeGreen, {400.f,2167.f}, PropType::TREE},     // 5
+        {TextureID::PropsTreeGreen, {600.f,2167.f}, PropType::TREE},     // 7
+        {TextureID::PropsTreeGreen, {700.f,2167.f}, PropType::TREE},     // 8
+        {TextureID::PropsTreeGreen, {800.f,2167.f}, PropType::TREE},     // 9
+        {TextureID::PropsTreeGreen, {900.f,2167.f}, PropType::TREE},     // 10
+        {TextureID::PropsTreeGreen, {1000.f,2167.f}, PropType::TREE},    // 11
+        {TextureID::PropsTreeGreen, {1600.f,2167.f}, PropType::TREE},    // 17
+        {TextureID::PropsTreeGreen, {1700.f,2167.f}, PropType::TREE},    // 18
+        {TextureID::PropsTreeGreen, {1800.f,2167.f}, PropType::TREE},    // 19
+        {TextureID::PropsTreeGreen, {1900.f,2167.f}, PropType::TREE},    // 20
+        {TextureID::PropsTreeGreen, {2600.f,2167.f}, PropType::TREE},    // 27
+        {TextureID::PropsTreeGreen, {2700.f,2167.f}, PropType::TREE},    // 28
+        {TextureID::PropsTreeGreen, {2800.f,2167.f}, PropType::TREE},    // 29
+        {TextureID::PropsTreeGreen, {2900.f,2167.f}, PropType::TREE},    // 30
+        {TextureID::PropsTreeGreen, {3000.f,2167.f}, PropType::TREE},    // 31
+        {TextureID::PropsTreeGreen, {3100.f,2167.f}, PropType::TREE},    // 32
+        {TextureID::PropsTreeGreen, {3200.f,2167.f}, PropType::TREE},    // 33
+        {TextureID::PropsTreeGreen, {3300.f,2167.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3400.f,2167.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3500.f,2167.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3600.f,2167.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3720.f,2167.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3820.f,2167.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3920.f,2167.f}, PropType::TREE},    // 38
+        // row21
+        {TextureID::PropsTreeGreen, {20.f,2267.f}, PropType::TREE},      // 1
+        {TextureID::PropsTreeGreen, {120.f,2267.f}, PropType::TREE},     // 2
+        {TextureID::PropsTreeGreen, {220.f,2267.f}, PropType::TREE},     // 3
+        {TextureID::PropsTreeGreen, {320.f,2267.f}, PropType::TREE},     // 4
+        {TextureID::PropsTreeGreen, {420.f,2267.f}, PropType::TREE},     // 5
+        {TextureID::PropsTreeGreen, {520.f,2267.f}, PropType::TREE},     // 6
+        {TextureID::PropsTreeGreen, {620.f,2267.f}, PropType::TREE},     // 7
+        {TextureID::PropsTreeGreen, {720.f,2267.f}, PropType::TREE},     // 8
+        {TextureID::PropsTreeGreen, {820.f,2267.f}, PropType::TREE},     // 9
+        {TextureID::PropsTreeGreen, {920.f,2267.f}, PropType::TREE},     // 10
+        {TextureID::PropsTreeGreen, {1020.f,2267.f}, PropType::TREE},    // 11
+        {TextureID::PropsTreeGreen, {1120.f,2267.f}, PropType::TREE},    // 12
+        {TextureID::PropsTreeGreen, {1220.f,2267.f}, PropType::TREE},    // 13
+        {TextureID::PropsTreeGreen, {1320.f,2267.f}, PropType::TREE},    // 14
+        {TextureID::PropsTreeGreen, {1420.f,2267.f}, PropType::TREE},    // 15
+        {TextureID::PropsTreeGreen, {1520.f,2267.f}, PropType::TREE},    // 16
+        {TextureID::PropsTreeGreen, {1720.f,2267.f}, PropType::TREE},    // 18
+        {TextureID::PropsTreeGreen, {1820.f,2267.f}, PropType::TREE},    // 19
+        {TextureID::PropsTreeGreen, {2620.f,2267.f}, PropType::TREE},    // 27
+        {TextureID::PropsTreeGreen, {2720.f,2267.f}, PropType::TREE},    // 28
+        {TextureID::PropsTreeGreen, {2820.f,2267.f}, PropType::TREE},    // 29
+        {TextureID::PropsTreeGreen, {2920.f,2267.f}, PropType::TREE},    // 30
+        {TextureID::PropsTreeGreen, {3020.f,2267.f}, PropType::TREE},    // 31
+        {TextureID::PropsTreeGreen, {3120.f,2267.f}, PropType::TREE},    // 32
+        {TextureID::PropsTreeGreen, {3220.f,2267.f}, PropType::TREE},    // 33
+        {TextureID::PropsTreeGreen, {3320.f,2267.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3420.f,2267.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3520.f,2267.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3620.f,2267.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3700.f,2267.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3800.f,2267.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3900.f,2267.f}, PropType::TREE},    // 38
+        {TextureID::PropsTreeGreen, {4000.f,2267.f}, PropType::TREE},    // 39
+        // row22
+        {TextureID::PropsTreeGreen, {50.f,2367.f}, PropType::TREE},      // 1
+        {TextureID::PropsTreeClear, {550.f,2303.f}, PropType::TREE},     // 6 Invisible Wall
+        {TextureID::PropsTreeGreen, {550.f,2367.f}, PropType::TREE},     // 6
+        {TextureID::PropsTreeGreen, {700.f,2367.f}, PropType::TREE},     // 8
+        {TextureID::PropsTreeGreen, {800.f,2367.f}, PropType::TREE},     // 9
+        {TextureID::PropsTreeGreen, {1000.f,2367.f}, PropType::TREE},    // 11
+        {TextureID::PropsTreeGreen, {1100.f,2367.f}, PropType::TREE},    // 12
+        {TextureID::PropsTreeGreen, {1200.f,2367.f}, PropType::TREE},    // 13
+        {TextureID::PropsTreeGreen, {1300.f,2367.f}, PropType::TREE},    // 14
+        {TextureID::PropsTreeGreen, {1400.f,2367.f}, PropType::TREE},    // 15
+        {TextureID::PropsTreeGreen, {1600.f,2367.f}, PropType::TREE},    // 17
+        {TextureID::PropsTreeGreen, {1800.f,2367.f}, PropType::TREE},    // 19
+        {TextureID::PropsTreeGreen, {2600.f,2340.f}, PropType::TREE},    // 27
+        {TextureID::PropsTreeGreen, {2700.f,2340.f}, PropType::TREE},    // 28
+        {TextureID::PropsTreeGreen, {2800.f,2340.f}, PropType::TREE},    // 29
+        {TextureID::PropsTreeGreen, {2900.f,2340.f}, PropType::TREE},    // 30
+        {TextureID::PropsTreeGreen, {3000.f,2340.f}, PropType::TREE},    // 31
+        {TextureID::PropsTreeGreen, {3100.f,2340.f}, PropType::TREE},    // 32
+        {TextureID::PropsTreeGreen, {3200.f,2340.f}, PropType::TREE},    // 33
+        {TextureID::PropsTreeGreen, {3300.f,2340.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3400.f,2340.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3500.f,2340.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3600.f,2340.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3720.f,2340.f}, PropType::TREE},    // 38
+        {TextureID::PropsTreeGreen, {3820.f,2340.f}, PropType::TREE},    // 39
+        {TextureID::PropsTreeGreen, {3920.f,2340.f}, PropType::TREE},    // 40
+        // row23
+        {TextureID::PropsTreeGreen, {20.f,2467.f}, PropType::TREE},      // 1
+        {TextureID::PropsTreeClear, {620.f,2403.f}, PropType::TREE},     // 7 Invisible Wall
+        {TextureID::PropsTreeGreen, {620.f,2467.f}, PropType::TREE},     // 7
+        {TextureID::PropsTreeGreen, {720.f,2467.f}, PropType::TREE},     // 8
+        {TextureID::PropsTreeGreen, {820.f,2467.f}, PropType::TREE},     // 9
+        {TextureID::PropsTreeGreen, {920.f,2467.f}, PropType::TREE},     // 10
+        {TextureID::PropsTreeGreen, {1020.f,2467.f}, PropType::TREE},    // 11
+        {TextureID::PropsTreeGreen, {1120.f,2467.f}, PropType::TREE},    // 12
+        {TextureID::PropsTreeGreen, {1220.f,2467.f}, PropType::TREE},    // 13
+        {TextureID::PropsTreeGreen, {1320.f,2467.f}, PropType::TREE},    // 14
+        {TextureID::PropsTreeGreen, {1420.f,2467.f}, PropType::TREE},    // 15
+        {TextureID::PropsTreeGreen, {1520.f,2467.f}, PropType::TREE},    // 16
+        {TextureID::PropsTreeGreen, {1620.f,2467.f}, PropType::TREE},    // 17
+        {TextureID::PropsTreeGreen, {1720.f,2467.f}, PropType::TREE},    // 18
+        {TextureID::PropsTreeGreen, {1820.f,2467.f}, PropType::TREE},    // 19
+        {TextureID::PropsTreeGreen, {1920.f,2467.f}, PropType::TREE},    // 20
+        // row24
+        {TextureID::PropsTreeGreen, {50.f,2567.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {650.f,2567.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {1980.f,2567.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2490.f,2567.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2590.f,2567.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2800.f,2567.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {3920.f,2567.f}, PropType::TREE},
+        // row25
+        {TextureID::PropsTreeGreen, {20.f,2667.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {620.f,2667.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2420.f,2667.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2520.f,2667.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2820.f,2667.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {4000.f,2667.f}, PropType::TREE},
+        // row26
+        {TextureID::PropsTreeGreen, {50.f,2767.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {100.f,2767.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {550.f,2767.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {650.f,2767.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {1980.f,2767.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2490.f,2767.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2590.f,2767.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2800.f,2767.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {3920.f,2767.f}, PropType::TREE},
+        // row27
+        {TextureID::PropsTreeGreen, {20.f,2867.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {120.f,2867.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {520.f,2867.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {620.f,2867.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2420.f,2867.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2520.f,2867.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2820.f,2867.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {4000.f,2867.f}, PropType::TREE},
+        // row28
+        {TextureID::PropsTreeGreen, {50.f,2967.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {150.f,2967.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {450.f,2967.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {550.f,2967.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {650.f,2967.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {1980.f,2967.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2490.f,2967.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2590.f,2967.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {3920.f,2967.f}, PropType::TREE},
+        // row29
+        {TextureID::PropsTreeGreen, {20.f,3067.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {120.f,3067.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {220.f,3067.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {420.f,3067.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {520.f,3067.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {620.f,3067.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2420.f,3067.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2520.f,3067.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {4000.f,3067.f}, PropType::TREE},
+        // row30
+        {TextureID::PropsTreeGreen, {50.f,3167.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {150.f,3167.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {250.f,3167.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {450.f,3167.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {550.f,3167.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {650.f,3167.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {1980.f,3167.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2490.f,3167.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2590.f,3167.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {3920.f,3167.f}, PropType::TREE},
+        // row31
+        {TextureID::PropsTreeGreen, {20.f,3267.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {120.f,3267.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {220.f,3267.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {530.f,3267.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {620.f,3267.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2420.f,3267.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2520.f,3267.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {4000.f,3267.f}, PropType::TREE},
+        // row32
+        {TextureID::PropsTreeGreen, {50.f,3367.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {150.f,3367.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {250.f,3367.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {350.f,3367.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {650.f,3367.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2490.f,3367.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2590.f,3367.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {3920.f,3367.f}, PropType::TREE},
+        // row33
+        {TextureID::PropsTreeGreen, {20.f,3467.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {120.f,3467.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {220.f,3467.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {320.f,3467.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {420.f,3467.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {620.f,3467.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2420.f,3467.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2520.f,3467.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2620.f,3467.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2720.f,3467.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {4000.f,3467.f}, PropType::TREE},
+        // row34
+        {TextureID::PropsTreeGreen, {0.f,3567.f}, PropType::TREE},       // 1
+        {TextureID::PropsTreeGreen, {150.f,3567.f}, PropType::TREE},     // 2
+        {TextureID::PropsTreeGreen, {250.f,3567.f}, PropType::TREE},     // 3
+        {TextureID::PropsTreeGreen, {350.f,3567.f}, PropType::TREE},     // 4
+        {TextureID::PropsTreeGreen, {665.f,3530.f}, PropType::TREE},     // 6
+        {TextureID::PropsTreeGreen, {3920.f,3567.f}, PropType::TREE},    // 21
+        {TextureID::PropsTreeGreen, {2320.f,3667.f}, PropType::TREE},    // 21
+        {TextureID::PropsTreeGreen, {2520.f,3667.f}, PropType::TREE},    // 21
+        {TextureID::PropsTreeGreen, {2620.f,3667.f}, PropType::TREE},    // 21
+        // row35
+        {TextureID::PropsTreeGreen, {200.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {300.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {500.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {800.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {900.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {1600.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {1700.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {1800.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {1900.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2000.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2200.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2300.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2400.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2600.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2700.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {2900.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {3000.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {3100.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {3300.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {3800.f,3740.f}, PropType::TREE},
+        {TextureID::PropsTreeGreen, {3900.f,3740.f}, PropType::TREE},
+        // row36
+        {TextureID::PropsTreeGreen, {20.f,3840.f}, PropType::TREE},      // 1
+        {TextureID::PropsTreeGreen, {120.f,3840.f}, PropType::TREE},     // 2
+        {TextureID::PropsTreeGreen, {220.f,3840.f}, PropType::TREE},     // 3
+        {TextureID::PropsTreeGreen, {420.f,3840.f}, PropType::TREE},     // 5
+        {TextureID::PropsTreeGreen, {520.f,3840.f}, PropType::TREE},     // 6
+        {TextureID::PropsTreeGreen, {720.f,3840.f}, PropType::TREE},     // 8
+        {TextureID::PropsTreeGreen, {820.f,3840.f}, PropType::TREE},     // 9
+        {TextureID::PropsTreeGreen, {1020.f,3840.f}, PropType::TREE},    // 11
+        {TextureID::PropsTreeGreen, {1120.f,3840.f}, PropType::TREE},    // 12
+        {TextureID::PropsTreeGreen, {1220.f,3840.f}, PropType::TREE},    // 13
+        {TextureID::PropsTreeGreen, {1420.f,3840.f}, PropType::TREE},    // 15
+        {TextureID::PropsTreeGreen, {1520.f,3840.f}, PropType::TREE},    // 16
+        {TextureID::PropsTreeGreen, {1620.f,3840.f}, PropType::TREE},    // 17
+        {TextureID::PropsTreeGreen, {1720.f,3840.f}, PropType::TREE},    // 18
+        {TextureID::PropsTreeGreen, {1920.f,3840.f}, PropType::TREE},    // 20
+        {TextureID::PropsTreeGreen, {2020.f,3840.f}, PropType::TREE},    // 21
+        {TextureID::PropsTreeGreen, {2120.f,3840.f}, PropType::TREE},    // 22
+        {TextureID::PropsTreeGreen, {2320.f,3840.f}, PropType::TREE},    // 24
+        {TextureID::PropsTreeGreen, {2420.f,3840.f}, PropType::TREE},    // 25
+        {TextureID::PropsTreeGreen, {2520.f,3840.f}, PropType::TREE},    // 26
+        {TextureID::PropsTreeGreen, {2720.f,3840.f}, PropType::TREE},    // 28
+        {TextureID::PropsTreeGreen, {2820.f,3840.f}, PropType::TREE},    // 29
+        {TextureID::PropsTreeGreen, {2920.f,3840.f}, PropType::TREE},    // 30
+        {TextureID::PropsTreeGreen, {3020.f,3840.f}, PropType::TREE},    // 31
+        {TextureID::PropsTreeGreen, {3120.f,3840.f}, PropType::TREE},    // 32
+        {TextureID::PropsTreeGreen, {3420.f,3840.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3520.f,3840.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3720.f,3840.f}, PropType::TREE},    // 38
+        {TextureID::PropsTreeGreen, {3820.f,3840.f}, PropType::TREE},    // 39
+        {TextureID::PropsTreeGreen, {3920.f,3840.f}, PropType::TREE},    // 40
+        // row37
+        {TextureID::PropsTreeGreen, {0.f,3940.f}, PropType::TREE},       // 1
+        {TextureID::PropsTreeGreen, {100.f,3940.f}, PropType::TREE},     // 2
+        {TextureID::PropsTreeGreen, {200.f,3940.f}, PropType::TREE},     // 3
+        {TextureID::PropsTreeGreen, {300.f,3940.f}, PropType::TREE},     // 4
+        {TextureID::PropsTreeGreen, {400.f,3940.f}, PropType::TREE},     // 5
+        {TextureID::PropsTreeGreen, {500.f,3940.f}, PropType::TREE},     // 6
+        {TextureID::PropsTreeGreen, {600.f,3940.f}, PropType::TREE},     // 7
+        {TextureID::PropsTreeGreen, {700.f,3940.f}, PropType::TREE},     // 8
+        {TextureID::PropsTreeGreen, {800.f,3940.f}, PropType::TREE},     // 9
+        {TextureID::PropsTreeGreen, {900.f,3940.f}, PropType::TREE},     // 10
+        {TextureID::PropsTreeGreen, {1000.f,3940.f}, PropType::TREE},    // 11
+        {TextureID::PropsTreeGreen, {1100.f,3940.f}, PropType::TREE},    // 12
+        {TextureID::PropsTreeGreen, {1200.f,3940.f}, PropType::TREE},    // 13
+        {TextureID::PropsTreeGreen, {1300.f,3940.f}, PropType::TREE},    // 14
+        {TextureID::PropsTreeGreen, {1400.f,3940.f}, PropType::TREE},    // 15
+        {TextureID::PropsTreeGreen, {1500.f,3940.f}, PropType::TREE},    // 16
+        {TextureID::PropsTreeGreen, {1600.f,3940.f}, PropType::TREE},    // 17
+        {TextureID::PropsTreeGreen, {1700.f,3940.f}, PropType::TREE},    // 18
+        {TextureID::PropsTreeGreen, {1800.f,3940.f}, PropType::TREE},    // 19
+        {TextureID::PropsTreeGreen, {1900.f,3940.f}, PropType::TREE},    // 20
+        {TextureID::PropsTreeGreen, {2000.f,3940.f}, PropType::TREE},    // 21
+        {TextureID::PropsTreeGreen, {2100.f,3940.f}, PropType::TREE},    // 22
+        {TextureID::PropsTreeGreen, {2200.f,3940.f}, PropType::TREE},    // 23
+        {TextureID::PropsTreeGreen, {2300.f,3940.f}, PropType::TREE},    // 24
+        {TextureID::PropsTreeGreen, {2400.f,3940.f}, PropType::TREE},    // 25
+        {TextureID::PropsTreeGreen, {2500.f,3940.f}, PropType::TREE},    // 26
+        {TextureID::PropsTreeGreen, {2600.f,3940.f}, PropType::TREE},    // 27
+        {TextureID::PropsTreeGreen, {2700.f,3940.f}, PropType::TREE},    // 28
+        {TextureID::PropsTreeGreen, {2800.f,3940.f}, PropType::TREE},    // 29
+        {TextureID::PropsTreeGreen, {2900.f,3940.f}, PropType::TREE},    // 30
+        {TextureID::PropsTreeGreen, {3000.f,3940.f}, PropType::TREE},    // 31
+        {TextureID::PropsTreeGreen, {3100.f,3940.f}, PropType::TREE},    // 32
+        {TextureID::PropsTreeGreen, {3200.f,3940.f}, PropType::TREE},    // 33
+        {TextureID::PropsTreeGreen, {3300.f,3940.f}, PropType::TREE},    // 34
+        {TextureID::PropsTreeGreen, {3400.f,3940.f}, PropType::TREE},    // 35
+        {TextureID::PropsTreeGreen, {3500.f,3940.f}, PropType::TREE},    // 36
+        {TextureID::PropsTreeGreen, {3600.f,3940.f}, PropType::TREE},    // 37
+        {TextureID::PropsTreeGreen, {3700.f,3940.f}, PropType::TREE},    // 38
+        {TextureID::PropsTreeGreen, {3800.f,3940.f}, PropType::TREE},    // 39
+        {TextureID::PropsTreeGreen, {3900.f,3940.f}, PropType::TREE},    // 40
+        {TextureID::PropsTreeGreen, {4000.f,3940.f}, PropType::TREE},    // 41
+        // large tree
+        {TextureID::PropsTreeGreen, {2185.f,2050.f}, PropType::TREE, 8.f},
+    })};
+
+    inline constexpr auto GrassUnder{std::to_array<Vector2>({
+        // ---------------------------------------------- Left Map Grass -----------------------------------------------
+        // ---------------------------------------------------- -4 ------------------------------------------------------
+        Vector2{145.f,940.f},
+        Vector2{145.f,980.f},
+        Vector2{209.f,940.f},
+        Vector2{209.f,980.f},
+        Vector2{145.f,1004.f},
+        Vector2{145.f,1044.f},
+        Vector2{209.f,1004.f},
+        Vector2{209.f,1044.f},
+        Vector2{209.f,1068.f},
+        Vector2{110.f,1064.f},
+        Vector2{174.f,1064.f},
+        // ---------------------------------------------------- -3 ------------------------------------------------------
+        Vector2{145.f,812.f},
+        Vector2{145.f,852.f},
+        Vector2{209.f,812.f},
+        Vector2{209.f,852.f},
+        Vector2{145.f,876.f},
+        Vector2{145.f,916.f},
+        Vector2{209.f,876.f},
+        Vector2{209.f,916.f},
+        // ---------------------------------------------------- -2 ------------------------------------------------------
+        Vector2{145.f,684.f},
+        Vector2{145.f,724.f},
+        Vector2{209.f,684.f},
+        Vector2{209.f,724.f},
+        Vector2{145.f,748.f},
+        Vector2{145.f,788.f},
+        Vector2{209.f,748.f},
+        Vector2{209.f,788.f},
+        // ---------------------------------------------------- -1 ------------------------------------------------------
+        Vector2{209.f,492.f},
+        Vector2{209.f,532.f},
+        Vector2{273.f,492.f},
+        Vector2{273.f,532.f},
+
+        Vector2{273.f,556.f},
+        Vector2{273.f,596.f},
+        Vector2{209.f,556.f},
+        Vector2{209.f,596.f},
+        Vector2{273.f,620.f},
+        Vector2{273.f,660.f},
+        Vector2{209.f,620.f},
+        Vector2{209.f,660.f},
+        Vector2{273.f,684.f},
+        Vector2{273.f,724.f},
+
+        Vector2{273.f,748.f},
+        Vector2{273.f,788.f},
+        Vector2{273.f,812.f},
+        Vector2{273.f,852.f},
+        Vector2{273.f,876.f},
+        Vector2{273.f,916.f},
+        Vector2{273.f,940.f},
+        Vector2{273.f,980.f},
+        Vector2{273.f,1004.f},
+        Vector2{273.f,1044.f},
+        // --------------------------------------------- --------------- -----------------------------------------------
+        Vector2{302.f,488.f},
+        Vector2{302.f,512.f},
+        Vector2{366.f,424.f},
+        Vector2{366.f,448.f},
+        Vector2{366.f,808.f},
+        Vector2{366.f,832.f},
+
+        Vector2{337.f,404.f},
+        Vector2{337.f,428.f},
+        Vector2{337.f,468.f},
+        Vector2{337.f,492.f},
+        Vector2{337.f,620.f},
+        Vector2{337.f,660.f},
+        Vector2{337.f,684.f},
+        Vector2{337.f,724.f},
+        Vector2{337.f,748.f},
+        Vector2{337.f,788.f},
+        Vector2{337.f,812.f},
+        Vector2{337.f,852.f},
+
+        Vector2{401.f,492.f},
+        Vector2{401.f,532.f},
+        Vector2{465.f,492.f},
+        Vector2{465.f,532.f},
+
+        Vector2{401.f,556.f},
+        Vector2{401.f,596.f},
+        Vector2{465.f,556.f},
+        Vector2{465.f,596.f},
+        Vector2{401.f,620.f},
+        Vector2{401.f,660.f},
+        Vector2{465.f,620.f},
+        Vector2{465.f,660.f},
+        Vector2{401.f,684.f},
+        Vector2{401.f,724.f},
+        Vector2{465.f,684.f},
+        Vector2{465.f,724.f},
+        Vector2{401.f,748.f},
+        Vector2{465.f,748.f},
+        Vector2{465.f,724.f},
+        Vector2{401.f,788.f},
+        Vector2{465.f,788.f},
+        Vector2{401.f,812.f},
+        Vector2{529.f,724.f},
+
+        // --------------------------------------------- Far Left Column -----------------------------------------------
+        // ---------------------------------------------------- -4 ------------------------------------------------------
+        Vector2{1816.f,1806.f},
+        Vector2{1816.f,1846.f},
+        Vector2{1880.f,1806.f},
+        Vector2{1880.f,1846.f},
+        Vector2{1816.f,1870.f},
+        Vector2{1816.f,1910.f},
+        Vector2{1880.f,1870.f},
+        Vector2{1880.f,1910.f},
+        // ---------------------------------------------------- -3 ------------------------------------------------------
+        Vector2{1816.f,1678.f},
+        Vector2{1816.f,1718.f},
+        Vector2{1880.f,1678.f},
+        Vector2{1880.f,1718.f},
+        Vector2{1816.f,1742.f},
+        Vector2{1816.f,1782.f},
+        Vector2{1880.f,1742.f},
+        Vector2{1880.f,1782.f},
+        // ---------------------------------------------------- -2 ------------------------------------------------------
+        Vector2{1816.f,1614.f},
+        Vector2{1816.f,1654.f},
+        Vector2{1880.f,1614.f},
+        Vector2{1880.f,1654.f},
+        // ---------------------------------------------------- -1 ------------------------------------------------------
+        Vector2{2008.f,1358.f},
+        Vector2{2008.f,1398.f},
+        // ----------------------------------------------------- 0 ------------------------------------------------------
+        Vector2{1944.f,1442.f},
+        Vector2{1944.f,1462.f},
+        Vector2{2008.f,1442.f},
+        Vector2{2008.f,1462.f},
+        Vector2{1944.f,1486.f},
+        Vector2{1944.f,1526.f},
+        Vector2{2008.f,1486.f},
+        Vector2{2008.f,1526.f},
+        // ----------------------------------------------------- 1 ------------------------------------------------------
+        Vector2{1944.f,1550.f},
+        Vector2{1944.f,1590.f},
+        Vector2{2008.f,1550.f},
+        Vector2{2008.f,1590.f},
+        Vector2{1944.f,1614.f},
+        Vector2{1944.f,1654.f},
+        Vector2{2008.f,1614.f},
+        Vector2{2008.f,1654.f},
+        // ----------------------------------------------------- 2 ------------------------------------------------------
+        Vector2{1944.f,1678.f},
+        Vector2{1944.f,1718.f},
+        Vector2{2008.f,1678.f},
+        Vector2{2008.f,1718.f},
+        Vector2{1944.f,1742.f},
+        Vector2{1944.f,1782.f},
+        Vector2{2008.f,1742.f},
+        Vector2{2008.f,1782.f},
+        // ------------------------------------------------------ 3 ------------------------------------------------------
+        Vector2{1944.f,1806.f},
+        Vector2{1944.f,1846.f},
+        Vector2{2008.f,1806.f},
+        Vector2{2008.f,1846.f},
+        Vector2{1944.f,1870.f},
+        Vector2{1944.f,1910.f},
+        Vector2{2008.f,1870.f},
+        Vector2{2008.f,1910.f},
+        // ------------------------------------------------------ 3 ------------------------------------------------------
+        Vector2{1944.f,1806.f},
+        Vector2{1944.f,1846.f},
+        Vector2{2008.f,1806.f},
+        Vector2{2008.f,1846.f},
+        Vector2{1944.f,1870.f},
+        Vector2{1944.f,1910.f},
+        Vector2{2008.f,1870.f},
+        Vector2{2008.f,1910.f},
+        // ----------------------------------------------------- 4 ------------------------------------------------------
+        Vector2{1944.f,1934.f},
+        Vector2{1944.f,1974.f},
+        Vector2{2008.f,1934.f},
+        Vector2{2008.f,1974.f},
+        Vector2{1944.f,1998.f},
+        Vector2{1944.f,2038.f},
+        Vector2{2008.f,1998.f},
+        Vector2{2008.f,2038.f},
+        // ------------------------------------------------ Left Column ------------------------------------------------
+        // ---------------------------------------------------- -1 ------------------------------------------------------
+        Vector2{2072.f,1294.f},
+        Vector2{2072.f,1334.f},
+        // Vector2{2136.f,1294.f},
+        Vector2{2136.f,1334.f},
+        Vector2{2072.f,1358.f},
+        Vector2{2072.f,1398.f},
+        Vector2{2136.f,1358.f},
+        Vector2{2136.f,1398.f},
+        // ---------------------------------------------------- 0 ------------------------------------------------------
+        Vector2{2072.f,1422.f},
+        Vector2{2072.f,1462.f},
+        Vector2{2136.f,1422.f},
+        Vector2{2136.f,1462.f},
+        Vector2{2072.f,1486.f},
+        Vector2{2072.f,1526.f},
+        Vector2{2136.f,1486.f},
+        Vector2{2136.f,1526.f},
+        // ---------------------------------------------------- 1 ------------------------------------------------------
+        Vector2{2072.f,1550.f},
+        Vector2{2072.f,1590.f},
+        Vector2{2136.f,1550.f},
+        Vector2{2136.f,1590.f},
+        Vector2{2072.f,1614.f},
+        Vector2{2072.f,1654.f},
+        Vector2{2136.f,1614.f},
+        Vector2{2136.f,1654.f},
+        // --------------------------------------------------- 2 -------------------------------------------------------
+        Vector2{2072.f,1678.f},
+        Vector2{2072.f,1718.f},
+        Vector2{2136.f,1678.f},
+        Vector2{2136.f,1718.f},
+        Vector2{2072.f,1742.f},
+        Vector2{2072.f,1782.f},
+        Vector2{2136.f,1742.f},
+        Vector2{2136.f,1782.f},
+        // --------------------------------------------------- 3 -------------------------------------------------------
+        Vector2{2072.f,1806.f},
+        Vector2{2072.f,1846.f},
+        Vector2{2136.f,1806.f},
+        Vector2{2136.f,1846.f},
+        Vector2{2072.f,1870.f},
+        Vector2{2072.f,1910.f},
+        Vector2{2136.f,1870.f},
+        Vector2{2136.f,1910.f},
+        // --------------------------------------------------- 4 -------------------------------------------------------
+        Vector2{2072.f,1934.f},
+        Vector2{2072.f,1974.f},
+        Vector2{2136.f,1934.f},
+        Vector2{2136.f,1974.f},
+        Vector2{2072.f,1998.f},
+        Vector2{2072.f,2038.f},
+        Vector2{2136.f,1998.f},
+        Vector2{2136.f,2038.f},
+        // --------------------------------------------- Far Right Column ----------------------------------------------
+        // --------------------------------------------------- -6 -------------------------------------------------------
+        Vector2{2456.f,1934.f},
+        Vector2{2456.f,1974.f},
+        Vector2{2520.f,1934.f},
+        Vector2{2520.f,1974.f},
+        Vector2{2456.f,1998.f},
+        Vector2{2456.f,2038.f},
+        Vector2{2520.f,1998.f},
+        // --------------------------------------------------- -5 -------------------------------------------------------
+        Vector2{2456.f,1806.f},
+        Vector2{2456.f,1846.f},
+        Vector2{2520.f,1806.f},
+        Vector2{2520.f,1846.f},
+        Vector2{2456.f,1870.f},
+        Vector2{2456.f,1910.f},
+        Vector2{2520.f,1870.f},
+        Vector2{2520.f,1910.f},
+        // --------------------------------------------------- -4 -------------------------------------------------------
+        Vector2{2456.f,1678.f},
+        Vector2{2456.f,1718.f},
+        Vector2{2520.f,1678.f},
+        Vector2{2520.f,1718.f},
+        Vector2{2456.f,1742.f},
+        Vector2{2456.f,1782.f},
+        Vector2{2520.f,1742.f},
+        Vector2{2520.f,1782.f},
+        // --------------------------------------------------- -3 -------------------------------------------------------
+        Vector2{2456.f,1614.f},
+        Vector2{2456.f,1654.f},
+        Vector2{2520.f,1614.f},
+        Vector2{2520.f,1654.f},
+        // --------------------------------------------------- -2 -------------------------------------------------------
+        Vector2{2456.f,1526.f},
+        Vector2{2520.f,1486.f},
+        Vector2{2520.f,1526.f},
+        // --------------------------------------------------- -1 -------------------------------------------------------
+        Vector2{2328.f,1334.f},
+        Vector2{2392.f,1294.f},
+        Vector2{2392.f,1334.f},
+        Vector2{2328.f,1358.f},
+        Vector2{2328.f,1398.f},
+        Vector2{2392.f,1358.f},
+        Vector2{2392.f,1398.f},
+        // --------------------------------------------------- 0 -------------------------------------------------------
+        Vector2{2328.f,1422.f},
+        Vector2{2328.f,1462.f},
+        Vector2{2392.f,1422.f},
+        Vector2{2392.f,1462.f},
+        Vector2{2328.f,1486.f},
+        Vector2{2328.f,1526.f},
+        Vector2{2392.f,1486.f},
+        Vector2{2392.f,1526.f},
+        // --------------------------------------------------- 1 -------------------------------------------------------
+        Vector2{2328.f,1550.f},
+        Vector2{2328.f,1590.f},
+        Vector2{2392.f,1550.f},
+        Vector2{2392.f,1590.f},
+        Vector2{2328.f,1614.f},
+        Vector2{2328.f,1654.f},
+        Vector2{2392.f,1614.f},
+        Vector2{2392.f,1654.f},
+        // --------------------------------------------------- 2 -------------------------------------------------------
+        Vector2{2328.f,1678.f},
+        Vector2{2328.f,1718.f},
+        Vector2{2392.f,1678.f},
+        Vector2{2392.f,1718.f},
+        Vector2{2328.f,1742.f},
+        Vector2{2328.f,1782.f},
+        Vector2{2392.f,1742.f},
+        Vector2{2392.f,1782.f},
+        // --------------------------------------------------- 3 -------------------------------------------------------
+        Vector2{2328.f,1806.f},
+        Vector2{2328.f,1846.f},
+        Vector2{2392.f,1806.f},
+        Vector2{2392.f,1846.f},
+        Vector2{2328.f,1870.f},
+        Vector2{2328.f,1910.f},
+        Vector2{2392.f,1870.f},
+        Vector2{2392.f,1910.f},
+        // --------------------------------------------------- 4 -------------------------------------------------------
+        Vector2{2328.f,1934.f},
+        Vector2{2328.f,1974.f},
+        Vector2{2392.f,1934.f},
+        Vector2{2392.f,1974.f},
+        Vector2{2328.f,1998.f},
+        Vector2{2328.f,2038.f},
+        Vector2{2392.f,1998.f},
+        Vector2{2392.f,2038.f},
+        // ------------------------------------------------ Right Column -----------------------------------------------
+        // --------------------------------------------------- -1 -------------------------------------------------------
+        Vector2{2200.f,1334.f},
+        Vector2{2264.f,1334.f},
+        Vector2{2200.f,1358.f},
+        Vector2{2200.f,1398.f},
+        Vector2{2264.f,1358.f},
+        Vector2{2264.f,1398.f},
+        // --------------------------------------------------- 0 -------------------------------------------------------
+        Vector2{2200.f,1422.f},
+        Vector2{2200.f,1462.f},
+        Vector2{2264.f,1422.f},
+        Vector2{2264.f,1462.f},
+        Vector2{2200.f,1486.f},
+        Vector2{2200.f,1526.f},
+        Vector2{2264.f,1486.f},
+        Vector2{2264.f,1526.f},
+        // --------------------------------------------------- 1 -------------------------------------------------------
+        Vector2{2200.f,1550.f},
+        Vector2{2200.f,1590.f},
+        Vector2{2264.f,1550.f},
+        Vector2{2264.f,1590.f},
+        Vector2{2200.f,1614.f},
+        Vector2{2200.f,1654.f},
+        Vector2{2264.f,1614.f},
+        Vector2{2264.f,1654.f},
+        // --------------------------------------------------- 2 -------------------------------------------------------
+        Vector2{2200.f,1678.f},
+        Vector2{2200.f,1718.f},
+        Vector2{2264.f,1678.f},
+        Vector2{2264.f,1718.f},
+        Vector2{2200.f,1742.f},
+        Vector2{2200.f,1782.f},
+        Vector2{2264.f,1742.f},
+        Vector2{2264.f,1782.f},
+        // --------------------------------------------------- 3 -------------------------------------------------------
+        Vector2{2200.f,1806.f},
+        Vector2{2200.f,1846.f},
+        Vector2{2264.f,1806.f},
+        Vector2{2264.f,1846.f},
+        Vector2{2200.f,1870.f},
+        Vector2{2200.f,1910.f},
+        Vector2{2264.f,1870.f},
+        Vector2{2264.f,1910.f},
+        // --------------------------------------------------- 4 -------------------------------------------------------
+        Vector2{2200.f,1934.f},
+        Vector2{2200.f,1974.f},
+        Vector2{2264.f,1934.f},
+        Vector2{2264.f,1974.f},
+        Vector2{2200.f,1998.f},
+        Vector2{2200.f,2038.f},
+        Vector2{2264.f,1998.f},
+        Vector2{2264.f,2038.f},
+        // --------------------------------------------------------------------------------------------------------------
+        // -----------------------------------------Dungeon Entrance Grass-----------------------------------------------
+        // --------------------------------------------------------------------------------------------------------------
+        // ------------------------------------------------ Left Column -------------------------------------------------
+        Vector2{3500.f,170.f},
+        Vector2{3500.f,210.f},
+        Vector2{3564.f,170.f},
+        Vector2{3564.f,210.f},
+        Vector2{3500.f,234.f},
+        Vector2{3500.f,274.f},
+        Vector2{3564.f,234.f},
+        Vector2{3564.f,274.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3500.f,298.f},
+        Vector2{3500.f,338.f},
+        Vector2{3564.f,298.f},
+        Vector2{3564.f,338.f},
+        Vector2{3500.f,362.f},
+        Vector2{3500.f,402.f},
+        Vector2{3564.f,362.f},
+        Vector2{3564.f,402.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3500.f,426.f},
+        Vector2{3500.f,446.f},
+        Vector2{3564.f,426.f},
+        Vector2{3564.f,446.f},
+        Vector2{3500.f,490.f},
+        Vector2{3500.f,530.f},
+        Vector2{3564.f,490.f},
+        Vector2{3564.f,530.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3500.f,554.f},
+        Vector2{3500.f,594.f},
+        Vector2{3564.f,554.f},
+        Vector2{3564.f,594.f},
+        Vector2{3500.f,618.f},
+        Vector2{3500.f,658.f},
+        Vector2{3564.f,618.f},
+        Vector2{3564.f,658.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3500.f,682.f},
+        Vector2{3500.f,722.f},
+        Vector2{3564.f,682.f},
+        Vector2{3564.f,722.f},
+        Vector2{3500.f,746.f},
+        Vector2{3500.f,786.f},
+        Vector2{3564.f,746.f},
+        Vector2{3564.f,786.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3500.f,810.f},
+        Vector2{3500.f,850.f},
+        Vector2{3564.f,810.f},
+        Vector2{3564.f,850.f},
+        Vector2{3500.f,874.f},
+        Vector2{3500.f,914.f},
+        Vector2{3564.f,874.f},
+        Vector2{3564.f,914.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3500.f,938.f},
+        Vector2{3500.f,978.f},
+        Vector2{3564.f,938.f},
+        Vector2{3564.f,978.f},
+        Vector2{3500.f,1002.f},
+        Vector2{3500.f,1042.f},
+        Vector2{3564.f,1002.f},
+        Vector2{3564.f,1042.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3500.f,1066.f},
+        Vector2{3500.f,1106.f},
+        Vector2{3564.f,1066.f},
+        Vector2{3564.f,1106.f},
+        Vector2{3500.f,1130.f},
+        Vector2{3500.f,1170.f},
+        Vector2{3564.f,1130.f},
+        Vector2{3564.f,1170.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3500.f,1194.f},
+        Vector2{3500.f,1234.f},
+        Vector2{3564.f,1194.f},
+        Vector2{3564.f,1234.f},
+        Vector2{3500.f,1258.f},
+        Vector2{3500.f,1298.f},
+        Vector2{3564.f,1258.f},
+        Vector2{3564.f,1298.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3500.f,1322.f},
+        Vector2{3500.f,1362.f},
+        Vector2{3564.f,1322.f},
+        Vector2{3564.f,1362.f},
+        Vector2{3500.f,1386.f},
+        Vector2{3500.f,1426.f},
+        Vector2{3564.f,1386.f},
+        Vector2{3564.f,1426.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3500.f,1450.f},
+        Vector2{3500.f,1490.f},
+        Vector2{3564.f,1450.f},
+        Vector2{3564.f,1490.f},
+        Vector2{3500.f,1514.f},
+        Vector2{3500.f,1554.f},
+        Vector2{3564.f,1514.f},
+        Vector2{3564.f,1554.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3500.f,1578.f},
+        Vector2{3500.f,1618.f},
+        Vector2{3564.f,1578.f},
+        Vector2{3564.f,1618.f},
+        Vector2{3500.f,1642.f},
+        Vector2{3500.f,1682.f},
+        Vector2{3564.f,1642.f},
+        Vector2{3564.f,1682.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3500.f,1706.f},
+        Vector2{3500.f,1746.f},
+        Vector2{3564.f,1706.f},
+        Vector2{3564.f,1746.f},
+        Vector2{3500.f,1770.f},
+        Vector2{3500.f,1810.f},
+        Vector2{3564.f,1770.f},
+        Vector2{3564.f,1810.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3500.f,1834.f},
+        Vector2{3500.f,1874.f},
+        Vector2{3564.f,1834.f},
+        Vector2{3564.f,1874.f},
+        Vector2{3500.f,1898.f},
+        Vector2{3500.f,1938.f},
+        Vector2{3564.f,1898.f},
+        Vector2{3564.f,1938.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3500.f,1962.f},
+        Vector2{3500.f,2002.f},
+        Vector2{3564.f,1962.f},
+        Vector2{3564.f,2002.f},
+        Vector2{3500.f,2026.f},
+        Vector2{3500.f,2046.f},
+        Vector2{3564.f,2026.f},
+        Vector2{3564.f,2046.f},
+        // ------------------------------------------------ Right Column -------------------------------------------------
+        Vector2{3628.f,170.f},
+        Vector2{3628.f,210.f},
+        Vector2{3692.f,170.f},
+        Vector2{3692.f,210.f},
+        Vector2{3628.f,234.f},
+        Vector2{3628.f,274.f},
+        Vector2{3692.f,234.f},
+        Vector2{3692.f,274.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3628.f,298.f},
+        Vector2{3628.f,338.f},
+        Vector2{3692.f,298.f},
+        Vector2{3692.f,338.f},
+        Vector2{3628.f,362.f},
+        Vector2{3628.f,402.f},
+        Vector2{3692.f,362.f},
+        Vector2{3692.f,402.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3628.f,426.f},
+        Vector2{3628.f,446.f},
+        Vector2{3692.f,426.f},
+        Vector2{3692.f,446.f},
+        Vector2{3628.f,490.f},
+        Vector2{3628.f,530.f},
+        Vector2{3692.f,490.f},
+        Vector2{3692.f,530.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3628.f,554.f},
+        Vector2{3628.f,594.f},
+        Vector2{3692.f,554.f},
+        Vector2{3692.f,594.f},
+        Vector2{3628.f,618.f},
+        Vector2{3628.f,658.f},
+        Vector2{3692.f,618.f},
+        Vector2{3692.f,658.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3628.f,682.f},
+        Vector2{3628.f,722.f},
+        Vector2{3692.f,682.f},
+        Vector2{3692.f,722.f},
+        Vector2{3628.f,746.f},
+        Vector2{3628.f,786.f},
+        Vector2{3692.f,746.f},
+        Vector2{3692.f,786.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3628.f,810.f},
+        Vector2{3628.f,850.f},
+        Vector2{3692.f,810.f},
+        Vector2{3692.f,850.f},
+        Vector2{3628.f,874.f},
+        Vector2{3628.f,914.f},
+        Vector2{3692.f,874.f},
+        Vector2{3692.f,914.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3628.f,938.f},
+        Vector2{3628.f,978.f},
+        Vector2{3692.f,938.f},
+        Vector2{3692.f,978.f},
+        Vector2{3628.f,1002.f},
+        Vector2{3628.f,1042.f},
+        Vector2{3692.f,1002.f},
+        Vector2{3692.f,1042.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3628.f,1066.f},
+        Vector2{3628.f,1106.f},
+        Vector2{3692.f,1066.f},
+        Vector2{3692.f,1106.f},
+        Vector2{3628.f,1130.f},
+        Vector2{3628.f,1170.f},
+        Vector2{3692.f,1130.f},
+        Vector2{3692.f,1170.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3628.f,1194.f},
+        Vector2{3628.f,1234.f},
+        Vector2{3692.f,1194.f},
+        Vector2{3692.f,1234.f},
+        Vector2{3628.f,1258.f},
+        Vector2{3628.f,1298.f},
+        Vector2{3692.f,1258.f},
+        Vector2{3692.f,1298.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3628.f,1322.f},
+        Vector2{3628.f,1362.f},
+        Vector2{3692.f,1322.f},
+        Vector2{3692.f,1362.f},
+        Vector2{3628.f,1386.f},
+        Vector2{3628.f,1426.f},
+        Vector2{3692.f,1386.f},
+        Vector2{3692.f,1426.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3628.f,1450.f},
+        Vector2{3628.f,1490.f},
+        Vector2{3692.f,1450.f},
+        Vector2{3692.f,1490.f},
+        Vector2{3628.f,1514.f},
+        Vector2{3628.f,1554.f},
+        Vector2{3692.f,1514.f},
+        Vector2{3692.f,1554.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3628.f,1578.f},
+        Vector2{3628.f,1618.f},
+        Vector2{3692.f,1578.f},
+        Vector2{3692.f,1618.f},
+        Vector2{3628.f,1642.f},
+        Vector2{3628.f,1682.f},
+        Vector2{3692.f,1642.f},
+        Vector2{3692.f,1682.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3628.f,1706.f},
+        Vector2{3628.f,1746.f},
+        Vector2{3692.f,1706.f},
+        Vector2{3692.f,1746.f},
+        Vector2{3628.f,1770.f},
+        Vector2{3628.f,1810.f},
+        Vector2{3692.f,1770.f},
+        Vector2{3692.f,1810.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3628.f,1834.f},
+        Vector2{3628.f,1874.f},
+        Vector2{3692.f,1834.f},
+        Vector2{3692.f,1874.f},
+        Vector2{3628.f,1898.f},
+        Vector2{3628.f,1938.f},
+        Vector2{3692.f,1898.f},
+        Vector2{3692.f,1938.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3628.f,1962.f},
+        Vector2{3628.f,2002.f},
+        Vector2{3692.f,1962.f},
+        Vector2{3692.f,2002.f},
+        Vector2{3628.f,2026.f},
+        Vector2{3628.f,2046.f},
+        Vector2{3692.f,2026.f},
+        Vector2{3692.f,2046.f},
+    })};
+
+    inline constexpr auto GrassOver{std::to_array<Vector2>({
+        // ---------------------------------------------- Left Map Grass -----------------------------------------------
+        // ---------------------------------------------------- -4 ------------------------------------------------------
+        Vector2{110.f,960.f},
+        Vector2{110.f,1000.f},
+        Vector2{174.f,960.f},
+        Vector2{174.f,1000.f},
+        Vector2{110.f,1024.f},
+        Vector2{174.f,1024.f},
+        // ---------------------------------------------------- -3 ------------------------------------------------------
+        Vector2{110.f,832.f},
+        Vector2{110.f,872.f},
+        Vector2{174.f,832.f},
+        Vector2{174.f,872.f},
+        Vector2{110.f,896.f},
+        Vector2{110.f,936.f},
+        Vector2{174.f,896.f},
+        Vector2{174.f,936.f},
+        // ---------------------------------------------------- -2 ------------------------------------------------------
+        Vector2{110.f,704.f},
+        Vector2{110.f,744.f},
+        Vector2{174.f,704.f},
+        Vector2{174.f,744.f},
+        Vector2{110.f,768.f},
+        Vector2{110.f,808.f},
+        Vector2{174.f,768.f},
+        Vector2{174.f,808.f},
+        // ---------------------------------------------------- -1 ------------------------------------------------------
+        // Vector2{302.f,360.f},
+        Vector2{302.f,384.f},
+        Vector2{302.f,424.f},
+
+        Vector2{302.f,448.f},
+        Vector2{238.f,512.f},
+        Vector2{302.f,552.f},
+
+        Vector2{238.f,576.f},
+        Vector2{238.f,616.f},
+        Vector2{302.f,576.f},
+        Vector2{302.f,616.f},
+        Vector2{238.f,640.f},
+        Vector2{238.f,680.f},
+        Vector2{302.f,640.f},
+        Vector2{302.f,680.f},
+
+        Vector2{238.f,704.f},
+        Vector2{238.f,744.f},
+        Vector2{302.f,704.f},
+        Vector2{302.f,744.f},
+        Vector2{238.f,768.f},
+        Vector2{238.f,808.f},
+        Vector2{302.f,768.f},
+        Vector2{302.f,808.f},
+
+        Vector2{238.f,832.f},
+        Vector2{238.f,872.f},
+        Vector2{302.f,832.f},
+        Vector2{302.f,872.f},
+        Vector2{238.f,896.f},
+        Vector2{238.f,936.f},
+
+        Vector2{238.f,960.f},
+        Vector2{238.f,1000.f},
+        Vector2{238.f,1024.f},
+        // --------------------------------------------- --------------- -----------------------------------------------
+        Vector2{366.f,384.f},
+
+        Vector2{366.f,616.f},
+        Vector2{366.f,640.f},
+        Vector2{366.f,680.f},
+        Vector2{366.f,704.f},
+        Vector2{366.f,744.f},
+        Vector2{366.f,768.f},
+
+        Vector2{430.f,488.f},
+        Vector2{430.f,528.f},
+        Vector2{430.f,552.f},
+        Vector2{430.f,592.f},
+        Vector2{430.f,616.f},
+        Vector2{430.f,640.f},
+        Vector2{430.f,680.f},
+        Vector2{430.f,704.f},
+        // Vector2{494.f,704.f},
+
+        // --------------------------------------------- Far Left Column -----------------------------------------------
+        // --------------------------------------------------- -4 -------------------------------------------------------
+        Vector2{1781.f,1826.f},
+        Vector2{1781.f,1866.f},
+        Vector2{1845.f,1826.f},
+        Vector2{1845.f,1866.f},
+        Vector2{1781.f,1890.f},
+        Vector2{1845.f,1890.f},
+        // --------------------------------------------------- -3 -------------------------------------------------------
+        Vector2{1781.f,1698.f},
+        Vector2{1781.f,1738.f},
+        Vector2{1845.f,1698.f},
+        Vector2{1845.f,1738.f},
+        Vector2{1781.f,1762.f},
+        Vector2{1781.f,1802.f},
+        Vector2{1845.f,1762.f},
+        Vector2{1845.f,1802.f},
+        // --------------------------------------------------- -2 -------------------------------------------------------
+        Vector2{1781.f,1634.f},
+        Vector2{1781.f,1674.f},
+        Vector2{1845.f,1634.f},
+        Vector2{1845.f,1674.f},
+        // ---------------------------------------------------- -1 ------------------------------------------------------
+        Vector2{1909.f,1418.f},
+        Vector2{1973.f,1378.f},
+        Vector2{1973.f,1418.f},
+        // --------------------------------------------------- 0 -------------------------------------------------------
+        Vector2{1909.f,1442.f},
+        Vector2{1909.f,1482.f},
+        Vector2{1973.f,1442.f},
+        Vector2{1973.f,1482.f},
+        Vector2{1909.f,1546.f},
+        Vector2{1973.f,1506.f},
+        Vector2{1973.f,1546.f},
+        // --------------------------------------------------- 1 -------------------------------------------------------
+        Vector2{1909.f,1570.f},
+        Vector2{1909.f,1610.f},
+        Vector2{1973.f,1570.f},
+        Vector2{1973.f,1610.f},
+        Vector2{1909.f,1634.f},
+        Vector2{1909.f,1674.f},
+        Vector2{1973.f,1634.f},
+        Vector2{1973.f,1674.f},
+        // --------------------------------------------------- 2 -------------------------------------------------------
+        Vector2{1909.f,1698.f},
+        Vector2{1909.f,1738.f},
+        Vector2{1973.f,1698.f},
+        Vector2{1973.f,1738.f},
+        Vector2{1909.f,1762.f},
+        Vector2{1909.f,1802.f},
+        Vector2{1973.f,1762.f},
+        Vector2{1973.f,1802.f},
+        // --------------------------------------------------- 3 -------------------------------------------------------
+        Vector2{1909.f,1826.f},
+        Vector2{1909.f,1866.f},
+        Vector2{1973.f,1826.f},
+        Vector2{1973.f,1866.f},
+        Vector2{1909.f,1890.f},
+        Vector2{1909.f,1930.f},
+        Vector2{1973.f,1890.f},
+        Vector2{1973.f,1930.f},
+        // ------------------------------------------------ Left Column ------------------------------------------------
+        // ---------------------------------------------------- -1 ------------------------------------------------------
+        Vector2{2037.f,1314.f},
+        Vector2{2037.f,1354.f},
+        Vector2{2101.f,1314.f},
+        Vector2{2101.f,1354.f},
+        Vector2{2037.f,1378.f},
+        Vector2{2037.f,1418.f},
+        Vector2{2101.f,1378.f},
+        Vector2{2101.f,1418.f},
+        // ---------------------------------------------------- 0 ------------------------------------------------------
+        Vector2{2037.f,1442.f},
+        Vector2{2037.f,1482.f},
+        Vector2{2101.f,1442.f},
+        Vector2{2101.f,1482.f},
+        Vector2{2037.f,1506.f},
+        Vector2{2037.f,1546.f},
+        Vector2{2101.f,1506.f},
+        Vector2{2101.f,1546.f},
+        // --------------------------------------------------- 1 -------------------------------------------------------
+        Vector2{2037.f,1570.f},
+        Vector2{2037.f,1610.f},
+        Vector2{2101.f,1570.f},
+        Vector2{2101.f,1610.f},
+        Vector2{2037.f,1634.f},
+        Vector2{2037.f,1674.f},
+        Vector2{2101.f,1634.f},
+        Vector2{2101.f,1674.f},
+        // --------------------------------------------------- 2 -------------------------------------------------------
+        Vector2{2037.f,1698.f},
+        Vector2{2037.f,1738.f},
+        Vector2{2101.f,1698.f},
+        Vector2{2101.f,1738.f},
+        Vector2{2037.f,1762.f},
+        Vector2{2037.f,1802.f},
+        Vector2{2101.f,1762.f},
+        Vector2{2101.f,1802.f},
+        // --------------------------------------------------- 3 -------------------------------------------------------
+        Vector2{2037.f,1826.f},
+        Vector2{2037.f,1866.f},
+        Vector2{2101.f,1826.f},
+        Vector2{2101.f,1866.f},
+        Vector2{2037.f,1890.f},
+        Vector2{2037.f,1930.f},
+        Vector2{2101.f,1890.f},
+        Vector2{2101.f,1930.f},
+        // --------------------------------------------------- 4 -------------------------------------------------------
+        Vector2{2037.f,1954.f},
+        Vector2{2037.f,1994.f},
+        Vector2{2101.f,1954.f},
+        Vector2{2101.f,1994.f},
+        Vector2{2037.f,2018.f},
+        Vector2{2037.f,2058.f},
+        Vector2{2101.f,2018.f},
+        // --------------------------------------------- Far Right Column ----------------------------------------------
+        // --------------------------------------------------- -6 -------------------------------------------------------
+        Vector2{2421.f,1954.f},
+        Vector2{2421.f,1994.f},
+        Vector2{2485.f,1954.f},
+        Vector2{2485.f,1994.f},
+        Vector2{2421.f,2018.f},
+        Vector2{2421.f,2058.f},
+        Vector2{2485.f,2018.f},
+        // --------------------------------------------------- -5 -------------------------------------------------------
+        Vector2{2421.f,1826.f},
+        Vector2{2421.f,1866.f},
+        Vector2{2421.f,1890.f},
+        Vector2{2421.f,1930.f},
+        Vector2{2485.f,1890.f},
+        Vector2{2485.f,1930.f},
+        // --------------------------------------------------- -4 -------------------------------------------------------
+        Vector2{2421.f,1698.f},
+        Vector2{2421.f,1738.f},
+        Vector2{2485.f,1698.f},
+        Vector2{2485.f,1738.f},
+        Vector2{2421.f,1762.f},
+        Vector2{2421.f,1802.f},
+        // --------------------------------------------------- -3 -------------------------------------------------------
+        Vector2{2421.f,1634.f},
+        Vector2{2421.f,1674.f},
+        Vector2{2485.f,1674.f},
+        // ---------------------------------------------------- -2 ------------------------------------------------------
+        Vector2{2421.f,1418.f},
+        // ---------------------------------------------------- -1 ------------------------------------------------------
+        Vector2{2293.f,1314.f},
+        Vector2{2293.f,1354.f},
+        Vector2{2357.f,1314.f},
+        Vector2{2357.f,1354.f},
+        Vector2{2293.f,1378.f},
+        Vector2{2293.f,1418.f},
+        Vector2{2357.f,1378.f},
+        Vector2{2357.f,1418.f},
+        // ---------------------------------------------------- 0 ------------------------------------------------------
+        Vector2{2293.f,1442.f},
+        Vector2{2293.f,1482.f},
+        Vector2{2357.f,1442.f},
+        Vector2{2357.f,1482.f},
+        Vector2{2293.f,1506.f},
+        Vector2{2293.f,1546.f},
+        Vector2{2357.f,1506.f},
+        Vector2{2357.f,1546.f},
+        // --------------------------------------------------- 1 -------------------------------------------------------
+        Vector2{2293.f,1570.f},
+        Vector2{2293.f,1610.f},
+        Vector2{2357.f,1570.f},
+        Vector2{2357.f,1610.f},
+        Vector2{2293.f,1634.f},
+        Vector2{2293.f,1674.f},
+        Vector2{2357.f,1634.f},
+        Vector2{2357.f,1674.f},
+        // --------------------------------------------------- 2 -------------------------------------------------------
+        Vector2{2293.f,1698.f},
+        Vector2{2293.f,1738.f},
+        Vector2{2357.f,1698.f},
+        Vector2{2357.f,1738.f},
+        Vector2{2293.f,1762.f},
+        Vector2{2293.f,1802.f},
+        Vector2{2357.f,1762.f},
+        Vector2{2357.f,1802.f},
+        // --------------------------------------------------- 3 -------------------------------------------------------
+        Vector2{2293.f,1826.f},
+        Vector2{2293.f,1866.f},
+        Vector2{2357.f,1826.f},
+        Vector2{2357.f,1866.f},
+        Vector2{2293.f,1890.f},
+        Vector2{2293.f,1930.f},
+        Vector2{2357.f,1890.f},
+        Vector2{2357.f,1930.f},
+        // --------------------------------------------------- 4 -------------------------------------------------------
+        Vector2{2293.f,1954.f},
+        Vector2{2293.f,1994.f},
+        Vector2{2357.f,1954.f},
+        Vector2{2357.f,1994.f},
+        Vector2{2357.f,2018.f},
+        // ------------------------------------------------ Right Column -----------------------------------------------
+        // --------------------------------------------------- -1 -------------------------------------------------------
+        Vector2{2165.f,1314.f},
+        Vector2{2165.f,1354.f},
+        Vector2{2229.f,1314.f},
+        Vector2{2229.f,1354.f},
+        Vector2{2165.f,1378.f},
+        Vector2{2165.f,1418.f},
+        Vector2{2229.f,1378.f},
+        Vector2{2229.f,1418.f},
+        // --------------------------------------------------- 0 -------------------------------------------------------
+        Vector2{2165.f,1442.f},
+        Vector2{2165.f,1482.f},
+        Vector2{2229.f,1442.f},
+        Vector2{2229.f,1482.f},
+        Vector2{2165.f,1506.f},
+        Vector2{2165.f,1546.f},
+        Vector2{2229.f,1506.f},
+        Vector2{2229.f,1546.f},
+        // --------------------------------------------------- 1 -------------------------------------------------------
+        Vector2{2165.f,1570.f},
+        Vector2{2165.f,1610.f},
+        Vector2{2229.f,1570.f},
+        Vector2{2229.f,1610.f},
+        Vector2{2165.f,1634.f},
+        Vector2{2165.f,1674.f},
+        Vector2{2229.f,1634.f},
+        Vector2{2229.f,1674.f},
+        // --------------------------------------------------- 2 -------------------------------------------------------
+        Vector2{2165.f,1698.f},
+        Vector2{2165.f,1738.f},
+        Vector2{2229.f,1698.f},
+        Vector2{2229.f,1738.f},
+        Vector2{2165.f,1762.f},
+        Vector2{2165.f,1802.f},
+        Vector2{2229.f,1762.f},
+        Vector2{2229.f,1802.f},
+        // --------------------------------------------------- 3 -------------------------------------------------------
+        Vector2{2165.f,1826.f},
+        Vector2{2165.f,1866.f},
+        Vector2{2229.f,1826.f},
+        Vector2{2229.f,1866.f},
+        Vector2{2165.f,1890.f},
+        Vector2{2165.f,1930.f},
+        Vector2{2229.f,1890.f},
+        Vector2{2229.f,1930.f},
+        // --------------------------------------------------- 4 -------------------------------------------------------
+        Vector2{2165.f,1954.f},
+        Vector2{2165.f,1994.f},
+        Vector2{2229.f,1954.f},
+        Vector2{2229.f,1994.f},
+        Vector2{2165.f,2018.f},
+        Vector2{2165.f,2058.f},
+        Vector2{2229.f,2018.f},
+        // --------------------------------------------------------------------------------------------------------------
+        // -----------------------------------------Dungeon Entrance Grass-----------------------------------------------
+        // --------------------------------------------------------------------------------------------------------------
+        // ------------------------------------------------ Left Column -------------------------------------------------
+        Vector2{3529.f,150.f},
+        Vector2{3529.f,190.f},
+        Vector2{3529.f,214.f},
+        Vector2{3529.f,254.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3529.f,278.f},
+        Vector2{3529.f,318.f},
+        Vector2{3529.f,342.f},
+        Vector2{3529.f,382.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3529.f,406.f},
+        Vector2{3529.f,446.f},
+        Vector2{3529.f,470.f},
+        Vector2{3529.f,510.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3529.f,534.f},
+        Vector2{3529.f,574.f},
+        Vector2{3529.f,598.f},
+        Vector2{3529.f,638.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3529.f,662.f},
+        Vector2{3529.f,702.f},
+        Vector2{3529.f,726.f},
+        Vector2{3529.f,766.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3529.f,790.f},
+        Vector2{3529.f,830.f},
+        Vector2{3529.f,854.f},
+        Vector2{3529.f,894.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3529.f,918.f},
+        Vector2{3529.f,958.f},
+        Vector2{3529.f,982.f},
+        Vector2{3529.f,1022.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3529.f,1046.f},
+        Vector2{3529.f,1086.f},
+        Vector2{3529.f,1110.f},
+        Vector2{3529.f,1150.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3529.f,1174.f},
+        Vector2{3529.f,1214.f},
+        Vector2{3529.f,1238.f},
+        Vector2{3529.f,1278.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3529.f,1302.f},
+        Vector2{3529.f,1342.f},
+        Vector2{3529.f,1366.f},
+        Vector2{3529.f,1406.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3529.f,1430.f},
+        Vector2{3529.f,1470.f},
+        Vector2{3529.f,1494.f},
+        Vector2{3529.f,1534.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3529.f,1558.f},
+        Vector2{3529.f,1598.f},
+        Vector2{3529.f,1622.f},
+        Vector2{3529.f,1662.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3529.f,1686.f},
+        Vector2{3529.f,1726.f},
+        Vector2{3529.f,1750.f},
+        Vector2{3529.f,1790.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3529.f,1814.f},
+        Vector2{3529.f,1854.f},
+        Vector2{3529.f,1878.f},
+        Vector2{3529.f,1918.f},
+        // ------------------------------------------------ Right Column -------------------------------------------------
+        Vector2{3593.f,150.f},
+        Vector2{3593.f,190.f},
+        Vector2{3657.f,150.f},
+        Vector2{3657.f,190.f},
+        Vector2{3593.f,214.f},
+        Vector2{3593.f,254.f},
+        Vector2{3657.f,214.f},
+        Vector2{3657.f,254.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3593.f,278.f},
+        Vector2{3593.f,318.f},
+        Vector2{3657.f,278.f},
+        Vector2{3657.f,318.f},
+        Vector2{3593.f,342.f},
+        Vector2{3593.f,382.f},
+        Vector2{3657.f,342.f},
+        Vector2{3657.f,382.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3593.f,406.f},
+        Vector2{3593.f,446.f},
+        Vector2{3657.f,406.f},
+        Vector2{3657.f,446.f},
+        Vector2{3593.f,470.f},
+        Vector2{3593.f,510.f},
+        Vector2{3657.f,470.f},
+        Vector2{3657.f,510.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3593.f,534.f},
+        Vector2{3593.f,574.f},
+        Vector2{3657.f,534.f},
+        Vector2{3657.f,574.f},
+        Vector2{3593.f,598.f},
+        Vector2{3593.f,638.f},
+        Vector2{3657.f,598.f},
+        Vector2{3657.f,638.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3593.f,662.f},
+        Vector2{3593.f,702.f},
+        Vector2{3657.f,662.f},
+        Vector2{3657.f,702.f},
+        Vector2{3593.f,726.f},
+        Vector2{3593.f,766.f},
+        Vector2{3657.f,726.f},
+        Vector2{3657.f,766.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3593.f,790.f},
+        Vector2{3593.f,830.f},
+        Vector2{3657.f,790.f},
+        Vector2{3657.f,830.f},
+        Vector2{3593.f,854.f},
+        Vector2{3593.f,894.f},
+        Vector2{3657.f,854.f},
+        Vector2{3657.f,894.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3593.f,918.f},
+        Vector2{3593.f,958.f},
+        Vector2{3657.f,918.f},
+        Vector2{3657.f,958.f},
+        Vector2{3593.f,982.f},
+        Vector2{3593.f,1022.f},
+        Vector2{3657.f,982.f},
+        Vector2{3657.f,1022.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3593.f,1046.f},
+        Vector2{3593.f,1086.f},
+        Vector2{3657.f,1046.f},
+        Vector2{3657.f,1086.f},
+        Vector2{3593.f,1110.f},
+        Vector2{3593.f,1150.f},
+        Vector2{3657.f,1110.f},
+        Vector2{3657.f,1150.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3593.f,1174.f},
+        Vector2{3593.f,1214.f},
+        Vector2{3657.f,1174.f},
+        Vector2{3657.f,1214.f},
+        Vector2{3593.f,1238.f},
+        Vector2{3593.f,1278.f},
+        Vector2{3657.f,1238.f},
+        Vector2{3657.f,1278.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3593.f,1302.f},
+        Vector2{3593.f,1342.f},
+        Vector2{3657.f,1302.f},
+        Vector2{3657.f,1342.f},
+        Vector2{3593.f,1366.f},
+        Vector2{3593.f,1406.f},
+        Vector2{3657.f,1366.f},
+        Vector2{3657.f,1406.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3593.f,1430.f},
+        Vector2{3593.f,1470.f},
+        Vector2{3657.f,1430.f},
+        Vector2{3657.f,1470.f},
+        Vector2{3593.f,1494.f},
+        Vector2{3593.f,1534.f},
+        Vector2{3657.f,1494.f},
+        Vector2{3657.f,1534.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3593.f,1558.f},
+        Vector2{3593.f,1598.f},
+        Vector2{3657.f,1558.f},
+        Vector2{3657.f,1598.f},
+        Vector2{3593.f,1622.f},
+        Vector2{3593.f,1662.f},
+        Vector2{3657.f,1622.f},
+        Vector2{3657.f,1662.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3593.f,1686.f},
+        Vector2{3593.f,1726.f},
+        Vector2{3657.f,1686.f},
+        Vector2{3657.f,1726.f},
+        Vector2{3593.f,1750.f},
+        Vector2{3593.f,1790.f},
+        Vector2{3657.f,1750.f},
+        Vector2{3657.f,1790.f},
+        // --------------------------------------------------------------------------------------------------------------
+        Vector2{3593.f,1814.f},
+        Vector2{3593.f,1854.f},
+        Vector2{3657.f,1814.f},
+        Vector2{3657.f,1854.f},
+        Vector2{3593.f,1878.f},
+        Vector2{3593.f,1918.f},
+        Vector2{3657.f,1878.f},
+        Vector2{3657.f,1918.f},
+    })};
+
+    // sheets in the order the Enemy constructors take them
+    inline constexpr std::array<SheetID, 6> BearBrownSheets{SheetID::BearBrownIdle, SheetID::BearBrownWalk, SheetID::BearBrownAttack, SheetID::BearBrownHurt, SheetID::BearBrownDeath, SheetID::Placeholder};
+    inline constexpr std::array<SheetID, 6> BearLightBrownSheets{SheetID::BearLightBrownIdle, SheetID::BearLightBrownWalk, SheetID::BearLightBrownAttack, SheetID::BearLightBrownHurt, SheetID::BearLightBrownDeath, SheetID::Placeholder};
+    inline constexpr std::array<SheetID, 6> ToadGreenSheets{SheetID::ToadGreenIdle, SheetID::ToadGreenWalk, SheetID::ToadGreenAttack, SheetID::ToadGreenHurt, SheetID::ToadGreenDeath, SheetID::Placeholder};
+    inline constexpr std::array<SheetID, 6> ToadPinkSheets{SheetID::ToadPinkIdle, SheetID::ToadPinkWalk, SheetID::ToadPinkAttack, SheetID::ToadPinkHurt, SheetID::ToadPinkDeath, SheetID::Placeholder};
+    inline constexpr std::array<SheetID, 6> MushroomRedSheets{SheetID::MushroomRedIdle, SheetID::MushroomRedWalk, SheetID::MushroomRedAttack, SheetID::MushroomRedHurt, SheetID::MushroomRedDeath, SheetID::Placeholder};
+    inline constexpr std::array<SheetID, 6> MushroomBrownSheets{SheetID::MushroomBrownIdle, SheetID::MushroomBrownWalk, SheetID::MushroomBrownAttack, SheetID::MushroomBrownHurt, SheetID::MushroomBrownDeath, SheetID::Placeholder};
+    inline constexpr std::array<SheetID, 6> MushroomBlueSheets{SheetID::MushroomBlueIdle, SheetID::MushroomBlueWalk, SheetID::MushroomBlueAttack, SheetID::MushroomBlueHurt, SheetID::MushroomBlueDeath, SheetID::Placeholder};
+    inline constexpr std::array<SheetID, 6> MushroomGreenSheets{SheetID::MushroomGreenIdle, SheetID::MushroomGreenWalk, SheetID::MushroomGreenAttack, SheetID::MushroomGreenHurt, SheetID::MushroomGreenDeath, SheetID::Placeholder};
+    inline constexpr std::array<SheetID, 6> SpiderBrownSheets{SheetID::SpiderBrownIdle, SheetID::SpiderBrownWalk, SheetID::SpiderBrownAttack, SheetID::SpiderBrownHurt, SheetID::SpiderBrownDeath, SheetID::Placeholder};
+    inline constexpr std::array<SheetID, 6> SpiderRedSheets{SheetID::SpiderRedIdle, SheetID::SpiderRedWalk, SheetID::SpiderRedAttack, SheetID::SpiderRedHurt, SheetID::SpiderRedDeath, SheetID::Placeholder};
+    inline constexpr std::array<SheetID, 6> SpiderBlackSheets{SheetID::SpiderBlackIdle, SheetID::SpiderBlackWalk, SheetID::SpiderBlackAttack, SheetID::SpiderBlackHurt, SheetID::SpiderBlackDeath, SheetID::Placeholder};
+    inline constexpr std::array<SheetID, 6> ShadowYellowSheets{SheetID::ShadowYellowIdle, SheetID::ShadowYellowWalk, SheetID::ShadowYellowAttack, SheetID::ShadowYellowHurt, SheetID::ShadowYellowDeath, SheetID::Placeholder};
+    inline constexpr std::array<SheetID, 6> ShadowTealSheets{SheetID::ShadowTealIdle, SheetID::ShadowTealWalk, SheetID::ShadowTealAttack, SheetID::ShadowTealHurt, SheetID::ShadowTealDeath, SheetID::Placeholder};
+    inline constexpr std::array<SheetID, 6> ImpRedSheets{SheetID::ImpRedIdle, SheetID::ImpRedWalk, SheetID::ImpRedAttack, SheetID::ImpRedHurt, SheetID::ImpRedDeath, SheetID::ImpRedProjectile};
+    inline constexpr std::array<SheetID, 6> CreatureOrangeSheets{SheetID::CreatureOrangeIdle, SheetID::CreatureOrangeWalk, SheetID::CreatureOrangeAttack, SheetID::CreatureOrangeHurt, SheetID::CreatureOrangeDeath, SheetID::Placeholder};
+    inline constexpr std::array<SheetID, 6> BeholderBlackSheets{SheetID::BeholderBlackIdle, SheetID::BeholderBlackWalk, SheetID::BeholderBlackAttack, SheetID::BeholderBlackHurt, SheetID::BeholderBlackDeath, SheetID::BeholderBlackProjectile};
+    inline constexpr std::array<SheetID, 6> NecromancerRedSheets{SheetID::NecromancerRedIdle, SheetID::NecromancerRedWalk, SheetID::NecromancerRedAttack, SheetID::NecromancerRedHurt, SheetID::NecromancerRedDeath, SheetID::NecromancerRedProjectile};
+    inline constexpr std::array<SheetID, 6> FoxFamilySheets{SheetID::FoxFamilyIdle, SheetID::FoxFamilyIdleTwo, SheetID::FoxFamilyWalk, SheetID::FoxFamilyLazy, SheetID::FoxFamilySleep, SheetID::Placeholder};
+    inline constexpr std::array<SheetID, 6> SquirrelSheets{SheetID::SquirrelIdle, SheetID::SquirrelIdleTwo, SheetID::SquirrelWalk, SheetID::SquirrelEat, SheetID::SquirrelEat, SheetID::Placeholder};
+    inline constexpr std::array<SheetID, 6> CrowSheets{SheetID::CrowIdle, SheetID::CrowIdleTwo, SheetID::CrowFlying, SheetID::CrowWalk, SheetID::CrowIdleTwo, SheetID::Placeholder};
+
+    inline constexpr auto Enemies{std::to_array<EnemySpawn>({
+        // ----------------------------------- Bears ------------------------------------
+        {BearBrownSheets, EnemyType::BEAR, EnemyType::NORMAL, {2924.f, 664.f}},         // BrownBearTwo
+        {BearBrownSheets, EnemyType::BEAR, EnemyType::NORMAL, {3065.f, 758.f}},         // BrownBearThree
+        {BearLightBrownSheets, EnemyType::BEAR, EnemyType::NORMAL, {3062.f, 933.f}},    // LightBrownBearTwo
+        {BearLightBrownSheets, EnemyType::BEAR, EnemyType::NORMAL, {2941.f, 821.f}},    // LightBrownBearThree
+
+        // ----------------------------------- Toads ------------------------------------
+        {ToadGreenSheets, EnemyType::TOAD, EnemyType::NORMAL, {1215.f, 230.f}, 2.5f, 2},    // GreenToadOne
+        {ToadGreenSheets, EnemyType::TOAD, EnemyType::NORMAL, {1107.f, 346.f}, 2.5f, 2},    // GreenToadTwo
+        {ToadPinkSheets, EnemyType::TOAD, EnemyType::NORMAL, {1387.f, 356.f}, 2.5f, 2},     // PinkToadOne
+        {ToadPinkSheets, EnemyType::TOAD, EnemyType::NORMAL, {1191.f, 488.f}, 2.5f, 2},     // PinkToadTwo
+
+        // ----------------------------------- Mushrooms ------------------------------------
+        {MushroomRedSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {1440.f, 1030.f}, 2.f, 2},      // RedMushroomOne
+        {MushroomRedSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {1840.f, 637.f}, 2.f, 2},       // RedMushroomTwo
+        {MushroomRedSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {158.f, 1925.f}, 2.f, 2},       // RedMushroomThree
+        {MushroomRedSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {1945.f, 2115.f}, 2.f, 2},      // RedMushroomFour
+        {MushroomRedSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {257.f, 340.f}, 2.f, 2},        // RedMushroomFive
+        {MushroomRedSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {1821.f, 3131.f}, 2.f, 2},      // RedMushroomSix
+        {MushroomRedSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {1734.f, 3131.f}, 2.f, 2},      // RedMushroomSeven
+        {MushroomBrownSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {727.f, 886.f}, 2.f, 2},      // BrownMushroomOne
+        {MushroomBrownSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {2156.f, 343.f}, 2.f, 2},     // BrownMushroomTwo
+        {MushroomBrownSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {1660.f, 1540.f}, 2.f, 2},    // BrownMushroomThree
+        {MushroomBrownSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {1142.f, 2238.f}, 2.f, 2},    // BrownMushroomFour
+        {MushroomBrownSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {2634.f, 2120.f}, 2.f, 2},    // BrownMushroomFive
+        {MushroomBlueSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {3240.f, 3809.f}, 2.f, 2},     // BlueMushroomOne
+        {MushroomRedSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {3332.f, 3902.f}, 2.f, 2},      // RedMushroomEight
+        {MushroomRedSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {656.f, 3887.f}, 2.f, 2},       // RedMushroomNine
+        {MushroomGreenSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {3936.f, 3532.f}, 2.f, 2},    // GreenMushroomTwo
+        {MushroomGreenSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {2835.f, 3803.f}, 2.f, 2},    // GreenMushroomThree
+        {MushroomRedSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {4024.f, 3733.f}, 2.f, 2},      // RedMushroomTen
+        {MushroomBlueSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {2134.f, 3819.f}, 2.f, 2},     // BlueMushroomFour
+        {MushroomGreenSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {1354.f, 3855.f}, 2.f, 2},    // GreenMushroomFive
+        {MushroomGreenSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {2351.f, 457.f}, 2.f, 2},     // GreenMushroomSix
+        {MushroomBlueSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {2037.f, 467.f}, 2.f, 2},      // BlueMushroomSeven
+        {MushroomGreenSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {1782.f, 230.f}, 2.f, 2},     // GreenMushroomEight
+        {MushroomBlueSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {2386.f, 230.f}, 2.f, 2},      // BlueMushroomNine
+        {MushroomRedSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {2186.f, 550.f}},               // RedMushroomMainOne
+        {MushroomRedSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {2130.f, 777.f}},               // RedMushroomMainTwo
+        {MushroomBrownSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {2364.f, 651.f}},             // BrownMushroomMainOne
+        {MushroomBrownSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {2013.f, 690.f}},             // BrownMushroomMainTwo
+        {MushroomBlueSheets, EnemyType::MUSHROOM, EnemyType::NORMAL, {2184.f, 659.f}, 4.5f, 4},     // BlueMushroomMainOne
+
+        // ----------------------------------- Side-Forest Spiders ------------------------------------
+        {SpiderBrownSheets, EnemyType::SPIDER, EnemyType::NORMAL, {186.f, 788.f}, 3.f, 2},    // BrownSpiderOne
+        {SpiderBrownSheets, EnemyType::SPIDER, EnemyType::NORMAL, {413.f, 661.f}, 3.f, 2},    // BrownSpiderTwo
+        {SpiderBrownSheets, EnemyType::SPIDER, EnemyType::NORMAL, {295.f, 818.f}, 3.f, 2},    // BrownSpiderThree
+        {SpiderBrownSheets, EnemyType::SPIDER, EnemyType::NORMAL, {260.f, 548.f}, 3.f, 2},    // BrownSpiderFour
+
+        // ----------------------------------- Main Grass Spiders ------------------------------------
+        {SpiderRedSheets, EnemyType::SPIDER, EnemyType::NORMAL, {2145.f, 1397.f}, 3.f, 2},      // RedSpiderOne
+        {SpiderRedSheets, EnemyType::SPIDER, EnemyType::NORMAL, {2092.f, 1649.f}, 3.f, 2},      // RedSpiderTwo
+        {SpiderRedSheets, EnemyType::SPIDER, EnemyType::NORMAL, {1951.f, 1762.f}, 3.f, 2},      // RedSpiderThree
+        {SpiderBlackSheets, EnemyType::SPIDER, EnemyType::NORMAL, {2289.f, 1549.f}, 3.f, 2},    // BlackSpiderOne
+        {SpiderBlackSheets, EnemyType::SPIDER, EnemyType::NORMAL, {2505.f, 1752.f}, 3.f, 2},    // BlackSpiderTwo
+
+        // ----------------------------------- Ghosts ------------------------------------
+        {ShadowYellowSheets, EnemyType::SHADOW, EnemyType::NORMAL, {3052.f, 1552.f}, 3.f, 3},    // ShadowOne
+        {ShadowYellowSheets, EnemyType::SHADOW, EnemyType::NORMAL, {3134.f, 1681.f}, 3.f, 3},    // ShadowTwo
+        {ShadowYellowSheets, EnemyType::SHADOW, EnemyType::NORMAL, {3311.f, 1847.f}, 3.f, 3},    // ShadowThree
+        {ShadowTealSheets, EnemyType::SHADOW, EnemyType::NORMAL, {3565.f, 1600.f}, 3.f, 3},      // ShadowFour
+        {ShadowTealSheets, EnemyType::SHADOW, EnemyType::NORMAL, {3629.f, 1430.f}, 3.f, 3},      // ShadowFive
+        {ShadowTealSheets, EnemyType::SHADOW, EnemyType::NORMAL, {3624.f, 1899.f}, 3.f, 3},      // ShadowSix
+
+        // ----------------------------------- Bosses ------------------------------------
+        {ImpRedSheets, EnemyType::IMP, EnemyType::BOSS, {2184.f, 659.f}, 4.f, 5, EnemyType::MUSHROOM},                    // RedBossImp
+        {CreatureOrangeSheets, EnemyType::CREATURE, EnemyType::BOSS, {2918.f, 895.f}, 5.f, 7, EnemyType::BEAR},           // OrangeBossCreature
+        {BeholderBlackSheets, EnemyType::BEHOLDER, EnemyType::BOSS, {1064.f, 383.f}, 2.5f, 4, EnemyType::TOAD},           // BlackBossBeholder
+        {BeholderBlackSheets, EnemyType::BEHOLDER, EnemyType::BOSS, {1317.f, 383.f}, 2.5f, 4, EnemyType::TOAD},           // BlackBossBeholderTwo
+    })};
+
+    // the final boss waits in the dungeon, every other creature roams the forest
+    inline constexpr auto DungeonEnemies{std::to_array<EnemySpawn>({
+        {NecromancerRedSheets, EnemyType::NECROMANCER, EnemyType::FINALBOSS, {485.f, 341.f}, 5.f, 8, EnemyType::BOSS},    // BossRedNecro
+    })};
+
+    // Wildlife NPCs live in the scene registry, not in the enemy vectors
+    inline constexpr auto Wildlife{std::to_array<EnemySpawn>({
+        // -------------------- Fox Family -----------------------//
+        {FoxFamilySheets, EnemyType::FOX, EnemyType::NPC, {473.f, 2524.f}},          // FoxFamOne
+        {FoxFamilySheets, EnemyType::FOX, EnemyType::NPC, {247.f, 2524.f}},          // FoxFamTwo
+        {FoxFamilySheets, EnemyType::FOX, EnemyType::NPC, {428.f, 2840.f}, 2.5f},    // FoxFamThree
+        {FoxFamilySheets, EnemyType::FOX, EnemyType::NPC, {354.f, 2661.f}, 2.5f},    // FoxFamFour
+
+        // ------------------- Squirrels ---------------------
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {2839.f, 2041.f}, 2.0f},    // SquirrelOne
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {3050.f, 2147.f}, 2.0f},    // SquirrelTwo
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {3155.f, 2133.f}, 2.0f},    // SquirrelThree
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {2392.f, 244.f}, 2.0f},     // SquirrelFour
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {3251.f, 339.f}, 2.0f},     // SquirrelFive
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {916.f, 940.f}, 2.0f},      // SquirrelSeven
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {539.f, 1221.f}, 2.0f},     // SquirrelEight
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {932.f, 1265.f}, 2.0f},     // SquirrelNine
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {345.f, 1663.f}, 2.0f},     // SquirrelTen
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {1588.f, 1780.f}, 2.0f},    // SquirrelFourteen
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {1739.f, 2002.f}, 2.0f},    // SquirrelFifteen
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {2534.f, 2520.f}, 2.0f},    // SquirrelSixteen
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {2086.f, 2928.f}, 2.0f},    // SquirrelSeventeen
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {3964.f, 2537.f}, 2.0f},    // SquirrelEighteen
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {3658.f, 3859.f}, 2.0f},    // SquirrelNineTeen
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {480.f, 3813.f}, 2.0f},     // SquirrelTwenty
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {661.f, 3847.f}, 2.0f},     // SquirrelTwentyOne
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {1354.f, 3846.f}, 2.0f},    // SquirrelTwentyTwo
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {155.f, 1929.f}, 2.0f},     // SquirrelTwentyThree
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {337.f, 2032.f}, 2.0f},     // SquirrelTwentyFour
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {162.f, 2127.f}, 2.0f},     // SquirrelTwentyFive
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {752.f, 1933.f}, 2.0f},     // SquirrelTwentySix
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {1795.f, 236.f}, 2.0f},     // SquirrelTwentySeven
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {333.f, 1631.f}, 2.0f},     // SquirrelTwentyEight
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {838.f, 1630.f}, 2.0f},     // SquirrelTwentyNine
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {1107.f, 1525.f}, 2.0f},    // SquirrelThirty
+        {SquirrelSheets, EnemyType::SQUIRREL, EnemyType::NPC, {728.f, 912.f}, 2.0f},      // SquirrelThirtyTwo
+    })};
+
+    inline constexpr auto Crows{std::to_array<EnemySpawn>({
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3740.f, 2149.f}, 2.5f},    // CrowOne
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3546.f, 2032.f}, 2.5f},    // CrowTwo
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3339.f, 2132.f}, 2.5f},    // CrowThree
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3848.f, 1936.f}, 2.5f},    // CrowFour
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3947.f, 1842.f}, 2.5f},    // CrowFive
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3338.f, 1931.f}, 2.5f},    // CrowSix
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3458.f, 1729.f}, 2.5f},    // CrowSeven
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3750.f, 1607.f}, 2.5f},    // CrowEight
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3322.f, 1539.f}, 2.5f},    // CrowNine
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3763.f, 1434.f}, 2.5f},    // CrowTen
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3339.f, 1355.f}, 2.5f},    // CrowEleven
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3860.f, 1249.f}, 2.5f},    // CrowTwelve
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3832.f, 939.f}, 2.5f},     // CrowThirteen
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3742.f, 747.f}, 2.5f},     // CrowFourteen
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3915.f, 747.f}, 2.5f},     // CrowFifteen
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3763.f, 635.f}, 2.5f},     // CrowSixteen
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3850.f, 544.f}, 2.5f},     // CrowSeventeen
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3751.f, 441.f}, 2.5f},     // CrowEighteen
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3928.f, 361.f}, 2.5f},     // CrowNineteen
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {4040.f, 551.f}, 2.5f},     // CrowTwenty
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3459.f, 1170.f}, 2.5f},    // CrowTwentyone
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3463.f, 952.f}, 2.5f},     // CrowTwentytwo
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3340.f, 648.f}, 2.5f},     // CrowTwentythree
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3450.f, 470.f}, 2.5f},     // CrowTwentyfour
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3357.f, 371.f}, 2.5f},     // CrowTwentyfive
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3260.f, 1739.f}, 2.5f},    // CrowTwentysix
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {3039.f, 1835.f}, 2.5f},    // CrowTwentyseven
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {2838.f, 1553.f}, 2.5f},    // CrowTwentyeight
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {2638.f, 1440.f}, 2.5f},    // CrowTwentynine
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {1436.f, 1431.f}, 2.5f},    // CrowThirtytwo
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {1761.f, 1146.f}, 2.5f},    // CrowThirtythree
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {1453.f, 960.f}, 2.5f},     // CrowThirtyfour
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {255.f, 1186.f}, 2.5f},     // CrowThirtysix
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {154.f, 1563.f}, 2.5f},     // CrowThirtyseven
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {860.f, 363.f}, 2.5f},      // CrowThirtyeight
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {2183.f, 1059.f}, 2.5f},    // CrowThirtynine
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {2761.f, 560.f}, 2.5f},     // CrowForty
+        {CrowSheets, EnemyType::CROW, EnemyType::NPC, {1647.f, 563.f}, 2.5f},     // CrowFortyone
+    })};
+}
+
+static_assert(Placement::Props(World::Under::Placeholder), "World::Under::Placeholder has a prop off the map or one that needs building by hand");
+static_assert(Placement::Props(World::Under::DungeonEntrance), "World::Under::DungeonEntrance has a prop off the map or one that needs building by hand");
+static_assert(Placement::Props(World::Under::Boulder), "World::Under::Boulder has a prop off the map or one that needs building by hand");
+static_assert(Placement::Props(World::Under::Bushes), "World::Under::Bushes has a prop off the map or one that needs building by hand");
+static_assert(Placement::Props(World::Under::Walls), "World::Under::Walls has a prop off the map or one that needs building by hand");
+static_assert(Placement::Props(World::Under::Stumps), "World::Under::Stumps has a prop off the map or one that needs building by hand");
+static_assert(Placement::Props(World::Under::Moveable), "World::Under::Moveable has a prop off the map or one that needs building by hand");
+static_assert(Placement::Props(World::Over::Bushes), "World::Over::Bushes has a prop off the map or one that needs building by hand");
+static_assert(Placement::Props(World::Over::Houses), "World::Over::Houses has a prop off the map or one that needs building by hand");
+static_assert(Placement::Props(World::Over::Boulder), "World::Over::Boulder has a prop off the map or one that needs building by hand");
+static_assert(Placement::Props(World::Over::Moveable), "World::Over::Moveable has a prop off the map or one that needs building by hand");
+static_assert(Placement::Props(World::Over::Stumps), "World::Over::Stumps has a prop off the map or one that needs building by hand");
+static_assert(Placement::Props(World::Trees), "World::Trees has a tree off the map");
+static_assert(Placement::Enemies(World::Enemies), "World::Enemies has a creature off the map or with the wrong sheets");
+static_assert(Placement::Enemies(World::DungeonEnemies), "World::DungeonEnemies has a creature off the map or with the wrong sheets");
+static_assert(Placement::Enemies(World::Wildlife), "World::Wildlife has a critter off the map or with the wrong sheets");
+static_assert(Placement::Enemies(World::Crows), "World::Crows has a crow off the map or with the wrong sheets");
+
+#endif // WORLDLAYOUT_HPP
@@ -0,0 +1,59 @@
+#include "animator.hpp"
+#include <raylib.h>
+
+int Animator::Add(const int MaxFramesX, const float UpdateTime)
+{
+    FrameX.emplace_back(0);
+    this->MaxFramesX.emplace_back(MaxFramesX);
+    this->UpdateTime.emplace_back(UpdateTime);
+    RunningTime.emplace_back(0.f);
+    Slot.emplace_back(-1);
+
+    return static_cast<int>(FrameX.size()) - 1;
+}
+
+void Animator::Play(const int Clip)
+{
+    if (Slot.at(Clip) != -1) {
+        return;
+    }
+
+    Slot.at(Clip) = static_cast<int>(Playing.size());
+    Playing.emplace_back(Clip);
+}
+
+void Animator::Stop(const int Clip)
+{
+    int Index{Slot.at(Clip)};
+
+    if (Index == -1) {
+        return;
+    }
+
+    // swap with the last playing clip to keep the list dense
+    int Last{Playing.back()};
+    Playing.at(Index) = Last;
+    Slot.at(Last) = Index;
+    Playing.pop_back();
+    Slot.at(Clip) = -1;
+}
+
+void Animator::Tick(const float DeltaTime)
+{
+    for (const int Clip:Playing) {
+        RunningTime[Clip] += DeltaTime;
+        if (RunningTime[Clip] >= UpdateTime[Clip]) {
+            ++FrameX[Clip];
+            RunningTime[Clip] = 0.f;
+            if (FrameX[Clip] > MaxFramesX[Clip]) {
+                FrameX[Clip] = 0;
+            }
+        }
+    }
+}
+
+int Animator::AmbientFrame(const int MaxFramesX, const float UpdateTime)
+{
+    // matches Sprite::Tick, which steps through MaxFramesX + 1 frames before wrapping
+    return static_cast<int>(GetTime() / UpdateTime) % (MaxFramesX + 1);
+}
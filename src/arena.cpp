@@ -0,0 +1,29 @@
+#include "arena.hpp"
+
+Arena::Resource::Resource(const size_t InitialBytes)
+    : Blocks{InitialBytes}
+{
+
+}
+
+void Arena::Resource::Release()
+{
+    std::lock_guard<std::mutex> Guard{Lock};
+    Blocks.release();
+}
+
+void* Arena::Resource::do_allocate(const size_t Bytes, const size_t Alignment)
+{
+    std::lock_guard<std::mutex> Guard{Lock};
+    return Blocks.allocate(Bytes, Alignment);
+}
+
+void Arena::Resource::do_deallocate(void*, const size_t, const size_t)
+{
+    // monotonic, the memory comes back when the whole arena is released
+}
+
+bool Arena::Resource::do_is_equal(const std::pmr::memory_resource& Other) const noexcept
+{
+    return this == &Other;
+}
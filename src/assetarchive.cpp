@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <cstring>
+#include "assetarchive.hpp"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+AssetArchive::AssetArchive(const char* Path)
+{
+#ifndef _WIN32
+    int File{open(Path, O_RDONLY)};
+    if (File < 0) {
+        return;
+    }
+
+    struct stat Info{};
+    if (fstat(File, &Info) == 0 && Info.st_size > 0) {
+        void* Mapping{mmap(nullptr, static_cast<size_t>(Info.st_size), PROT_READ, MAP_PRIVATE, File, 0)};
+        if (Mapping != MAP_FAILED) {
+            Base = static_cast<const unsigned char*>(Mapping);
+            Length = static_cast<size_t>(Info.st_size);
+            // start paging the whole archive in as one sequential read
+            madvise(Mapping, Length, MADV_WILLNEED);
+        }
+    }
+    close(File);
+#else
+    std::ifstream File{Path, std::ios::binary | std::ios::ate};
+    if (!File) {
+        return;
+    }
+    Buffer.resize(static_cast<size_t>(File.tellg()));
+    File.seekg(0);
+    File.read(reinterpret_cast<char*>(Buffer.data()), static_cast<std::streamsize>(Buffer.size()));
+    Base = Buffer.data();
+    Length = Buffer.size();
+#endif
+
+    if (Length < sizeof(Pack::Header)) {
+        Close();
+        return;
+    }
+
+    Pack::Header Top{};
+    std::memcpy(&Top, Base, sizeof(Top));
+    if (Top.Magic != Pack::Magic || Top.Version != Pack::Version ||
+        Top.Count > (Length - sizeof(Top)) / sizeof(Pack::Entry)) {
+        Close();
+        return;
+    }
+
+    Index = reinterpret_cast<const Pack::Entry*>(Base + sizeof(Top));
+    Count = Top.Count;
+
+    // a truncated file would hand out pointers past the mapping
+    for (uint32_t i{}; i < Count; ++i) {
+        if (Index[i].Offset > Length || Index[i].Size > Length - Index[i].Offset) {
+            Close();
+            return;
+        }
+    }
+}
+
+AssetArchive::~AssetArchive()
+{
+    Close();
+}
+
+void AssetArchive::Close()
+{
+#ifndef _WIN32
+    if (Base) {
+        munmap(const_cast<unsigned char*>(Base), Length);
+    }
+#endif
+    Buffer.clear();
+    Base = nullptr;
+    Length = 0;
+    Index = nullptr;
+    Count = 0;
+}
+
+const Pack::Entry* AssetArchive::Find(const char* Path) const
+{
+    // the packer writes the index sorted, so this is a binary search over fixed width names
+    const Pack::Entry* End{Index + Count};
+    const Pack::Entry* Match{std::lower_bound(Index, End, Path, [](const Pack::Entry& Item, const char* Key) {
+        return std::strncmp(Item.Path, Key, Pack::PathLength) < 0;
+    })};
+
+    if (Match != End && std::strncmp(Match->Path, Path, Pack::PathLength) == 0) {
+        return Match;
+    }
+    return nullptr;
+}
+
+bool AssetArchive::GetImage(const char* Path, Image& View) const
+{
+    const Pack::Entry* Item{Find(Path)};
+    if (!Item || Item->Type != Pack::Kind::IMAGE) {
+        return false;
+    }
+
+    View.data = const_cast<unsigned char*>(Base + Item->Offset);
+    View.width = static_cast<int>(Item->Width);
+    View.height = static_cast<int>(Item->Height);
+    View.mipmaps = 1;
+    View.format = static_cast<int>(Item->Format);
+    return true;
+}
+
+bool AssetArchive::GetWave(const char* Path, Wave& View) const
+{
+    const Pack::Entry* Item{Find(Path)};
+    if (!Item || Item->Type != Pack::Kind::WAVE) {
+        return false;
+    }
+
+    View.data = const_cast<unsigned char*>(Base + Item->Offset);
+    View.frameCount = Item->Frames;
+    View.sampleRate = Item->SampleRate;
+    View.sampleSize = Item->SampleSize;
+    View.channels = Item->Channels;
+    return true;
+}
+
+bool AssetArchive::GetStream(const char* Path, const unsigned char*& Bytes, int& Size) const
+{
+    const Pack::Entry* Item{Find(Path)};
+    if (!Item || Item->Type != Pack::Kind::STREAM) {
+        return false;
+    }
+
+    Bytes = Base + Item->Offset;
+    Size = static_cast<int>(Item->Size);
+    return true;
+}
+
+namespace Assets
+{
+    const AssetArchive& Archive()
+    {
+        // opened on first use; the loader thread may get here first, which a local static allows
+        static const AssetArchive Packed{ArchivePath};
+        return Packed;
+    }
+
+    Texture2D LoadTexture(const char* Path)
+    {
+        Image View{};
+        if (Archive().GetImage(Path, View)) {
+            return LoadTextureFromImage(View);
+        }
+        return ::LoadTexture(Path);
+    }
+
+    Image LoadImage(const char* Path, bool& Owned)
+    {
+        Image View{};
+        Owned = !Archive().GetImage(Path, View);
+        return Owned ? ::LoadImage(Path) : View;
+    }
+
+    Wave LoadWave(const char* Path, bool& Owned)
+    {
+        Wave View{};
+        Owned = !Archive().GetWave(Path, View);
+        return Owned ? ::LoadWave(Path) : View;
+    }
+
+    Music LoadMusicStream(const char* Path)
+    {
+        // music stays compressed and is decoded as it plays, only now straight out of the mapping
+        const unsigned char* Bytes{};
+        int Size{};
+        if (Archive().GetStream(Path, Bytes, Size)) {
+            return LoadMusicStreamFromMemory(GetFileExtension(Path), Bytes, Size);
+        }
+        return ::LoadMusicStream(Path);
+    }
+}
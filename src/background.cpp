@@ -1,6 +1,6 @@
 #include "background.hpp"
 
-Background::Background(const GameTexture& GameTextures, const GameAudio& Audio)
+Background::Background(const GameTexture& GameTextures, GameAudio& Audio)
     : GameTextures{GameTextures}, Audio{Audio}
 {
 
@@ -12,19 +12,18 @@ void Background::Tick(const Vector2 WorldPos)
 
     if (IsKeyPressed(KEY_M)) {
         MiniMapOpen = !MiniMapOpen;
-        SetSoundVolume(Audio.Transition, 0.2f);
-        PlaySound(Audio.Transition);
+        Audio.Effects.Play(Cue::TRANSITION, 0.2f);
     }
 }
 
 void Background::DrawForest() 
 {
-    DrawTextureEx(GameTextures.Map, MapPos, 0.0f, Scale, WHITE);
+    DrawTextureEx(GameTextures.Use(GameTextures.Map), MapPos, 0.0f, Scale, WHITE);
 }
 
 void Background::DrawDungeon()
 {
-    DrawTextureEx(GameTextures.DungeonMap, MapPos, 0.0f, Scale, WHITE);
+    DrawTextureEx(GameTextures.Use(GameTextures.DungeonMap), MapPos, 0.0f, Scale, WHITE);
 }
 
 void Background::DrawMiniMap(const Vector2 CharWorldPos)
@@ -35,8 +34,8 @@ void Background::DrawMiniMap(const Vector2 CharWorldPos)
     };
 
     if (MiniMapOpen) {
-        DrawTextureEx(GameTextures.SquareContainer, Vector2Subtract(Position, Vector2{10.f, 10.f}), 0.f, 7.9f, WHITE);
-        DrawTextureEx(GameTextures.MiniMap, Position, 0.0f, .35f, WHITE);
+        DrawTextureEx(GameTextures.Use(GameTextures.SquareContainer), Vector2Subtract(Position, Vector2{10.f, 10.f}), 0.f, 7.9f, WHITE);
+        DrawTextureEx(GameTextures.Use(GameTextures.MiniMap), Position, 0.0f, .35f, WHITE);
         // Draw MiniMap Character Indicator
         DrawRectangle(Position.x + 54.f + ((CharWorldPos.x/4.f) * .35f), Position.y + 30.f + ((CharWorldPos.y/4.f) * .35f), 5, 5, RED);  
     }
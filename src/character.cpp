@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cmath>
 #include "character.hpp"
 
 Character::Character(const Sprite& Idle, 
@@ -10,34 +12,31 @@ Character::Character(const Sprite& Idle,
                      const Sprite& Sleep, 
                      const Sprite& ItemGrab,
                      const GameTexture& GameTextures, 
-                     const GameAudio& Audio,
+                     GameAudio& Audio,
                      const Window& Screen, 
-                     Background& World)
+                     Background& World,
+                     Animator& Animations)
     : GameTextures{GameTextures},
       Audio{Audio},
       Screen{Screen},
-      World{World}
+      World{World},
+      Animations{Animations},
+      Sprites{Idle, Walk, Run, Attack, Hurt, Death, Push, Sleep, ItemGrab}
 {
     WorldPos = Vector2Subtract(WorldPos, Offset);
 
-    Sprites.emplace_back(Idle);
-    Sprites.emplace_back(Walk);
-    Sprites.emplace_back(Run);
-    Sprites.emplace_back(Attack);
-    Sprites.emplace_back(Hurt);
-    Sprites.emplace_back(Death);
-    Sprites.emplace_back(Push);
-    Sprites.emplace_back(Sleep);
-    Sprites.emplace_back(ItemGrab);
+    for (size_t i{}; i < Sprites.size(); ++i) {
+        Clips[i] = Animations.Add(Sprites[i].Sheet->FramesX, Sprites[i].Sheet->UpdateTime);
+    }
 
     SpriteIndex = static_cast<int>(FoxState::IDLE);
 }
 
-void Character::Tick(float DeltaTime, Props& Props, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees)
+void Character::Tick(Props& Props, std::pmr::vector<Enemy>& Enemies, std::pmr::vector<Prop>& Trees)
 {
     UpdateScreenPos();
 
-    SpriteTick(DeltaTime);
+    SpriteTick();
 
     UpdateSource();
 
@@ -71,20 +70,25 @@ void Character::Tick(float DeltaTime, Props& Props, std::vector<Enemy>& Enemies,
 
 void Character::Draw()
 {
-    DrawTexturePro(Sprites.at(SpriteIndex).Texture, Source, Destination, Vector2{}, 0.f, WHITE);
+    DrawTexturePro(GameTextures.Use(Sprites.at(SpriteIndex).Sheet->Texture), Source, Destination, Vector2{}, 0.f, WHITE);
 }
 
-void Character::SpriteTick(float DeltaTime)
+void Character::SpriteTick()
 {
-    for (auto& Sprite:Sprites) {
-        Sprite.Tick(DeltaTime);
+    // only the sprite being shown is advanced by the animator
+    if (PlayingClip != Clips.at(SpriteIndex)) {
+        if (PlayingClip != Animator::NoClip) {
+            Animations.Stop(PlayingClip);
+        }
+        PlayingClip = Clips.at(SpriteIndex);
+        Animations.Play(PlayingClip);
     }
 }
 
 void Character::UpdateScreenPos()
 {
-    float CurrentSpriteWidth{static_cast<float>(Sprites.at(SpriteIndex).Texture.width/Sprites.at(SpriteIndex).MaxFramesX)};
-    float CurrentSpriteHeight{static_cast<float>(Sprites.at(SpriteIndex).Texture.height/Sprites.at(SpriteIndex).MaxFramesY)};
+    float CurrentSpriteWidth{Sprites.at(SpriteIndex).Sheet->FrameWidth};
+    float CurrentSpriteHeight{Sprites.at(SpriteIndex).Sheet->FrameHeight};
 
     ScreenPos.x = Screen.x/2.f - (Scale * (0.5f * CurrentSpriteWidth));
     ScreenPos.y = Screen.y/2.f - (Scale * (0.5f * CurrentSpriteHeight));
@@ -121,7 +125,7 @@ void Character::CheckDirection()
         }
 }
 
-void Character::CheckMovement(Props& Props, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees)
+void Character::CheckMovement(Props& Props, std::pmr::vector<Enemy>& Enemies, std::pmr::vector<Prop>& Trees)
 {
     PrevWorldPos = WorldPos;
     Vector2 Direction{};
@@ -143,18 +147,21 @@ void Character::CheckMovement(Props& Props, std::vector<Enemy>& Enemies, std::ve
             Direction.x += Speed;
         }
 
+        Vector2 Delta{};
         if (Vector2Length(Direction) != 0.f) {
-            WorldPos = Vector2Add(WorldPos, Vector2Scale(Vector2Normalize(Direction), Speed));
+            Delta = Vector2Scale(Vector2Normalize(Direction), Speed);
         }
 
-        // Undo Movement if walking out-of-bounds
+        // Stop short of walls and trees before moving, then undo any axis that leaves the map
         if (World.GetArea() == Area::FOREST) {
+            WorldPos = Vector2Add(WorldPos, SweepMovement(Delta, Props, Trees));
             CheckOutOfBounds();
 
-            CheckCollision(Props.Under, Direction, Enemies, Trees);
-            CheckCollision(Props.Over, Direction, Enemies, Trees);
+            CheckCollision(Props.Under, Direction, Enemies);
+            CheckCollision(Props.Over, Direction, Enemies);
         }
         else if (World.GetArea() == Area::DUNGEON) {
+            WorldPos = Vector2Add(WorldPos, Delta);
             CheckOutOfBounds();
 
             CheckCollision(Enemies);
@@ -162,6 +169,70 @@ void Character::CheckMovement(Props& Props, std::vector<Enemy>& Enemies, std::ve
     }
 }
 
+// Clips a step against every solid prop and tree in its path. Each axis is swept on its own,
+// X first and then Y from wherever X stopped, so a blocked axis still slides along the other.
+// Anything the fox already overlaps is let go, so it can always walk back out.
+Vector2 Character::SweepMovement(Vector2 Delta, Props& Props, std::pmr::vector<Prop>& Trees)
+{
+    if (!Collidable || (Delta.x == 0.f && Delta.y == 0.f)) {
+        return Delta;
+    }
+
+    // props are measured from where the fox stands, so it is the fox's box that moves
+    const Rectangle Fox{GetCollisionRec()};
+    const Rectangle Path
+    {
+        std::min(Fox.x, Fox.x + Delta.x),
+        std::min(Fox.y, Fox.y + Delta.y),
+        Fox.width + std::fabs(Delta.x),
+        Fox.height + std::fabs(Delta.y)
+    };
+
+    // boulders are pushed rather than blocking, CheckCollision deals with them
+    Blockers.clear();
+    auto Gather = [&](Prop& Prop) {
+        if (Prop.HasCollision() && Prop.IsSpawned() && !Prop.IsMoveable()) {
+            const Rectangle Solid{Prop.GetCollisionRec(WorldPos)};
+            if (CheckCollisionRecs(Path, Solid)) {
+                Blockers.emplace_back(Solid);
+            }
+        }
+    };
+    for (auto& Group:Props.Under) {
+        std::for_each(Group.begin(), Group.end(), Gather);
+    }
+    for (auto& Group:Props.Over) {
+        std::for_each(Group.begin(), Group.end(), Gather);
+    }
+    std::for_each(Trees.begin(), Trees.end(), Gather);
+
+    const Vector2 Step{Delta};
+    for (const Rectangle& Solid:Blockers) {
+        if (Fox.y < Solid.y + Solid.height - Skin && Fox.y + Fox.height > Solid.y + Skin) {
+            if (Step.x > 0.f && Fox.x + Fox.width <= Solid.x + Skin) {
+                Delta.x = std::min(Delta.x, Solid.x - (Fox.x + Fox.width));
+            }
+            else if (Step.x < 0.f && Fox.x >= Solid.x + Solid.width - Skin) {
+                Delta.x = std::max(Delta.x, Solid.x + Solid.width - Fox.x);
+            }
+        }
+    }
+
+    const float Left{Fox.x + Delta.x};
+    for (const Rectangle& Solid:Blockers) {
+        if (Left < Solid.x + Solid.width - Skin && Left + Fox.width > Solid.x + Skin) {
+            if (Step.y > 0.f && Fox.y + Fox.height <= Solid.y + Skin) {
+                Delta.y = std::min(Delta.y, Solid.y - (Fox.y + Fox.height));
+            }
+            else if (Step.y < 0.f && Fox.y >= Solid.y + Solid.height - Skin) {
+                Delta.y = std::max(Delta.y, Solid.y + Solid.height - Fox.y);
+            }
+        }
+    }
+
+    return Delta;
+}
+
 void Character::UndoMovement()
 {
     WorldPos = PrevWorldPos;
@@ -169,30 +240,37 @@ void Character::UndoMovement()
 
 void Character::CheckOutOfBounds()
 {
-    float CurrentSpriteWidth{static_cast<float>(Sprites.at(SpriteIndex).Texture.width/Sprites.at(SpriteIndex).MaxFramesX)};
-    float CurrentSpriteHeight{static_cast<float>(Sprites.at(SpriteIndex).Texture.height/Sprites.at(SpriteIndex).MaxFramesY)};
+    float CurrentSpriteWidth{Sprites.at(SpriteIndex).Sheet->FrameWidth};
+    float CurrentSpriteHeight{Sprites.at(SpriteIndex).Sheet->FrameHeight};
 
+    // each axis is undone on its own so the fox slides along the edge of the map
     if (World.GetArea() == Area::FOREST) {
         if (WorldPos.x + ScreenPos.x < 0.f - (CurrentSpriteWidth)/2.f ||
-            WorldPos.y + ScreenPos.y < 0.f - (CurrentSpriteHeight)/2.f ||
-            WorldPos.x + (Screen.x - ScreenPos.x) > World.GetForestMapSize().x + (CurrentSpriteWidth)/2.f ||
+            WorldPos.x + (Screen.x - ScreenPos.x) > World.GetForestMapSize().x + (CurrentSpriteWidth)/2.f)
+        {
+            WorldPos.x = PrevWorldPos.x;
+        }
+        if (WorldPos.y + ScreenPos.y < 0.f - (CurrentSpriteHeight)/2.f ||
             WorldPos.y + (Screen.y - ScreenPos.y) > World.GetForestMapSize().y + (CurrentSpriteHeight)/2.f)
         {
-            UndoMovement();
+            WorldPos.y = PrevWorldPos.y;
         }
     }
     else if (World.GetArea() == Area::DUNGEON) {
         if (WorldPos.x + ScreenPos.x < 64.f - (CurrentSpriteWidth)/2.f ||
-            WorldPos.y + ScreenPos.y < 128.f - (CurrentSpriteHeight)/2.f ||
-            WorldPos.x + (Screen.x - ScreenPos.x) > World.GetDungeonMapSize().x + (CurrentSpriteWidth)/2.f - 65.f||
+            WorldPos.x + (Screen.x - ScreenPos.x) > World.GetDungeonMapSize().x + (CurrentSpriteWidth)/2.f - 65.f)
+        {
+            WorldPos.x = PrevWorldPos.x;
+        }
+        if (WorldPos.y + ScreenPos.y < 128.f - (CurrentSpriteHeight)/2.f ||
             WorldPos.y + (Screen.y - ScreenPos.y) > World.GetDungeonMapSize().y + (CurrentSpriteHeight)/2.f - 44.f)
         {
-            UndoMovement();
+            WorldPos.y = PrevWorldPos.y;
         }
     }
 }
 
-void Character::CheckCollision(std::vector<std::vector<Prop>>& Props, const Vector2 Direction, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees)
+void Character::CheckCollision(std::pmr::vector<std::pmr::vector<Prop>>& Props, const Vector2 Direction, std::pmr::vector<Enemy>& Enemies)
 {
     DamageTime += GetFrameTime();
     
@@ -223,15 +301,6 @@ void Character::CheckCollision(std::vector<std::vector<Prop>>& Props, const Vect
                                     UndoMovement();
                                 }
                             }
-                            if (Prop.GetType() == PropType::GRASS) {
-                                Prop.SetActive(true);
-                            }
-                        }
-                        // if not pushable, block movement   
-                        else {
-                            if (Prop.IsSpawned()) {
-                                UndoMovement();
-                            }
                         }
                     }
                     else {
@@ -277,70 +346,60 @@ void Character::CheckCollision(std::vector<std::vector<Prop>>& Props, const Vect
             }
         }
 
-        // Loop for tree collision
-        for (auto& Tree:Trees) {
-            if (Tree.HasCollision() && Tree.IsSpawned() && (CheckCollisionRecs(GetCollisionRec(), Tree.GetCollisionRec(WorldPos)))) {
-                UndoMovement();
-            }
-        }
-        
         // Loop through all Enemies for collision
         for (auto& Enemy:Enemies) {
+            if (Enemy.IsAlive()) {
 
-            if (Enemy.GetType() != EnemyType::NPC) {
-                if (Enemy.IsAlive()) {
-
-                    // Check collision of Player against Enemy
-                    if ((Enemy.IsSummoned() && !Enemy.IsDying()) && CheckCollisionRecs(GetCollisionRec(), Enemy.GetCollisionRec())) {
-                        if (Enemy.GetType() == EnemyType::NORMAL) {
-                            DamageTaken = 0.5f;
-                        }
-                        else {
-                            DamageTaken = 1.f;
-                        }
-                        TakeDamage();
-                    }
-
-                    // Check collision of Player's attack against Enemy
-                    if (Attacking && !Enemy.IsInvulnerable() && (CheckCollisionRecs(GetAttackRec(), Enemy.GetCollisionRec()))) {
-                        Enemy.Damaged(true);
+                // Check collision of Player against Enemy
+                if ((Enemy.IsSummoned() && !Enemy.IsDying()) && CheckCollisionRecs(GetCollisionRec(), Enemy.GetCollisionRec())) {
+                    if (Enemy.GetType() == EnemyType::NORMAL) {
+                        DamageTaken = 0.5f;
                     }
                     else {
-                        Enemy.Damaged(false);
+                        DamageTaken = 1.f;
                     }
+                    TakeDamage();
+                }
 
-                    // Check if Enemy Attack Collision is hitting Player
-                    if (Enemy.IsAttacking() && !Enemy.IsDying() && (CheckCollisionRecs(GetCollisionRec(), Enemy.GetAttackRec()))) {
-                        TakeDamage();
-                    }
+                // Check collision of Player's attack against Enemy
+                if (Attacking && !Enemy.IsInvulnerable() && (CheckCollisionRecs(GetAttackRec(), Enemy.GetCollisionRec()))) {
+                    Enemy.Damaged(true);
+                }
+                else {
+                    Enemy.Damaged(false);
+                }
 
-                    // Heal fox if enemy is killed
-                    if (Enemy.IsDying()) {
-                        if (Enemy.GetMaxHP() >= 8 && Enemy.GetHealth() <= 0) {
-                            Healing = true;
-                            AmountToHeal = 4.f;
-                        }
-                        else if (Enemy.GetMaxHP() >= 5 && Enemy.GetHealth() <= 0) {
-                            Healing = true;
-                            AmountToHeal = 2.5f;
-                        }
-                        else if (Enemy.GetMaxHP() >= 1 && Enemy.GetHealth() <= 0) {
-                            Healing = true;
-                            AmountToHeal = 1.5f;
-                        }
-                    }
+                // Check if Enemy Attack Collision is hitting Player
+                if (Enemy.IsAttacking() && !Enemy.IsRanged() && !Enemy.IsDying() && (CheckCollisionRecs(GetCollisionRec(), Enemy.GetAttackRec()))) {
+                    TakeDamage();
                 }
-                if (Hurting) {
-                    if (DamageTime >= 1.f) {
-                        Hurting = false;
+
+                // Heal fox if enemy is killed
+                if (Enemy.IsDying()) {
+                    if (Enemy.GetMaxHP() >= 8 && Enemy.GetHealth() <= 0) {
+                        Healing = true;
+                        AmountToHeal = 4.f;
+                    }
+                    else if (Enemy.GetMaxHP() >= 5 && Enemy.GetHealth() <= 0) {
+                        Healing = true;
+                        AmountToHeal = 2.5f;
+                    }
+                    else if (Enemy.GetMaxHP() >= 1 && Enemy.GetHealth() <= 0) {
+                        Healing = true;
+                        AmountToHeal = 1.5f;
                     }
                 }
             }
+            if (Hurting) {
+                if (DamageTime >= 1.f) {
+                    Hurting = false;
+                }
+            }
         }
     }
 }
 
-void Character::CheckCollision(std::vector<Enemy>& Enemies)
+void Character::CheckCollision(std::pmr::vector<Enemy>& Enemies)
 {
     DamageTime += GetFrameTime();
 
@@ -368,7 +427,7 @@ void Character::CheckCollision(std::vector<Enemy>& Enemies)
                     }
 
                     // Check if Enemy Attack Collision is hitting Player
-                    if (Enemy.IsAttacking() && !Enemy.IsDying() && (CheckCollisionRecs(GetCollisionRec(), Enemy.GetAttackRec()))) {
+                    if (Enemy.IsAttacking() && !Enemy.IsRanged() && !Enemy.IsDying() && (CheckCollisionRecs(GetCollisionRec(), Enemy.GetAttackRec()))) {
                         DamageTaken = 1.f;
                         TakeDamage();
                     }
@@ -528,23 +587,20 @@ void Character::CheckEmotion()
 void Character::DrawIndicator() 
 {
     if (Interactable) {
-        DrawTextureEx(GameTextures.Interact, Vector2Subtract(ScreenPos, Vector2{-58.f, -20.f}), 0.f, 2.f, WHITE);
+        DrawTextureEx(GameTextures.Use(GameTextures.Interact), Vector2Subtract(ScreenPos, Vector2{-58.f, -20.f}), 0.f, 2.f, WHITE);
     }
 };
 
 void Character::UpdateSource()
 {
     // Update which portion of the sprite sheet gets drawn
-    Source.x = Sprites.at(SpriteIndex).FrameX * Sprites.at(SpriteIndex).Texture.width / Sprites.at(SpriteIndex).MaxFramesX;
-    Source.y = Sprites.at(SpriteIndex).FrameY * Sprites.at(SpriteIndex).Texture.height / Sprites.at(SpriteIndex).MaxFramesY;
-    Source.width = Sprites.at(SpriteIndex).Texture.width/Sprites.at(SpriteIndex).MaxFramesX;
-    Source.height = Sprites.at(SpriteIndex).Texture.height/Sprites.at(SpriteIndex).MaxFramesY;
+    Source = Sprites.at(SpriteIndex).GetSourceRec(Animations.GetFrame(Clips.at(SpriteIndex)));
 }
 
 Rectangle Character::GetCollisionRec()
 {
-    float CurrentSpriteWidth{static_cast<float>(Sprites.at(SpriteIndex).Texture.width/Sprites.at(SpriteIndex).MaxFramesX)};
-    float CurrentSpriteHeight{static_cast<float>(Sprites.at(SpriteIndex).Texture.height/Sprites.at(SpriteIndex).MaxFramesY)};
+    float CurrentSpriteWidth{Sprites.at(SpriteIndex).Sheet->FrameWidth};
+    float CurrentSpriteHeight{Sprites.at(SpriteIndex).Sheet->FrameHeight};
 
     return Rectangle 
     {
@@ -557,8 +613,8 @@ Rectangle Character::GetCollisionRec()
 
 Rectangle Character::GetAttackRec()
 {
-    float CurrentSpriteWidth{static_cast<float>(Sprites.at(SpriteIndex).Texture.width/Sprites.at(SpriteIndex).MaxFramesX)};
-    float CurrentSpriteHeight{static_cast<float>(Sprites.at(SpriteIndex).Texture.height/Sprites.at(SpriteIndex).MaxFramesY)};
+    float CurrentSpriteWidth{Sprites.at(SpriteIndex).Sheet->FrameWidth};
+    float CurrentSpriteHeight{Sprites.at(SpriteIndex).Sheet->FrameHeight};
 
     switch (Face)
     {
@@ -690,6 +746,15 @@ void Character::TakeDamage()
     }
 }
 
+// Hits that land outside CheckCollision, such as projectiles
+void Character::TakeHit(const float Damage)
+{
+    if (Collidable) {
+        DamageTaken = Damage;
+        TakeDamage();
+    }
+}
+
 void Character::CheckMapChange(const Area& CurrentMap)
 {
     if (CurrentMap != PrevMap) {
@@ -724,43 +789,39 @@ void Character::CheckDungeonExit(Enemy& FinalBoss)
 // ------------------------- Audio ---------------------------
 void Character::AttackAudio()
 {
-    SetSoundVolume(Audio.FoxAttack, 0.4f);
-    PlaySound(Audio.FoxAttack);
+    Audio.Effects.Play(Cue::FOXATTACK, 0.4f);
 }
 
 void Character::DamageAudio()
 {
-    SetSoundVolume(Audio.FoxAttack, 0.2f);
     DamageAudioTime += GetFrameTime();
 
     if (DamageAudioTime >= 0.7f) {
-        PlaySoundMulti(Audio.ImpactMedium);
+        Audio.Effects.Play(Cue::IMPACTMEDIUM);
         DamageAudioTime = 0.f;
     }
 }
 
 void Character::WalkingAudio()
 {
-    SetSoundVolume(Audio.Walking, 0.2f);
     WalkingAudioTime += GetFrameTime();
 
     if (Walking && WalkingAudioTime >= 1.f/3.f) {
-        PlaySoundMulti(Audio.Walking);
+        Audio.Effects.Play(Cue::WALKING, 0.2f);
         WalkingAudioTime = 0.f;
     }
     else if (Walking && IsKeyDown(KEY_LEFT_SHIFT) && WalkingAudioTime >= 1.f/3.5f) {
-        PlaySoundMulti(Audio.Walking);
+        Audio.Effects.Play(Cue::WALKING, 0.2f);
         WalkingAudioTime = 0.f;
     }
 }
 
 void Character::PushingAudio()
 {
-    SetSoundVolume(Audio.Pushing, 0.7f);
     PushingAudioTime += GetFrameTime();
 
     if (Colliding && PushingAudioTime >= 1.f) {
-        PlaySoundMulti(Audio.Pushing);
+        Audio.Effects.Play(Cue::PUSHING, 0.7f);
         PushingAudioTime = 0.f;
     }
 }
@@ -782,17 +843,16 @@ void Character::HealOverTime(float HP, float TimeToHeal)
 {   
     // Gradually heal fox when killing an enemy
     HealTime += GetFrameTime();
-    static float StopHealing{HP};
 
-    if (StopHealing >= HP) {
-        StopHealing = 0.f;
+    if (Healed >= HP) {
+        Healed = 0.f;
         Healing = false;
         return;
     }
     else {
         if (HealTime >= TimeToHeal) {
             AddHealth(0.5f);
-            StopHealing += 0.5f;
+            Healed += 0.5f;
             HealTime = 0.f;
         }
     }
@@ -0,0 +1,49 @@
+#include "cuequeue.hpp"
+
+CueQueue::CueQueue()
+{
+    // a slot is free for the producer whose ticket matches its sequence
+    for (size_t i{}; i < Capacity; ++i) {
+        Ring[i].Sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool CueQueue::Push(const CueEvent& Event)
+{
+    size_t Ticket{Head.load(std::memory_order_relaxed)};
+
+    while (true) {
+        Slot& Target{Ring[Ticket & (Capacity - 1)]};
+        size_t Sequence{Target.Sequence.load(std::memory_order_acquire)};
+
+        if (Sequence == Ticket) {
+            // claim the slot, another producer winning just moves us on to the next ticket
+            if (Head.compare_exchange_weak(Ticket, Ticket + 1, std::memory_order_relaxed)) {
+                Target.Event = Event;
+                Target.Sequence.store(Ticket + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (Sequence < Ticket) {
+            // the consumer has not freed this slot yet, the ring is full
+            return false;
+        }
+        else {
+            Ticket = Head.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool CueQueue::Pop(CueEvent& Event)
+{
+    Slot& Source{Ring[Tail & (Capacity - 1)]};
+
+    if (Source.Sequence.load(std::memory_order_acquire) != Tail + 1) {
+        return false;
+    }
+
+    Event = Source.Event;
+    Source.Sequence.store(Tail + Capacity, std::memory_order_release);
+    ++Tail;
+    return true;
+}
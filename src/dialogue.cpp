@@ -0,0 +1,221 @@
+#include "dialogue.hpp"
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cctype>
+
+namespace
+{
+    const std::map<std::string, PropType> Speakers {
+        {"NPC_DIANA", PropType::NPC_DIANA},
+        {"NPC_JADE", PropType::NPC_JADE},
+        {"NPC_SON", PropType::NPC_SON},
+        {"NPC_RUMBY", PropType::NPC_RUMBY},
+        {"TREASURE", PropType::TREASURE},
+        {"BIGTREASURE", PropType::BIGTREASURE},
+        {"ANIMATEDALTAR", PropType::ANIMATEDALTAR},
+        {"STUMP", PropType::STUMP}
+    };
+
+    const std::map<std::string, Progress> Acts {
+        {"ACT_O", Progress::ACT_O}, {"ACT_I", Progress::ACT_I}, {"ACT_II", Progress::ACT_II},
+        {"ACT_III", Progress::ACT_III}, {"ACT_IV", Progress::ACT_IV}, {"ACT_V", Progress::ACT_V},
+        {"ACT_VI", Progress::ACT_VI}, {"ACT_VII", Progress::ACT_VII}, {"ACT_VIII", Progress::ACT_VIII},
+        {"ACT_IX", Progress::ACT_IX}, {"ACT_X", Progress::ACT_X}
+    };
+
+    constexpr int FontSize{20};
+    constexpr int LineSpacing{25};
+    constexpr int FooterSize{16};
+    constexpr Vector2 FooterPos{390.f, 675.f};
+
+    // padded so the prompt sits in the bottom right of the speech box
+    constexpr const char* FooterLarge{"                                                         (ENTER to Continue)"};
+    constexpr const char* FooterSmall{"                                               (ENTER to Continue)"};
+}
+
+Dialogue::Dialogue(const std::string& Path)
+{
+    Load(Path);
+}
+
+Dialogue::~Dialogue()
+{
+    if (Composed) {
+        UnloadRenderTexture(Target);
+    }
+}
+
+Dialogue::Dialogue(Dialogue&& Other) noexcept
+    : Pages{std::move(Other.Pages)}, Target{Other.Target}, Bounds{Other.Bounds},
+      Current{Other.Current}, CurrentItem{std::move(Other.CurrentItem)}, Composed{Other.Composed}
+{
+    Other.Composed = false;
+}
+
+void Dialogue::Load(const std::string& Path)
+{
+    std::ifstream File{Path};
+
+    if (!File.is_open()) {
+        TraceLog(LOG_WARNING, "DIALOGUE: [%s] Failed to open dialogue table", Path.c_str());
+        return;
+    }
+
+    DialoguePage* Page{nullptr};
+    std::string Line{};
+    int LineNumber{};
+
+    while (std::getline(File, Line)) {
+        ++LineNumber;
+
+        if (!Line.empty() && Line.back() == '\r') {
+            Line.pop_back();
+        }
+
+        if (!Line.empty() && Line.front() == '#') {
+            continue;
+        }
+
+        // page header -> [SPEAKER PAGE]
+        if (!Line.empty() && Line.front() == '[' && Line.back() == ']') {
+            std::istringstream Header{Line.substr(1, Line.size() - 2)};
+            std::string Speaker{};
+            std::string Number{};
+            Header >> Speaker >> Number;
+
+            Page = nullptr;
+
+            if (!Speakers.contains(Speaker)) {
+                TraceLog(LOG_WARNING, "DIALOGUE: [%s:%i] Unknown speaker %s", Path.c_str(), LineNumber, Speaker.c_str());
+                continue;
+            }
+
+            int Index{};
+            if (Acts.contains(Number)) {
+                Index = static_cast<int>(Acts.at(Number));
+            }
+            else if (!Number.empty() && std::all_of(Number.begin(), Number.end(), [](const unsigned char c) {return std::isdigit(c);})) {
+                Index = std::stoi(Number);
+            }
+            else if (!Number.empty()) {
+                TraceLog(LOG_WARNING, "DIALOGUE: [%s:%i] Invalid page %s", Path.c_str(), LineNumber, Number.c_str());
+                continue;
+            }
+
+            Page = &Pages[std::make_pair(Speakers.at(Speaker), Index)];
+            *Page = DialoguePage{};
+            continue;
+        }
+
+        if (!Page) {
+            continue;
+        }
+
+        if (!Line.empty() && Line.front() == '@') {
+            std::istringstream Directive{Line.substr(1)};
+            std::string Name{};
+            Directive >> Name;
+
+            if (Name == "next") {
+                std::string Act{};
+                Directive >> Act;
+                if (Acts.contains(Act)) {
+                    Page->Next = Acts.at(Act);
+                }
+                else {
+                    TraceLog(LOG_WARNING, "DIALOGUE: [%s:%i] Unknown act %s", Path.c_str(), LineNumber, Act.c_str());
+                }
+            }
+            else if (Name == "origin") {
+                Directive >> Page->Origin.x >> Page->Origin.y;
+            }
+            else if (Name == "box") {
+                std::string Box{};
+                Directive >> Box;
+                Page->SmallBox = (Box == "small");
+            }
+            else {
+                TraceLog(LOG_WARNING, "DIALOGUE: [%s:%i] Unknown directive @%s", Path.c_str(), LineNumber, Name.c_str());
+            }
+            continue;
+        }
+
+        Page->Lines.emplace_back(Line);
+    }
+
+    // blank lines between pages are not part of the text
+    for (auto& [Key, Entry]:Pages) {
+        while (!Entry.Lines.empty() && Entry.Lines.back().empty()) {
+            Entry.Lines.pop_back();
+        }
+    }
+}
+
+Progress Dialogue::GetNext(const PropType Speaker, const int Page) const
+{
+    auto Entry{Pages.find(std::make_pair(Speaker, Page))};
+    return Entry != Pages.end() ? Entry->second.Next : Progress::ACT_O;
+}
+
+void Dialogue::Compose(const PropType Speaker, const int Page, const std::string_view Item)
+{
+    // a missing page still shows the continue prompt
+    const DialoguePage Empty{};
+    auto Entry{Pages.find(std::make_pair(Speaker, Page))};
+    const DialoguePage& Text{Entry != Pages.end() ? Entry->second : Empty};
+    const char* Footer{Text.SmallBox ? FooterSmall : FooterLarge};
+
+    std::vector<std::string> Lines{};
+    // the lines are data, so the item is spliced in rather than handing them to printf
+    for (std::string Line:Text.Lines) {
+        if (const size_t Slot{Line.find("%s")}; Slot != std::string::npos) {
+            Line.replace(Slot, 2, Item);
+        }
+        Lines.emplace_back(std::move(Line));
+    }
+
+    // fit the render texture around the text and the continue prompt
+    float Left{std::min(Text.Origin.x, FooterPos.x)};
+    float Top{std::min(Text.Origin.y, FooterPos.y)};
+    float Right{FooterPos.x + MeasureText(Footer, FooterSize)};
+    float Bottom{FooterPos.y + FooterSize};
+
+    for (size_t i{}; i < Lines.size(); ++i) {
+        Right = std::max(Right, Text.Origin.x + MeasureText(Lines[i].c_str(), FontSize));
+        Bottom = std::max(Bottom, Text.Origin.y + LineSpacing * i + FontSize);
+    }
+
+    if (Composed && (Bounds.width != Right - Left || Bounds.height != Bottom - Top)) {
+        UnloadRenderTexture(Target);
+        Composed = false;
+    }
+
+    Bounds = Rectangle{Left, Top, Right - Left, Bottom - Top};
+
+    if (!Composed) {
+        Target = LoadRenderTexture(static_cast<int>(Bounds.width), static_cast<int>(Bounds.height));
+        Composed = true;
+    }
+
+    BeginTextureMode(Target);
+    ClearBackground(BLANK);
+    for (size_t i{}; i < Lines.size(); ++i) {
+        DrawText(Lines[i].c_str(), static_cast<int>(Text.Origin.x - Left), static_cast<int>(Text.Origin.y - Top) + LineSpacing * static_cast<int>(i), FontSize, WHITE);
+    }
+    DrawText(Footer, static_cast<int>(FooterPos.x - Left), static_cast<int>(FooterPos.y - Top), FooterSize, WHITE);
+    EndTextureMode();
+
+    Current = std::make_pair(Speaker, Page);
+    CurrentItem = Item;
+}
+
+void Dialogue::Draw(const PropType Speaker, const int Page, const std::string_view Item)
+{
+    if (!Composed || Current != std::make_pair(Speaker, Page) || CurrentItem != Item) {
+        Compose(Speaker, Page, Item);
+    }
+
+    // render textures are stored upside down
+    DrawTextureRec(Target.texture, Rectangle{0.f, 0.f, Bounds.width, -Bounds.height}, Vector2{Bounds.x, Bounds.y}, WHITE);
+}
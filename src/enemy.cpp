@@ -1,18 +1,5 @@
 #include "enemy.hpp"
 
-int Enemy::MonsterCount{};
-int Enemy::MonsterDeaths{};
-
-std::unordered_map<EnemyType, int> Enemy::MonsterCounter
-{
-    {EnemyType::BEAR, 0}, {EnemyType::BEHOLDER, 0}, 
-    {EnemyType::CREATURE, 0}, {EnemyType::GHOST, 0}, 
-    {EnemyType::IMP, 0}, {EnemyType::MUSHROOM, 0},
-    {EnemyType::NECROMANCER, 0}, {EnemyType::SHADOW, 0}, 
-    {EnemyType::SPIDER, 0}, {EnemyType::TOAD, 0},
-    {EnemyType::BOSS, 0} 
-};
-
 Enemy::Enemy(const Sprite& Idle,
              const Sprite& Walk,
              const Sprite& Attack,
@@ -22,44 +9,38 @@ Enemy::Enemy(const Sprite& Idle,
              const EnemyType Race,
              const EnemyType Type,
              const Vector2 WorldPos,
-             const Window& Screen,
-             Background& World,
-             const GameTexture& GameTextures,
-             const GameAudio& Audio,
-             Randomizer& RandomEngine,
+             EnemyContext& Context,
              const int Health,
              const float Scale, 
              const EnemyType BossSpawner)
-    : Race{Race},
+    : Sprites{Idle, Walk, Attack, Hurt, Death, Projectile},
+      Race{Race},
       Type{Type},
       WorldPos{WorldPos},
-      Screen{Screen},
-      World{World},
-      GameTextures{GameTextures},
-      Audio{Audio},
-      RandomEngine{RandomEngine},
+      Context{Context},
+      Archetype{GetArchetype(Race)},
+      Random{Context.RandomEngine.Split()},
+      Volley{Pattern::GetScript(Type)},
       BossSpawner{BossSpawner},
       Health{Health},
       MaxHP{Health},
       Scale{Scale}
 {
-    // Fill vector<Sprite*> with Sprite objects to easily loop through and call Sprite::Tick()
-    Sprites.emplace_back(Idle);
-    Sprites.emplace_back(Walk);
-    Sprites.emplace_back(Attack);
-    Sprites.emplace_back(Hurt);
-    Sprites.emplace_back(Death);
-    Sprites.emplace_back(Projectile);
+    for (size_t i{}; i < Sprites.size(); ++i) {
+        if (Sprites[i].Sheet) {
+            Clips[i] = Context.Animations.Add(Sprites[i].Sheet->FramesX, Sprites[i].Sheet->UpdateTime);
+        }
+    }
 
     CurrentSpriteIndex = static_cast<int>(Monster::IDLE);
     ShootingSpriteIndex = static_cast<int>(Monster::PROJECTILE);
 
-    // Static variable to count how many enemies on the field
+    // Count how many enemies are on the field
     if (Type == EnemyType::NORMAL) {
-        MonsterCounter[Race] += 1;
+        Context.Monsters.Alive[Race] += 1;
     }
     else if (Type == EnemyType::BOSS) {
-        MonsterCounter[EnemyType::BOSS] += 1;
+        Context.Monsters.Alive[EnemyType::BOSS] += 1;
         Summoned = false;
     }
     else {
@@ -70,75 +51,29 @@ Enemy::Enemy(const Sprite& Idle,
         this->BossSpawner = Race;
     }
 
-    if (Race == EnemyType::BEHOLDER || Race == EnemyType::NECROMANCER || Race == EnemyType::IMP) {
-        Ranged = true;
-    }
-
-    MonsterCount += 1;
+    Context.Monsters.Count += 1;
 
     // Generate RNG for current object used for randomizing AI movement
-    ActionIdleTime = static_cast<float>(RandomEngine.Randomize(RandomIdleTime));
-    MoveXRange = RandomEngine.Randomize(RandomRange);
-    MoveYRange = RandomEngine.Randomize(RandomRange);
-    LeftOrRight = RandomEngine.Randomize(RandomLeftRight);
+    ActionIdleTime = static_cast<float>(Random.Randomize(Archetype.IdleTime.Min, Archetype.IdleTime.Max));
+    MoveXRange = Random.Randomize(Archetype.MoveRange.Min, Archetype.MoveRange.Max);
+    MoveYRange = Random.Randomize(Archetype.MoveRange.Min, Archetype.MoveRange.Max);
+    LeftOrRight = Random.Randomize(Archetype.LeftRight.Min, Archetype.LeftRight.Max);
 }
 
-Enemy::Enemy(const Sprite& NpcIdle,
-             const Sprite& NpcIdleTwo,
-             const Sprite& NpcWalk,
-             const Sprite& NpcMisc,
-             const Sprite& NpcSleep,
-             const EnemyType Race,
-             const Vector2 WorldPos,
-             const Window& Screen,
-             Background& World,
-             const GameTexture& GameTextures,
-             const GameAudio& Audio,
-             Randomizer& RandomEngine,
-             const float Scale)
-    : Race{Race},
-      Type{EnemyType::NPC},
-      WorldPos{WorldPos},
-      Screen{Screen},
-      World{World},
-      GameTextures{GameTextures},
-      Audio{Audio},
-      RandomEngine{RandomEngine},
-      Scale{Scale}
-{
-    Sprites.emplace_back(NpcIdle);
-    Sprites.emplace_back(NpcIdleTwo);
-    Sprites.emplace_back(NpcWalk);
-    Sprites.emplace_back(NpcMisc);
-    Sprites.emplace_back(NpcSleep);
-
-    CurrentSpriteIndex = static_cast<int>(NPC::IDLE);
-
-    ActionIdleTime = static_cast<float>(RandomEngine.Randomize(RandomIdleTime));
-    MoveXRange = RandomEngine.Randomize(RandomRange);
-    MoveYRange = RandomEngine.Randomize(RandomRange);
-    LeftOrRight = RandomEngine.Randomize(RandomLeftRight);
-    ActionState = RandomEngine.Randomize(RandomActionState);
-}
-
-void Enemy::Tick(float DeltaTime, Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees)
+void Enemy::Tick(float DeltaTime, Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, std::pmr::vector<Enemy>& Enemies, std::pmr::vector<Prop>& Trees)
 {   
     UpdateScreenPos(HeroWorldPos);
             
     if (Visible) {
-        if (Type != EnemyType::NPC) {
-            if (Alive && Summoned) {
-                SpriteTick(DeltaTime);
-                CheckDirection();
-                NeutralAction();
-                TakeDamage();
-                CheckAlive(DeltaTime);
-            }
-        }
-        else {
-            SpriteTick(DeltaTime);
+        if (Alive && Summoned) {
+            SpriteTick();
             CheckDirection();
             NeutralAction();
+            TakeDamage();
+            CheckAlive(DeltaTime);
+        }
+        else {
+            StopSprites();
         }
 
         if (Summoned) {
@@ -146,6 +81,8 @@ void Enemy::Tick(float DeltaTime, Props& Props, const Vector2 HeroWorldPos, cons
         }
     }
     else {
+        StopSprites();
+
         if (Type == EnemyType::BOSS || Type == EnemyType::FINALBOSS) {
             CheckBossSummon(HeroWorldPos);
         }
@@ -153,40 +90,28 @@ void Enemy::Tick(float DeltaTime, Props& Props, const Vector2 HeroWorldPos, cons
     CheckSpawnChest(Props.Over);
 }
 
-void Enemy::Draw(const Vector2 HeroWorldPos)
+void Enemy::Draw(const Vector2 HeroWorldPos, UILayer& Interface)
 {
     if (WithinScreen(HeroWorldPos)) {
         Visible = true;
 
         if (!OOB) {
-            if (Type == EnemyType::NORMAL || Type == EnemyType::NPC || (Type == EnemyType::BOSS && Summoned) || (Type == EnemyType::FINALBOSS && Summoned)) {
+            if (Type == EnemyType::NORMAL || (Type == EnemyType::BOSS && Summoned) || (Type == EnemyType::FINALBOSS && Summoned)) {
                 if (Hurting) {
-                    DrawTexturePro(Sprites.at(CurrentSpriteIndex).Texture, Sprites.at(CurrentSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(ScreenPos,Scale), Vector2{},0.f, RED);
+                    DrawTexturePro(Context.GameTextures.Use(Sprites.at(CurrentSpriteIndex).Sheet->Texture), Sprites.at(CurrentSpriteIndex).GetSourceRec(Context.Animations.GetFrame(Clips.at(CurrentSpriteIndex))), Sprites.at(CurrentSpriteIndex).GetPosRec(ScreenPos,Scale), Vector2{},0.f, RED);
                 }
                 else {
-                    DrawTexturePro(Sprites.at(CurrentSpriteIndex).Texture, Sprites.at(CurrentSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(ScreenPos,Scale), Vector2{},0.f, WHITE);
-                }
-
-                // Draw Ranged projectile
-                if (Ranged && Attacking && !Dying && !Hurting) {
-                    if (Type == EnemyType::NORMAL) {
-                        DrawTexturePro(Sprites.at(ShootingSpriteIndex).Texture, Sprites.at(ShootingSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(UpdateProjectile(),Scale), Vector2{},0.f, WHITE);
-                    }
-                    else if (Type == EnemyType::BOSS || Type == EnemyType::FINALBOSS) {
-                        DrawTexturePro(Sprites.at(ShootingSpriteIndex).Texture, Sprites.at(ShootingSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(UpdateMultiProjectile().at(0),Scale), Vector2{},0.f, WHITE);
-                        DrawTexturePro(Sprites.at(ShootingSpriteIndex).Texture, Sprites.at(ShootingSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(UpdateMultiProjectile().at(1),Scale), Vector2{},0.f, WHITE);
-                        DrawTexturePro(Sprites.at(ShootingSpriteIndex).Texture, Sprites.at(ShootingSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(UpdateMultiProjectile().at(2),Scale), Vector2{},0.f, WHITE);
-                    }
+                    DrawTexturePro(Context.GameTextures.Use(Sprites.at(CurrentSpriteIndex).Sheet->Texture), Sprites.at(CurrentSpriteIndex).GetSourceRec(Context.Animations.GetFrame(Clips.at(CurrentSpriteIndex))), Sprites.at(CurrentSpriteIndex).GetPosRec(ScreenPos,Scale), Vector2{},0.f, WHITE);
                 }
             }
         }
         // OOB is used for debugging purposes only
         else {
-            DrawTexturePro(Sprites.at(CurrentSpriteIndex).Texture, Sprites.at(CurrentSpriteIndex).GetSourceRec(), Sprites.at(CurrentSpriteIndex).GetPosRec(ScreenPos,Scale), Vector2{},0.f, PURPLE);
+            DrawTexturePro(Context.GameTextures.Use(Sprites.at(CurrentSpriteIndex).Sheet->Texture), Sprites.at(CurrentSpriteIndex).GetSourceRec(Context.Animations.GetFrame(Clips.at(CurrentSpriteIndex))), Sprites.at(CurrentSpriteIndex).GetPosRec(ScreenPos,Scale), Vector2{},0.f, PURPLE);
         }
 
-        if (Alive && Summoned && (Type != EnemyType::NPC)) {
-            DrawHP();
+        if (Alive && Summoned) {
+            DrawHP(Interface);
         }
     }
     else {
@@ -194,23 +119,35 @@ void Enemy::Draw(const Vector2 HeroWorldPos)
     }
 }
 
-void Enemy::SpriteTick(float DeltaTime)
+void Enemy::CollectTextures(std::vector<Texture2D>& Into) const
 {
-    for (auto& Sprite:Sprites) {   
-        if (Type != EnemyType::NPC) {
-            // Don't call Sprite::Tick() on the death sprite UNTIL Dying==true so that it will start from FrameX=0 when it does need to play
-            if (&Sprite != &Sprites.at(4)) {
-                Sprite.Tick(DeltaTime);
-            }
-            else {
-                if (Dying) {
-                    Sprite.Tick(DeltaTime);
-                }
-            }
+    for (const auto& Sprite:Sprites) {
+        if (Sprite.Sheet) {
+            Into.emplace_back(Sprite.Sheet->Texture);
         }
-        else {
-            Sprite.Tick(DeltaTime);
+    }
+}
+
+void Enemy::SpriteTick()
+{
+    // Only the sprite being shown is advanced by the animator, projectiles animate off the global clock.
+    // The death sprite is never played until Dying so it starts from FrameX=0 when it is needed
+    int Current{Clips.at(CurrentSpriteIndex)};
+
+    if (PlayingClip != Current) {
+        if (PlayingClip != Animator::NoClip) {
+            Context.Animations.Stop(PlayingClip);
         }
+        PlayingClip = Current;
+        Context.Animations.Play(PlayingClip);
+    }
+}
+
+void Enemy::StopSprites()
+{
+    if (PlayingClip != Animator::NoClip) {
+        Context.Animations.Stop(PlayingClip);
+        PlayingClip = Animator::NoClip;
     }
 }
 
@@ -221,68 +158,38 @@ void Enemy::UpdateScreenPos(const Vector2 HeroWorldPos)
 
 void Enemy::CheckDirection()
 {   
-    // NPC only has left and right orientation sprites
-    if (Type == EnemyType::NPC) {
+    if (!Chasing) {
+        if (AIY < 0.f) {
+            Face = Direction::UP;
+        }
         if (AIX < 0.f) {
             Face = Direction::LEFT;
         }
+        if (AIY > 0.f) {
+            Face = Direction::DOWN;
+        }
         if (AIX > 0.f) {
             Face = Direction::RIGHT;
         }
     }
-    else {
-        if (!Chasing) {
-            if (AIY < 0.f) {
-                Face = Direction::UP;
-            }
-            if (AIX < 0.f) {
-                Face = Direction::LEFT;
-            }
-            if (AIY > 0.f) {
-                Face = Direction::DOWN;
-            }
-            if (AIX > 0.f) {
-                Face = Direction::RIGHT;
-            }
-        }
-    }
 
-    if (Type != EnemyType::NPC) {
-        switch (Face)
-        {
-            case Direction::DOWN: 
-                Sprites.at(CurrentSpriteIndex).FrameY = 0;
-                break;
-            case Direction::LEFT: 
-                Sprites.at(CurrentSpriteIndex).FrameY = 1;
-                break;
-            case Direction::RIGHT:
-                Sprites.at(CurrentSpriteIndex).FrameY = 2;
-                break;
-            case Direction::UP: 
-                Sprites.at(CurrentSpriteIndex).FrameY = 3;
-                break;
-        }
-    }
-    else {
-        switch (Face)
-        {
-            case Direction::DOWN: 
-                Sprites.at(CurrentSpriteIndex).FrameY = 0;
-                break;
-            case Direction::LEFT: 
-                Sprites.at(CurrentSpriteIndex).FrameY = 1;
-                break;
-            case Direction::RIGHT:
-                Sprites.at(CurrentSpriteIndex).FrameY = 0;
-                break;
-            case Direction::UP: 
-                Sprites.at(CurrentSpriteIndex).FrameY = 1;
-                break;
-        }
+    switch (Face)
+    {
+        case Direction::DOWN: 
+            Sprites.at(CurrentSpriteIndex).FrameY = 0;
+            break;
+        case Direction::LEFT: 
+            Sprites.at(CurrentSpriteIndex).FrameY = 1;
+            break;
+        case Direction::RIGHT:
+            Sprites.at(CurrentSpriteIndex).FrameY = 2;
+            break;
+        case Direction::UP: 
+            Sprites.at(CurrentSpriteIndex).FrameY = 3;
+            break;
     }
 
-    if (Ranged) {
+    if (Archetype.Ranged) {
         switch (Face)
         {
             case Direction::DOWN: 
@@ -301,7 +208,7 @@ void Enemy::CheckDirection()
     }
 }
 
-void Enemy::CheckMovement(Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees)
+void Enemy::CheckMovement(Props& Props, const Vector2 HeroWorldPos, const Vector2 HeroScreenPos, std::pmr::vector<Enemy>& Enemies, std::pmr::vector<Prop>& Trees)
 {
     PrevWorldPos = WorldPos;
     
@@ -309,13 +216,11 @@ void Enemy::CheckMovement(Props& Props, const Vector2 HeroWorldPos, const Vector
         EnemyAI();
     }
 
-    if (Type != EnemyType::NPC) {
-        EnemyAggro(HeroScreenPos);
-    }
+    EnemyAggro(HeroScreenPos);
 
     CheckOutOfBounds();
 
-    if (Alive && World.GetArea() == Area::FOREST) {
+    if (Alive && Context.World.GetArea() == Area::FOREST) {
         CheckCollision(Props.Under, HeroWorldPos, Enemies, Trees);
         CheckCollision(Props.Over, HeroWorldPos, Enemies, Trees);
     }
@@ -328,23 +233,23 @@ void Enemy::UndoMovement()
 
 void Enemy::CheckOutOfBounds()
 {
-    float CurrentSpriteWidth{static_cast<float>((Sprites.at(CurrentSpriteIndex).Texture.width/Sprites.at(CurrentSpriteIndex).MaxFramesX) * Scale)};
-    float CurrentSpriteHeight{static_cast<float>((Sprites.at(CurrentSpriteIndex).Texture.height/Sprites.at(CurrentSpriteIndex).MaxFramesY) * Scale)};
+    float CurrentSpriteWidth{Sprites.at(CurrentSpriteIndex).Sheet->FrameWidth * Scale};
+    float CurrentSpriteHeight{Sprites.at(CurrentSpriteIndex).Sheet->FrameHeight * Scale};
 
-    if (World.GetArea() == Area::FOREST) {
+    if (Context.World.GetArea() == Area::FOREST) {
         if (WorldPos.x < 0.f ||
             WorldPos.y < 0.f ||
-            WorldPos.x > World.GetForestMapSize().x - CurrentSpriteWidth ||
-            WorldPos.y > World.GetForestMapSize().y - CurrentSpriteHeight)
+            WorldPos.x > Context.World.GetForestMapSize().x - CurrentSpriteWidth ||
+            WorldPos.y > Context.World.GetForestMapSize().y - CurrentSpriteHeight)
         {
             UndoMovement();
         }
     }
-    else if (World.GetArea() == Area::DUNGEON) {
+    else if (Context.World.GetArea() == Area::DUNGEON) {
         if (WorldPos.x < 64.f ||
             WorldPos.y < 128.f ||
-            WorldPos.x > World.GetDungeonMapSize().x - CurrentSpriteWidth - 64.f ||
-            WorldPos.y > World.GetDungeonMapSize().y - CurrentSpriteHeight - 54.f) 
+            WorldPos.x > Context.World.GetDungeonMapSize().x - CurrentSpriteWidth - 64.f ||
+            WorldPos.y > Context.World.GetDungeonMapSize().y - CurrentSpriteHeight - 54.f) 
         {
             UndoMovement();
         }
@@ -354,189 +259,101 @@ void Enemy::CheckOutOfBounds()
 void Enemy::NeutralAction()
 {
     if (Chasing || Walking) {
-        if (Type == EnemyType::NPC) {
-            CurrentSpriteIndex = static_cast<int>(NPC::WALK);
-        }
-        else {
-            CurrentSpriteIndex = static_cast<int>(Monster::WALK);
-        }
-    }
-    else if (MiscAction && Type == EnemyType::NPC) {
-        CurrentSpriteIndex = static_cast<int>(NPC::MISC);
-    }
-    else if (Sleeping && Type == EnemyType::NPC) {
-        CurrentSpriteIndex = static_cast<int>(NPC::SLEEP);
+        CurrentSpriteIndex = static_cast<int>(Monster::WALK);
     }
     else {
-        if (Type == EnemyType::NPC) {
-            if (IdleTwo) {
-                CurrentSpriteIndex = static_cast<int>(NPC::IDLETWO);
-            }
-            else {
-                CurrentSpriteIndex = static_cast<int>(NPC::IDLE);
-            }
-        }
-        else {
-            CurrentSpriteIndex = static_cast<int>(Monster::IDLE);
-        }
+        CurrentSpriteIndex = static_cast<int>(Monster::IDLE);
     }
 }
 
-void Enemy::CheckCollision(std::vector<std::vector<Prop>>& Props, const Vector2 HeroWorldPos, std::vector<Enemy>& Enemies, std::vector<Prop>& Trees)
+void Enemy::CheckCollision(std::pmr::vector<std::pmr::vector<Prop>>& Props, const Vector2 HeroWorldPos, std::pmr::vector<Enemy>& Enemies, std::pmr::vector<Prop>& Trees)
 {
-    // Crows should not be blocked by anything
-    if (Race != EnemyType::CROW) {
-
-        // Prop collision handling
-        for (auto& PropType:Props) {
-            for (auto& Prop:PropType) {
-                if (Prop.HasCollision() && Prop.IsSpawned()) { 
-                    // move away from props
-                    Vector2 PropScreenPos{Vector2{Prop.GetCollisionRec(HeroWorldPos).x, Prop.GetCollisionRec(HeroWorldPos).y}}; // Grab the collision rectangle screen position
-                    Vector2 RadiusAroundEnemy{5.f,5.f};
-                    Vector2 ToTarget {Vector2Scale(Vector2Normalize(Vector2Subtract(Vector2Add(PropScreenPos, RadiusAroundEnemy), ScreenPos)), Speed)}; // Calculate the distance from Enemy to Prop
-                    float AvoidProp{Vector2Length(Vector2Subtract(Vector2Add(PropScreenPos, RadiusAroundEnemy), ScreenPos))};
-                    
-                    if (AvoidProp <= MinRange && Prop.GetType() != PropType::GRASS) {
-                        WorldPos = Vector2Subtract(WorldPos, ToTarget);
-                    }
-
-                    // activate grass animation
-                    if (CheckCollisionRecs(this->GetCollisionRec(), Prop.GetCollisionRec(HeroWorldPos)) && Prop.GetType() == PropType::GRASS && Alive) {   
-                        Prop.SetActive(true);
-                    }
-                }
+    // Prop collision handling
+    for (auto& PropType:Props) {
+        for (auto& Prop:PropType) {
+            if (Prop.HasCollision() && Prop.IsSpawned()) { 
+                // move away from the collision rectangle's screen position
+                Avoid(Vector2{Prop.GetCollisionRec(HeroWorldPos).x, Prop.GetCollisionRec(HeroWorldPos).y});
             }
         }
-        
-        // Tree collision handling
-        for (auto& Tree:Trees) {
-            if (Tree.HasCollision() && Tree.IsSpawned()) {
-                Vector2 TreeScreenPos{Vector2{Tree.GetCollisionRec(HeroWorldPos).x, Tree.GetCollisionRec(HeroWorldPos).y}}; // Grab the collision rectangle screen position
-                Vector2 RadiusAroundEnemy{5.f,5.f};
-                Vector2 ToTarget {Vector2Scale(Vector2Normalize(Vector2Subtract(Vector2Add(TreeScreenPos, RadiusAroundEnemy), ScreenPos)), Speed)}; // Calculate the distance from Enemy to Tree
-                float AvoidTree{Vector2Length(Vector2Subtract(Vector2Add(TreeScreenPos, RadiusAroundEnemy), ScreenPos))};
-                
-                if (AvoidTree <= MinRange) {
-                    WorldPos = Vector2Subtract(WorldPos, ToTarget);
-                }
-            }
+    }
+    
+    // Tree collision handling
+    for (auto& Tree:Trees) {
+        if (Tree.HasCollision() && Tree.IsSpawned()) {
+            Avoid(Vector2{Tree.GetCollisionRec(HeroWorldPos).x, Tree.GetCollisionRec(HeroWorldPos).y});
         }
     }
 
     // Enemy collision handling
     for (auto& Enemy:Enemies) {
         if (this != &Enemy && (Type != EnemyType::BOSS) && (Enemy.GetType() != EnemyType::BOSS) && !Dying) {
-            Vector2 RadiusAroundEnemy{5.f,5.f};
-            Vector2 ToTarget{Vector2Scale(Vector2Normalize(Vector2Subtract(Vector2Add(Enemy.GetEnemyPos(), RadiusAroundEnemy), ScreenPos)), Speed)}; // Calculate the distance from this->Enemy to Enemy
-            float AvoidEnemy{Vector2Length(Vector2Subtract(Vector2Add(Enemy.GetEnemyPos(), RadiusAroundEnemy), ScreenPos))};
-
-            if (AvoidEnemy <= MinRange) {
-                WorldPos = Vector2Subtract(WorldPos, ToTarget);
-            }
+            Avoid(Enemy.GetEnemyPos());
         }
     }
 }
 
+void Enemy::Avoid(const Vector2 OtherScreenPos)
+{
+    Vector2 RadiusAroundEnemy{5.f,5.f};
+    Vector2 ToTarget{Vector2Scale(Vector2Normalize(Vector2Subtract(Vector2Add(OtherScreenPos, RadiusAroundEnemy), ScreenPos)), Archetype.Speed)}; // Calculate the distance from this->Enemy to the other
+    float AvoidOther{Vector2Length(Vector2Subtract(Vector2Add(OtherScreenPos, RadiusAroundEnemy), ScreenPos))};
+
+    if (AvoidOther <= GetAggroRange().Min) {
+        WorldPos = Vector2Subtract(WorldPos, ToTarget);
+    }
+}
+
 void Enemy::CheckAttack()
 {
     if (Attacking) {
         CurrentSpriteIndex = static_cast<int>(Monster::ATTACK);
 
-        if (Ranged) {
+        if (Archetype.Ranged) {
             ShootingSpriteIndex = static_cast<int>(Monster::PROJECTILE);
         }
     }
     else {
-        Trajectory = 1;
+        ShotTime = ShotInterval;
+        Volley.Reset();
     }
 }
 
-Vector2 Enemy::UpdateProjectile()
-{   
-    if (Trajectory >= 190.f) {
-        Trajectory = 1.f;
-    }
+void Enemy::Shoot(const Vector2 HeroScreenPos)
+{
+    const Sprite& Projectile{Sprites.at(ShootingSpriteIndex)};
 
-    Vector2 ProjectilePath{ScreenPos}; 
-    switch (Face)
-    {
-        case Direction::UP: 
-            ProjectilePath.y -= Trajectory;
-            break;
-        case Direction::DOWN:
-            ProjectilePath.y += Trajectory;
-            break;
-        case Direction::LEFT:
-            ProjectilePath.x -= Trajectory;
-            break;
-        case Direction::RIGHT:
-            ProjectilePath.x += Trajectory;
-            break;
+    // bosses run their bullet pattern script, the fox is aimed at in world space
+    if (Type != EnemyType::NORMAL) {
+        Vector2 Target{Vector2Add(WorldPos, Vector2Subtract(HeroScreenPos, ScreenPos))};
+        Volley.Tick(GetFrameTime(), Context.Missiles, *Projectile.Sheet, WorldPos, Target, Scale);
+        return;
     }
-    return ProjectilePath;
-}
 
-std::array<Vector2,3> Enemy::UpdateMultiProjectile()
-{
-    if (Trajectory >= 190.f) {
-        Trajectory = 1.f;
+    ShotTime += GetFrameTime();
+    if (ShotTime < ShotInterval) {
+        return;
     }
- 
-    std::array<Vector2,3> ProjectilePaths{Vector2{ScreenPos},Vector2{ScreenPos},Vector2{ScreenPos}};
- 
+    ShotTime = 0.f;
+
+    Vector2 Forward{};
     switch (Face)
     {
-        case Direction::UP:
-        {
-            ProjectilePaths.at(0).x -= Trajectory;
-            ProjectilePaths.at(0).y -= Trajectory;
-
-            ProjectilePaths.at(1).x += 0.f;
-            ProjectilePaths.at(1).y -= Trajectory;
-
-            ProjectilePaths.at(2).x += Trajectory;
-            ProjectilePaths.at(2).y -= Trajectory;
+        case Direction::UP: 
+            Forward = {0.f,-1.f};
             break;
-        } 
         case Direction::DOWN:
-        {
-            ProjectilePaths.at(0).x -= Trajectory;
-            ProjectilePaths.at(0).y += Trajectory;
-
-            ProjectilePaths.at(1).x += 0.f;
-            ProjectilePaths.at(1).y += Trajectory;
-
-            ProjectilePaths.at(2).x += Trajectory;
-            ProjectilePaths.at(2).y += Trajectory;
+            Forward = {0.f,1.f};
             break;
-        }
         case Direction::LEFT:
-        {
-            ProjectilePaths.at(0).x -= Trajectory;
-            ProjectilePaths.at(0).y += Trajectory;
-
-            ProjectilePaths.at(1).x -= Trajectory;
-            ProjectilePaths.at(1).y += 0.f;
-
-            ProjectilePaths.at(2).x -= Trajectory;
-            ProjectilePaths.at(2).y -= Trajectory;
+            Forward = {-1.f,0.f};
             break;
-        }
         case Direction::RIGHT:
-        {
-            ProjectilePaths.at(0).x += Trajectory;
-            ProjectilePaths.at(0).y -= Trajectory;
-
-            ProjectilePaths.at(1).x += Trajectory;
-            ProjectilePaths.at(1).y += 0.f;
-
-            ProjectilePaths.at(2).x += Trajectory;
-            ProjectilePaths.at(2).y += Trajectory;
+            Forward = {1.f,0.f};
             break;
-        }
     }
-    return ProjectilePaths;
+
+    Context.Missiles.Spawn(*Projectile.Sheet, Projectile.FrameY, WorldPos, Vector2Scale(Forward, Projectiles::Speed), Scale, 0.5f);
 }
 
 void Enemy::TakeDamage()
@@ -577,7 +394,8 @@ void Enemy::TakeDamage()
             CurrentSpriteIndex = static_cast<int>(Monster::HURT);
             Hurting = true;
             DamageAudio();
-            Trajectory = 1.f;
+            ShotTime = ShotInterval;
+            Volley.Reset();
         }
 
         // This is where the enemy takes damage
@@ -607,13 +425,13 @@ void Enemy::CheckAlive(float DeltaTime)
         // Allow time for death animation to finish before setting alive=false which turns off SpriteTick()
         StopTime += DeltaTime;
         if (StopTime >= EndTime) {
-            MonsterDeaths += 1;
+            Context.Monsters.Deaths += 1;
             Alive = false;
             if (Type != EnemyType::BOSS) {
-                MonsterCounter[Race] -= 1;
+                Context.Monsters.Alive[Race] -= 1;
             }
             else {
-                MonsterCounter[EnemyType::BOSS] -= 1;
+                Context.Monsters.Alive[EnemyType::BOSS] -= 1;
             }
         }
     }
@@ -631,41 +449,17 @@ void Enemy::EnemyAI()
 
         if (ActionTime >= ActionIdleTime) {
             ActionTime = 0.0f;
-            IdleTwo = !IdleTwo;
-            MiscAction = false;
-            Sleeping = false;
             Walking = false;
-            ActionState = RandomEngine.Randomize(RandomActionState);
         }
 
-        if (Type == EnemyType::NPC) {
-            if (ActionState >= 1 && ActionState <= 3) {
-                Walking = false;
-            }
-            else if ((ActionState >= 4 && ActionState <= 6) && (ActionTime <= ActionIdleTime)) {
-                CheckMovementAI();
-                Walking = true;
-                WorldPos.x += AIX;
-                WorldPos.y += AIY;
-            }
-            else if (ActionState == 7 && (ActionTime <= ActionIdleTime)) {
-                MiscAction = true;
-            }
-            else if ((ActionState >= 8 && ActionState <= 10) && (ActionTime <= ActionIdleTime)) {
-                Sleeping = true;
-            }
+        CheckMovementAI();  
+        if (ActionTime <= ActionIdleTime/2) {
+            Walking = true;
+            WorldPos.x += AIX;
+            WorldPos.y += AIY;
         }
-        // all other enemies
         else {
-            CheckMovementAI();  
-            if (ActionTime <= ActionIdleTime/2) {
-                Walking = true;
-                WorldPos.x += AIX;
-                WorldPos.y += AIY;
-            }
-            else {
-                Walking = false;
-            }
+            Walking = false;
         }
     }
 }
@@ -673,40 +467,16 @@ void Enemy::EnemyAI()
 void Enemy::EnemyAggro(const Vector2 HeroScreenPos)
 {
     // Calculate the distance from Enemy to Player
-    Vector2 ToTarget {Vector2Scale(Vector2Normalize(Vector2Subtract(Vector2Add(HeroScreenPos, {50.f, 50.f}), ScreenPos)), Speed)}; 
+    Vector2 ToTarget {Vector2Scale(Vector2Normalize(Vector2Subtract(Vector2Add(HeroScreenPos, {50.f, 50.f}), ScreenPos)), Archetype.Speed)}; 
     
     if (Alive && Summoned && !Stopped && !Invulnerable && !Blocked && !Dying) {
         Vector2 RadiusAroundEnemy{};
 
-        if (Ranged) {
+        // ranged archetypes keep a facing dependent distance band
+        const AggroRange& Range{GetAggroRange()};
+
+        if (Archetype.Ranged) {
             RadiusAroundEnemy = {10.f,10.f}; 
-            switch (Face)
-            {
-                case Direction::DOWN:
-                {
-                    MinRange = 80.f;
-                    MaxRange = 260.f;
-                    break;
-                }
-                case Direction::LEFT:
-                {
-                    MinRange = 140.f;
-                    MaxRange = 200.f;
-                    break;
-                }
-                case Direction::RIGHT:
-                {
-                    MinRange = 80.f;
-                    MaxRange = 260.f;
-                    break;
-                }
-                case Direction::UP:
-                {
-                    MinRange = 140.f;
-                    MaxRange = 200.f;
-                    break;
-                }
-            }
         }
         else {
             RadiusAroundEnemy = {50.f,50.f};
@@ -715,13 +485,13 @@ void Enemy::EnemyAggro(const Vector2 HeroScreenPos)
         float Aggro{Vector2Length(Vector2Subtract(Vector2Add(HeroScreenPos, RadiusAroundEnemy), ScreenPos))};
 
         // Chasing: Only move enemy towards Player if within a certain range
-        if (Aggro > MaxRange) {
+        if (Aggro > Range.Max) {
             ToTarget = {0.f,0.f};
             Chasing = false;
             Attacking = false;
             // AIY = 0.f;
         }
-        else if ((Aggro > MinRange) && (Aggro < MaxRange)) {
+        else if ((Aggro > Range.Min) && (Aggro < Range.Max)) {
             WorldPos = Vector2Add(WorldPos, ToTarget);
             Chasing = true;
             Attacking = false;
@@ -760,10 +530,13 @@ void Enemy::EnemyAggro(const Vector2 HeroScreenPos)
                 }
             }
         }
-        else if (Aggro <= MinRange) {
+        else if (Aggro <= Range.Min) {
             AttackAudio();
             Attacking = true;
-            Trajectory += 1.3f;
+
+            if (Archetype.Ranged && !Dying && !Hurting) {
+                Shoot(HeroScreenPos);
+            }
         }
 
         CheckAttack();
@@ -788,76 +561,40 @@ void Enemy::InitializeAI()
     if (LeftOrRight <= 5) {
         AIX = -AIX;
         AIY = -AIY;
-        IdleTwo = true;
     }
     InitializedAI = true;
 }
 
-void Enemy::DrawHP()
+void Enemy::DrawHP(UILayer& Interface)
 {
-    float LifeBarScale{2.f};
-    float SingleBarWidth{static_cast<float>(GameTextures.LifebarLeftEmpty.width) * LifeBarScale};
-    float MaxBarWidth{SingleBarWidth * MaxHP};
-    float CenterLifeBar {(MaxBarWidth - (Sprites.at(CurrentSpriteIndex).Texture.width/Sprites.at(CurrentSpriteIndex).MaxFramesX)*Scale ) / 2.f};
-    Vector2 LifeBarPos{};                               // Where the lifebar is positioned
-    Vector2 LifeBarPosAdd{SingleBarWidth, 0.f};         // spacing between each life 'bar'
-
-    // update lifebarpos to center of enemy sprite
-    LifeBarPos = Vector2Subtract(ScreenPos, Vector2{CenterLifeBar, 20.f});
-
-    for (auto i = 1; i <= MaxHP; ++i) {
-        if (i <= Health) {
-            // far left of lifebar
-            if (i == 1) {
-                DrawTextureEx(GameTextures.LifebarLeftFilled, LifeBarPos, 0.f, LifeBarScale, WHITE);
-            }
-            // far right of lifebar
-            else if (i == MaxHP) {
-                DrawTextureEx(GameTextures.LifebarRightFilled, LifeBarPos, 0.f, LifeBarScale, WHITE);
-            }
-            // middle of lifebar
-            else {
-                DrawTextureEx(GameTextures.LifebarMiddleFilled, LifeBarPos, 0.f, LifeBarScale, WHITE);
-            }
-        }
-        else {
-            // far left of lifebar
-            if (i == 1) {
-                DrawTextureEx(GameTextures.LifebarLeftEmpty, LifeBarPos, 0.f, LifeBarScale, WHITE);
-            }
-            // far right of lifebar
-            else if (i == MaxHP) {
-                DrawTextureEx(GameTextures.LifebarRightEmpty, LifeBarPos, 0.f, 2.f, WHITE);
-            }
-            // middle of lifebar
-            else {
-                DrawTextureEx(GameTextures.LifebarMiddleEmpty, LifeBarPos, 0.f, 2.f, WHITE);
-            }
-        }
-        // add spacing between each bar
-        LifeBarPos = Vector2Add(LifeBarPos, LifeBarPosAdd);
-    }
+    // segments are only rebuilt when Health changes
+    HPBar.Update(Context.GameTextures, Health, MaxHP);
+
+    float CenterLifeBar {(HPBar.GetWidth() - Sprites.at(CurrentSpriteIndex).Sheet->FrameWidth*Scale ) / 2.f};
+
+    // position lifebar at center of enemy sprite
+    HPBar.Draw(Interface, Vector2Subtract(ScreenPos, Vector2{CenterLifeBar, 20.f}));
 }
 
 void Enemy::CheckBossSummon(const Vector2 HeroWorldPos)
 {
-    if (!WithinScreen(HeroWorldPos) && Type == EnemyType::BOSS && (MonsterCounter[BossSpawner] <= 0) && !Summoned) {
+    if (!WithinScreen(HeroWorldPos) && Type == EnemyType::BOSS && (Context.Monsters.Alive[BossSpawner] <= 0) && !Summoned) {
         Summoned = true;
     }
-    else if (Type == EnemyType::FINALBOSS && (MonsterCounter[BossSpawner] <= 0) && !Summoned && World.GetArea() == Area::DUNGEON) {
+    else if (Type == EnemyType::FINALBOSS && (Context.Monsters.Alive[BossSpawner] <= 0) && !Summoned && Context.World.GetArea() == Area::DUNGEON) {
         Summoned = true;
     }
 }
 
-void Enemy::CheckSpawnChest(std::vector<std::vector<Prop>>& Props)
+void Enemy::CheckSpawnChest(std::pmr::vector<std::pmr::vector<Prop>>& Props)
 {
     for (auto& OuterProp:Props) {
         for (auto& Prop:OuterProp) {
             if ((Type == EnemyType::BOSS || Type == EnemyType::FINALBOSS) && Prop.GetType() == PropType::TREASURE) {
-                if ((Race == EnemyType::CREATURE && !Alive && Prop.GetItemName() == "Top Right Altar Piece") || 
-                    (Race == EnemyType::IMP && !Alive && Prop.GetItemName() == "Top Altar Piece") || 
-                    (Race == EnemyType::BEHOLDER && !Alive && Prop.GetItemName() == "Bottom Altar Piece") ||
-                    (Race == EnemyType::NECROMANCER && !Alive && Prop.GetItemName() == "Bottom Right Altar Piece")) 
+                if ((Race == EnemyType::CREATURE && !Alive && Prop.GetContents() == ItemID::TOP_RIGHT_ALTAR_PIECE) || 
+                    (Race == EnemyType::IMP && !Alive && Prop.GetContents() == ItemID::TOP_ALTAR_PIECE) || 
+                    (Race == EnemyType::BEHOLDER && !Alive && Prop.GetContents() == ItemID::BOTTOM_ALTAR_PIECE) ||
+                    (Race == EnemyType::NECROMANCER && !Alive && Prop.GetContents() == ItemID::BOTTOM_RIGHT_ALTAR_PIECE)) 
                 {
                     Prop.SetSpawned(true);
                 }
@@ -868,135 +605,70 @@ void Enemy::CheckSpawnChest(std::vector<std::vector<Prop>>& Props)
 
 Rectangle Enemy::GetCollisionRec()
 {
-    float CurrentSpriteWidth{static_cast<float>((Sprites.at(CurrentSpriteIndex).Texture.width/Sprites.at(CurrentSpriteIndex).MaxFramesX) * Scale)};
-    float CurrentSpriteHeight{static_cast<float>((Sprites.at(CurrentSpriteIndex).Texture.height/Sprites.at(CurrentSpriteIndex).MaxFramesY) * Scale)};
+    float CurrentSpriteWidth{Sprites.at(CurrentSpriteIndex).Sheet->FrameWidth * Scale};
+    float CurrentSpriteHeight{Sprites.at(CurrentSpriteIndex).Sheet->FrameHeight * Scale};
 
-    switch (Race)
-    {   
-        case EnemyType::FOX:
-        {
+    return Rectangle
+    {
+        ScreenPos.x + CurrentSpriteWidth * Archetype.Collision.X,
+        ScreenPos.y + CurrentSpriteHeight * Archetype.Collision.Y,
+        CurrentSpriteWidth * Archetype.Collision.Width,
+        CurrentSpriteHeight * Archetype.Collision.Height
+    };
+}
+
+Rectangle Enemy::GetAttackRec()
+{
+    // melee reach only, ranged hits come from the projectile pool
+    float CurrentSpriteWidth{Sprites.at(CurrentSpriteIndex).Sheet->FrameWidth * Scale};
+    float CurrentSpriteHeight{Sprites.at(CurrentSpriteIndex).Sheet->FrameHeight * Scale};
+
+    switch (Face)
+    {
+        case Direction::UP:
             return Rectangle
             {
-                ScreenPos.x + CurrentSpriteWidth * .31f,
-                ScreenPos.y + CurrentSpriteHeight * .40f,
-                CurrentSpriteWidth * .40f,
-                CurrentSpriteHeight * .30f
-            };
-        }
-        case EnemyType::CROW:
-        {
+                ScreenPos.x,
+                ScreenPos.y - (CurrentSpriteHeight * 0.4f),
+                CurrentSpriteWidth,
+                CurrentSpriteHeight
+            }; 
+        case Direction::DOWN:
             return Rectangle
             {
-                ScreenPos.x + CurrentSpriteWidth * .31f,
-                ScreenPos.y + CurrentSpriteHeight * .31f,
-                CurrentSpriteWidth * .40f,
-                CurrentSpriteHeight * .30f
-            };
-        }
-        case EnemyType::SQUIRREL:
-        {
+                ScreenPos.x,
+                ScreenPos.y + (CurrentSpriteHeight * 0.4f),
+                CurrentSpriteWidth,
+                CurrentSpriteHeight
+            }; 
+        case Direction::LEFT: 
             return Rectangle
             {
-                ScreenPos.x + CurrentSpriteWidth * .35f,
-                ScreenPos.y + CurrentSpriteHeight * .35f,
-                CurrentSpriteWidth * .20f,
-                CurrentSpriteHeight * .30f
-            };
-        }
-        default:
-        {
-            return Rectangle 
-            {
-                ScreenPos.x + CurrentSpriteWidth * .31f,
-                ScreenPos.y + CurrentSpriteHeight * .31f,
-                CurrentSpriteWidth * .40f,
-                CurrentSpriteHeight * .60f
-            };
-        }
-    }
-}
-
-Rectangle Enemy::GetAttackRec()
-{
-    if (Ranged) {
-        float ShootingSpriteWidth{static_cast<float>(Sprites.at(ShootingSpriteIndex).Texture.width/Sprites.at(ShootingSpriteIndex).MaxFramesX) * Scale};
-        float ShootingSpriteHeight{static_cast<float>(Sprites.at(ShootingSpriteIndex).Texture.height/Sprites.at(ShootingSpriteIndex).MaxFramesY) * Scale};
-        
-        if (Type == EnemyType::NORMAL) {
+                ScreenPos.x - (CurrentSpriteWidth * 0.4f),
+                ScreenPos.y,
+                CurrentSpriteWidth,
+                CurrentSpriteHeight
+            }; 
+        case Direction::RIGHT:
             return Rectangle
             {
-                UpdateProjectile().x + (ShootingSpriteWidth * 0.3f),
-                UpdateProjectile().y + (ShootingSpriteHeight * 0.3f),
-                ShootingSpriteWidth * 0.45f,
-                ShootingSpriteHeight * 0.45f
-            };
-        }
-        else {
-            Rectangle MultiProjectileRec
-            {
-                UpdateMultiProjectile().at(AttackRecIndex).x + (ShootingSpriteWidth * 0.3f),
-                UpdateMultiProjectile().at(AttackRecIndex).y + (ShootingSpriteHeight * 0.3f),
-                ShootingSpriteWidth * 0.45f,
-                ShootingSpriteHeight * 0.45f
-            };
-            ++AttackRecIndex;
-            if (AttackRecIndex > 2) {
-                AttackRecIndex = 0;
-            }
-            return MultiProjectileRec;
-        }
-    }
-    else {
-        float CurrentSpriteWidth{static_cast<float>(Sprites.at(CurrentSpriteIndex).Texture.width/Sprites.at(CurrentSpriteIndex).MaxFramesX) * Scale};
-        float CurrentSpriteHeight{static_cast<float>(Sprites.at(CurrentSpriteIndex).Texture.height/Sprites.at(CurrentSpriteIndex).MaxFramesY) * Scale};
-
-        switch (Face)
-        {
-            case Direction::UP:
-                return Rectangle
-                {
-                    ScreenPos.x,
-                    ScreenPos.y - (CurrentSpriteHeight * 0.4f),
-                    CurrentSpriteWidth,
-                    CurrentSpriteHeight
-                }; 
-            case Direction::DOWN:
-                return Rectangle
-                {
-                    ScreenPos.x,
-                    ScreenPos.y + (CurrentSpriteHeight * 0.4f),
-                    CurrentSpriteWidth,
-                    CurrentSpriteHeight
-                }; 
-            case Direction::LEFT: 
-                return Rectangle
-                {
-                    ScreenPos.x - (CurrentSpriteWidth * 0.4f),
-                    ScreenPos.y,
-                    CurrentSpriteWidth,
-                    CurrentSpriteHeight
-                }; 
-            case Direction::RIGHT:
-                return Rectangle
-                {
-                    ScreenPos.x + (CurrentSpriteWidth * 0.4f),
-                    ScreenPos.y,
-                    CurrentSpriteWidth,
-                    CurrentSpriteHeight
-                }; 
-            default:
-                return Rectangle{};
-        }
+                ScreenPos.x + (CurrentSpriteWidth * 0.4f),
+                ScreenPos.y,
+                CurrentSpriteWidth,
+                CurrentSpriteHeight
+            }; 
+        default:
+            return Rectangle{};
     }
 }
 
 bool Enemy::WithinScreen(const Vector2 HeroWorldPos)
 {
     if (
-        (WorldPos.x >= (HeroWorldPos.x + 615.f) - (GetScreenWidth()/2 + (Sprites.at(CurrentSpriteIndex).Texture.width * Scale))) && 
-        (WorldPos.x <= (HeroWorldPos.x + 615.f) + (GetScreenWidth()/2 + (Sprites.at(CurrentSpriteIndex).Texture.width * Scale))) &&
-        (WorldPos.y >= (HeroWorldPos.y + 335.f) - (GetScreenHeight()/2 + (Sprites.at(CurrentSpriteIndex).Texture.height * Scale))) && 
-        (WorldPos.y <= (HeroWorldPos.y + 335.f) + (GetScreenHeight()/2 + (Sprites.at(CurrentSpriteIndex).Texture.height * Scale)))
+        (WorldPos.x >= (HeroWorldPos.x + 615.f) - (GetScreenWidth()/2 + (Sprites.at(CurrentSpriteIndex).Sheet->Texture.width * Scale))) && 
+        (WorldPos.x <= (HeroWorldPos.x + 615.f) + (GetScreenWidth()/2 + (Sprites.at(CurrentSpriteIndex).Sheet->Texture.width * Scale))) &&
+        (WorldPos.y >= (HeroWorldPos.y + 335.f) - (GetScreenHeight()/2 + (Sprites.at(CurrentSpriteIndex).Sheet->Texture.height * Scale))) && 
+        (WorldPos.y <= (HeroWorldPos.y + 335.f) + (GetScreenHeight()/2 + (Sprites.at(CurrentSpriteIndex).Sheet->Texture.height * Scale)))
        ) {
         return true;
     }
@@ -1008,15 +680,14 @@ bool Enemy::WithinScreen(const Vector2 HeroWorldPos)
 // ------------------------- Audio ---------------------------
 void Enemy::WalkingAudio()
 {
-    SetSoundVolume(Audio.Walking, 0.10f);
     WalkingAudioTime += GetFrameTime();
 
     if (Walking && WalkingAudioTime >= 1.f/3.f) {
-        PlaySoundMulti(Audio.Walking);
+        Context.Audio.Effects.PlayAt(Cue::WALKING, 0.10f, WorldPos);
         WalkingAudioTime = 0.f;
     }
     else if (Chasing && WalkingAudioTime >= 1.f/3.5f) {
-        PlaySoundMulti(Audio.Walking);
+        Context.Audio.Effects.PlayAt(Cue::WALKING, 0.10f, WorldPos);
         WalkingAudioTime = 0.f;
     }
 }
@@ -1026,30 +697,22 @@ void Enemy::AttackAudio()
     AttackAudioTime += GetFrameTime();
 
     if (AttackAudioTime >= 0.6f) {
-        if (Ranged) {
-            SetSoundVolume(Audio.MonsterRangedAttack, 0.7f);
-            PlaySoundMulti(Audio.MonsterRangedAttack);
-        }
-        else {
-            SetSoundVolume(Audio.MonsterAttack, 0.7f);
-            PlaySoundMulti(Audio.MonsterAttack);
-        }
+        Context.Audio.Effects.PlayAt(Archetype.AttackCue, 0.7f, WorldPos);
         AttackAudioTime = 0.f;
     }
 }
 
 void Enemy::DamageAudio()
 {
-    SetSoundVolume(Audio.ImpactHeavy, 0.7f);
-    PlaySound(Audio.ImpactHeavy);
+    Context.Audio.Effects.PlayAt(Cue::IMPACTHEAVY, 0.7f, WorldPos);
 }
 
 void Enemy::DeathAudio()
 {
     if (Type == EnemyType::NORMAL) {
-        PlaySound(Audio.MonsterDeath);
+        Context.Audio.Effects.PlayAt(Cue::MONSTERDEATH, 1.f, WorldPos);
     }
     else if (Type == EnemyType::BOSS || Type == EnemyType::FINALBOSS) {
-        PlaySound(Audio.BossDeath);
+        Context.Audio.Effects.Play(Cue::BOSSDEATH);
     }
 }
\ No newline at end of file
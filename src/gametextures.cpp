@@ -1,413 +0,0 @@
-#include "gametextures.hpp"
-
-GameTexture::~GameTexture()
-{
-    UnloadTexture(AltarBot);
-    UnloadTexture(AltarBotAnimated);
-    UnloadTexture(AltarBotLeft);
-    UnloadTexture(AltarBotLeftAnimated);
-    UnloadTexture(AltarBotRight);
-    UnloadTexture(AltarBotRightAnimated);
-    UnloadTexture(AltarDormant);
-    UnloadTexture(AltarDormantRust);
-    UnloadTexture(AltarTop);
-    UnloadTexture(AltarTopAnimated);
-    UnloadTexture(AltarTopLeft);
-    UnloadTexture(AltarTopLeftAnimated);
-    UnloadTexture(AltarTopRight);
-    UnloadTexture(AltarTopRightAnimated);
-    UnloadTexture(AxeStump);
-    UnloadTexture(BigGrass);
-    UnloadTexture(Boulder);
-    UnloadTexture(Bracelet);
-    UnloadTexture(BridgeHorizontal);
-    UnloadTexture(BridgeRopeBottom);
-    UnloadTexture(BridgeRopeLeft);
-    UnloadTexture(BridgeRopeRight);
-    UnloadTexture(BridgeRopeTop);
-    UnloadTexture(BridgeVertical);
-    UnloadTexture(Bush);
-    UnloadTexture(ClayPot);
-    UnloadTexture(Cryptex);
-    UnloadTexture(Door);
-    UnloadTexture(DoorBlue);
-    UnloadTexture(DoorRed);
-    UnloadTexture(DungeonEntrance);
-    UnloadTexture(FenceDown);
-    UnloadTexture(FenceLeft);
-    UnloadTexture(FenceRight);
-    UnloadTexture(FenceUp);
-    UnloadTexture(FlowerBush);
-    UnloadTexture(Flowers);
-    UnloadTexture(GrassAnimation);
-    UnloadTexture(GrassWallBotLeft);
-    UnloadTexture(GrassWallBotRight);
-    UnloadTexture(GrassWallBottom);
-    UnloadTexture(GrassWallInnerLeft);
-    UnloadTexture(GrassWallInnerRight);
-    UnloadTexture(GrassWallLeft);
-    UnloadTexture(GrassWallRight);
-    UnloadTexture(GrassWallTop);
-    UnloadTexture(GrassWallTopLeft);
-    UnloadTexture(GrassWallTopRight);
-    UnloadTexture(Hole);
-    UnloadTexture(HouseBlue);
-    UnloadTexture(HouseRed);
-    UnloadTexture(Interact);
-    UnloadTexture(LifebarLeftEmpty);
-    UnloadTexture(LifebarLeftFilled);
-    UnloadTexture(LifebarMiddleEmpty);
-    UnloadTexture(LifebarMiddleFilled);
-    UnloadTexture(LifebarRightEmpty);
-    UnloadTexture(LifebarRightFilled);
-    UnloadTexture(LargeRocks);
-    UnloadTexture(LittleGrass);
-    UnloadTexture(LittleRocks);
-    UnloadTexture(MediumRocks);
-    UnloadTexture(Placeholder);
-    UnloadTexture(RockStump);
-    UnloadTexture(Sapling);
-    UnloadTexture(Sign);
-    UnloadTexture(SpeechBox);
-    UnloadTexture(SpeechName);
-    UnloadTexture(SquareContainer);
-    UnloadTexture(Stones);
-    UnloadTexture(TransparentContainer);
-    UnloadTexture(TransparentSquare);
-    UnloadTexture(TreasureChest);
-    UnloadTexture(TreasureChestBig);
-    UnloadTexture(TreasureHeart);
-    UnloadTexture(TreeBlue);
-    UnloadTexture(TreeClear);
-    UnloadTexture(TreeFall);
-    UnloadTexture(TreeGreen);
-    UnloadTexture(TreePink);
-    UnloadTexture(TreeStump);
-    UnloadTexture(UnderFlowersOne);
-    UnloadTexture(UnderFlowersTwo);
-    UnloadTexture(UnderFlowersThree);
-    UnloadTexture(WallBotLeft);
-    UnloadTexture(WallBotRight);
-    UnloadTexture(WallBottom);
-    UnloadTexture(WallLeft);
-    UnloadTexture(WallRight);
-    UnloadTexture(WallTopLeft);
-    UnloadTexture(WallTopRight);
-    UnloadTexture(Didi);
-    UnloadTexture(Jade);
-    UnloadTexture(Son);
-    UnloadTexture(Rumby);
-    UnloadTexture(RumbySide);
-    UnloadTexture(FoxIdle);
-    UnloadTexture(FoxWalk);
-    UnloadTexture(FoxRun);
-    UnloadTexture(FoxMelee);
-    UnloadTexture(FoxHit);
-    UnloadTexture(FoxDie);
-    UnloadTexture(FoxPush);
-    UnloadTexture(FoxSleeping);
-    UnloadTexture(FoxItemGot);
-    UnloadTexture(FoxPortraitFrame);
-    UnloadTexture(FoxPortraitAngry);
-    UnloadTexture(FoxPortraitHappy);
-    UnloadTexture(FoxPortraitNervous);
-    UnloadTexture(FoxPortraitSad);
-    UnloadTexture(FoxPortraitSleeping);
-    UnloadTexture(FoxPortraitHurt);
-    UnloadTexture(FoxPortraitDead);
-    UnloadTexture(HeartFull);
-    UnloadTexture(HeartHalf);
-    UnloadTexture(HeartEmpty);
-    UnloadTexture(ButtonW);
-    UnloadTexture(ButtonA);
-    UnloadTexture(ButtonS);
-    UnloadTexture(ButtonD);
-    UnloadTexture(ButtonL);
-    UnloadTexture(ButtonM);
-    UnloadTexture(Shift);
-    UnloadTexture(Space);
-    UnloadTexture(Lmouse);
-    UnloadTexture(Map);
-    UnloadTexture(MiniMap);
-    UnloadTexture(DungeonMap);
-    UnloadTexture(PauseBackground);
-    UnloadTexture(BearBrownAttack);
-    UnloadTexture(BearBrownDeath);
-    UnloadTexture(BearBrownHurt);
-    UnloadTexture(BearBrownIdle);
-    UnloadTexture(BearBrownWalk);
-    UnloadTexture(BearGreyAttack);
-    UnloadTexture(BearGreyDeath);
-    UnloadTexture(BearGreyHurt);
-    UnloadTexture(BearGreyIdle);
-    UnloadTexture(BearGreyWalk);
-    UnloadTexture(BearLightBrownAttack);
-    UnloadTexture(BearLightBrownDeath);
-    UnloadTexture(BearLightBrownHurt);
-    UnloadTexture(BearLightBrownIdle);
-    UnloadTexture(BearLightBrownWalk);
-    UnloadTexture(BearWhiteAttack);
-    UnloadTexture(BearWhiteDeath);
-    UnloadTexture(BearWhiteHurt);
-    UnloadTexture(BearWhiteIdle);
-    UnloadTexture(BearWhiteWalk);
-    UnloadTexture(BeholderAquaAttack);
-    UnloadTexture(BeholderAquaDeath);
-    UnloadTexture(BeholderAquaHurt);
-    UnloadTexture(BeholderAquaIdle);
-    UnloadTexture(BeholderAquaProjectile);
-    UnloadTexture(BeholderAquaWalk);
-    UnloadTexture(BeholderBlackAttack);
-    UnloadTexture(BeholderBlackDeath);
-    UnloadTexture(BeholderBlackHurt);
-    UnloadTexture(BeholderBlackIdle);
-    UnloadTexture(BeholderBlackProjectile);
-    UnloadTexture(BeholderBlackWalk);
-    UnloadTexture(BeholderBlueAttack);
-    UnloadTexture(BeholderBlueDeath);
-    UnloadTexture(BeholderBlueHurt);
-    UnloadTexture(BeholderBlueIdle);
-    UnloadTexture(BeholderBlueProjectile);
-    UnloadTexture(BeholderBlueWalk);
-    UnloadTexture(BeholderGreenAttack);
-    UnloadTexture(BeholderGreenDeath);
-    UnloadTexture(BeholderGreenHurt);
-    UnloadTexture(BeholderGreenIdle);
-    UnloadTexture(BeholderGreenProjectile);
-    UnloadTexture(BeholderGreenWalk);
-    UnloadTexture(BeholderRedAttack);
-    UnloadTexture(BeholderRedDeath);
-    UnloadTexture(BeholderRedHurt);
-    UnloadTexture(BeholderRedIdle);
-    UnloadTexture(BeholderRedProjectile);
-    UnloadTexture(BeholderRedWalk);
-    UnloadTexture(CreatureAquaAttack);
-    UnloadTexture(CreatureAquaDeath);
-    UnloadTexture(CreatureAquaHurt);
-    UnloadTexture(CreatureAquaIdle);
-    UnloadTexture(CreatureAquaWalk);
-    UnloadTexture(CreatureGreyAttack);
-    UnloadTexture(CreatureGreyDeath);
-    UnloadTexture(CreatureGreyHurt);
-    UnloadTexture(CreatureGreyIdle);
-    UnloadTexture(CreatureGreyWalk);
-    UnloadTexture(CreatureOrangeAttack);
-    UnloadTexture(CreatureOrangeDeath);
-    UnloadTexture(CreatureOrangeHurt);
-    UnloadTexture(CreatureOrangeIdle);
-    UnloadTexture(CreatureOrangeWalk);
-    UnloadTexture(CreaturePurpleAttack);
-    UnloadTexture(CreaturePurpleDeath);
-    UnloadTexture(CreaturePurpleHurt);
-    UnloadTexture(CreaturePurpleIdle);
-    UnloadTexture(CreaturePurpleWalk);
-    UnloadTexture(CreatureRedAttack);
-    UnloadTexture(CreatureRedDeath);
-    UnloadTexture(CreatureRedHurt);
-    UnloadTexture(CreatureRedIdle);
-    UnloadTexture(CreatureRedWalk);
-    UnloadTexture(GhostBlackAttack);
-    UnloadTexture(GhostBlackDeath);
-    UnloadTexture(GhostBlackHurt);
-    UnloadTexture(GhostBlackIdle);
-    UnloadTexture(GhostBlackWalk);
-    UnloadTexture(GhostBlueAttack);
-    UnloadTexture(GhostBlueDeath);
-    UnloadTexture(GhostBlueHurt);
-    UnloadTexture(GhostBlueIdle);
-    UnloadTexture(GhostBlueWalk);
-    UnloadTexture(GhostGreenAttack);
-    UnloadTexture(GhostGreenDeath);
-    UnloadTexture(GhostGreenHurt);
-    UnloadTexture(GhostGreenIdle);
-    UnloadTexture(GhostGreenWalk);
-    UnloadTexture(GhostRedAttack);
-    UnloadTexture(GhostRedDeath);
-    UnloadTexture(GhostRedHurt);
-    UnloadTexture(GhostRedIdle);
-    UnloadTexture(GhostRedWalk);
-    UnloadTexture(GhostWhiteAttack);
-    UnloadTexture(GhostWhiteDeath);
-    UnloadTexture(GhostWhiteHurt);
-    UnloadTexture(GhostWhiteIdle);
-    UnloadTexture(GhostWhiteWalk);
-    UnloadTexture(GhostYellowAttack);
-    UnloadTexture(GhostYellowDeath);
-    UnloadTexture(GhostYellowHurt);
-    UnloadTexture(GhostYellowIdle);
-    UnloadTexture(GhostYellowWalk);
-    UnloadTexture(ImpBlueAttack);
-    UnloadTexture(ImpBlueDeath);
-    UnloadTexture(ImpBlueHurt);
-    UnloadTexture(ImpBlueIdle);
-    UnloadTexture(ImpBlueProjectile);
-    UnloadTexture(ImpBlueWalk);
-    UnloadTexture(ImpGreenAttack);
-    UnloadTexture(ImpGreenDeath);
-    UnloadTexture(ImpGreenHurt);
-    UnloadTexture(ImpGreenIdle);
-    UnloadTexture(ImpGreenProjectile);
-    UnloadTexture(ImpGreenWalk);
-    UnloadTexture(ImpGreyAttack);
-    UnloadTexture(ImpGreyDeath);
-    UnloadTexture(ImpGreyHurt);
-    UnloadTexture(ImpGreyIdle);
-    UnloadTexture(ImpGreyProjectile);
-    UnloadTexture(ImpGreyWalk);
-    UnloadTexture(ImpRedAttack);
-    UnloadTexture(ImpRedDeath);
-    UnloadTexture(ImpRedHurt);
-    UnloadTexture(ImpRedIdle);
-    UnloadTexture(ImpRedProjectile);
-    UnloadTexture(ImpRedWalk);
-    UnloadTexture(ImpYellowAttack);
-    UnloadTexture(ImpYellowDeath);
-    UnloadTexture(ImpYellowHurt);
-    UnloadTexture(ImpYellowIdle);
-    UnloadTexture(ImpYellowProjectile);
-    UnloadTexture(ImpYellowWalk);
-    UnloadTexture(MushroomBlueAttack);
-    UnloadTexture(MushroomBlueDeath);
-    UnloadTexture(MushroomBlueHurt);
-    UnloadTexture(MushroomBlueIdle);
-    UnloadTexture(MushroomBlueWalk);
-    UnloadTexture(MushroomBrownAttack);
-    UnloadTexture(MushroomBrownDeath);
-    UnloadTexture(MushroomBrownHurt);
-    UnloadTexture(MushroomBrownIdle);
-    UnloadTexture(MushroomBrownWalk);
-    UnloadTexture(MushroomGreenAttack);
-    UnloadTexture(MushroomGreenDeath);
-    UnloadTexture(MushroomGreenHurt);
-    UnloadTexture(MushroomGreenIdle);
-    UnloadTexture(MushroomGreenWalk);
-    UnloadTexture(MushroomPinkAttack);
-    UnloadTexture(MushroomPinkDeath);
-    UnloadTexture(MushroomPinkHurt);
-    UnloadTexture(MushroomPinkIdle);
-    UnloadTexture(MushroomPinkWalk);
-    UnloadTexture(MushroomRedAttack);
-    UnloadTexture(MushroomRedDeath);
-    UnloadTexture(MushroomRedHurt);
-    UnloadTexture(MushroomRedIdle);
-    UnloadTexture(MushroomRedWalk);
-    UnloadTexture(MushroomTealAttack);
-    UnloadTexture(MushroomTealDeath);
-    UnloadTexture(MushroomTealHurt);
-    UnloadTexture(MushroomTealIdle);
-    UnloadTexture(MushroomTealWalk);
-    UnloadTexture(NecromancerBlueAttack);
-    UnloadTexture(NecromancerBlueDeath);
-    UnloadTexture(NecromancerBlueHurt);
-    UnloadTexture(NecromancerBlueIdle);
-    UnloadTexture(NecromancerBlueProjectile);
-    UnloadTexture(NecromancerBlueWalk);
-    UnloadTexture(NecromancerBrownAttack);
-    UnloadTexture(NecromancerBrownDeath);
-    UnloadTexture(NecromancerBrownHurt);
-    UnloadTexture(NecromancerBrownIdle);
-    UnloadTexture(NecromancerBrownProjectile);
-    UnloadTexture(NecromancerBrownWalk);
-    UnloadTexture(NecromancerPurpleAttack);
-    UnloadTexture(NecromancerPurpleDeath);
-    UnloadTexture(NecromancerPurpleHurt);
-    UnloadTexture(NecromancerPurpleIdle);
-    UnloadTexture(NecromancerPurpleProjectile);
-    UnloadTexture(NecromancerPurpleWalk);
-    UnloadTexture(NecromancerRedAttack);
-    UnloadTexture(NecromancerRedDeath);
-    UnloadTexture(NecromancerRedHurt);
-    UnloadTexture(NecromancerRedIdle);
-    UnloadTexture(NecromancerRedProjectile);
-    UnloadTexture(NecromancerRedWalk);
-    UnloadTexture(ShadowBlueAttack);
-    UnloadTexture(ShadowBlueDeath);
-    UnloadTexture(ShadowBlueHurt);
-    UnloadTexture(ShadowBlueIdle);
-    UnloadTexture(ShadowBlueWalk);
-    UnloadTexture(ShadowRedAttack);
-    UnloadTexture(ShadowRedDeath);
-    UnloadTexture(ShadowRedHurt);
-    UnloadTexture(ShadowRedIdle);
-    UnloadTexture(ShadowRedWalk);
-    UnloadTexture(ShadowTealAttack);
-    UnloadTexture(ShadowTealDeath);
-    UnloadTexture(ShadowTealHurt);
-    UnloadTexture(ShadowTealIdle);
-    UnloadTexture(ShadowTealWalk);
-    UnloadTexture(ShadowYellowAttack);
-    UnloadTexture(ShadowYellowDeath);
-    UnloadTexture(ShadowYellowHurt);
-    UnloadTexture(ShadowYellowIdle);
-    UnloadTexture(ShadowYellowWalk);
-    UnloadTexture(SpiderBlackAttack);
-    UnloadTexture(SpiderBlackDeath);
-    UnloadTexture(SpiderBlackHurt);
-    UnloadTexture(SpiderBlackIdle);
-    UnloadTexture(SpiderBlackWalk);
-    UnloadTexture(SpiderBlueAttack);
-    UnloadTexture(SpiderBlueDeath);
-    UnloadTexture(SpiderBlueHurt);
-    UnloadTexture(SpiderBlueIdle);
-    UnloadTexture(SpiderBlueWalk);
-    UnloadTexture(SpiderBrownAttack);
-    UnloadTexture(SpiderBrownDeath);
-    UnloadTexture(SpiderBrownHurt);
-    UnloadTexture(SpiderBrownIdle);
-    UnloadTexture(SpiderBrownWalk);
-    UnloadTexture(SpiderGreenAttack);
-    UnloadTexture(SpiderGreenDeath);
-    UnloadTexture(SpiderGreenHurt);
-    UnloadTexture(SpiderGreenIdle);
-    UnloadTexture(SpiderGreenWalk);
-    UnloadTexture(SpiderRedAttack);
-    UnloadTexture(SpiderRedDeath);
-    UnloadTexture(SpiderRedHurt);
-    UnloadTexture(SpiderRedIdle);
-    UnloadTexture(SpiderRedWalk);
-    UnloadTexture(ToadBlueAttack);
-    UnloadTexture(ToadBlueDeath);
-    UnloadTexture(ToadBlueHurt);
-    UnloadTexture(ToadBlueIdle);
-    UnloadTexture(ToadBlueWalk);
-    UnloadTexture(ToadGreenAttack);
-    UnloadTexture(ToadGreenDeath);
-    UnloadTexture(ToadGreenHurt);
-    UnloadTexture(ToadGreenIdle);
-    UnloadTexture(ToadGreenWalk);
-    UnloadTexture(ToadPinkAttack);
-    UnloadTexture(ToadPinkDeath);
-    UnloadTexture(ToadPinkHurt);
-    UnloadTexture(ToadPinkIdle);
-    UnloadTexture(ToadPinkWalk);
-    UnloadTexture(ToadRedAttack);
-    UnloadTexture(ToadRedDeath);
-    UnloadTexture(ToadRedHurt);
-    UnloadTexture(ToadRedIdle);
-    UnloadTexture(ToadRedWalk);
-    UnloadTexture(ToadWhiteAttack);
-    UnloadTexture(ToadWhiteDeath);
-    UnloadTexture(ToadWhiteHurt);
-    UnloadTexture(ToadWhiteIdle);
-    UnloadTexture(ToadWhiteWalk);
-    UnloadTexture(CrowFlySleep);
-    UnloadTexture(CrowFlying);
-    UnloadTexture(CrowGroundSleep);
-    UnloadTexture(CrowIdle);
-    UnloadTexture(CrowIdleTwo);
-    UnloadTexture(CrowWalk);
-    UnloadTexture(FoxFamilyAngry);
-    UnloadTexture(FoxFamilyIdle);
-    UnloadTexture(FoxFamilyIdleTwo);
-    UnloadTexture(FoxFamilyLazy);
-    UnloadTexture(FoxFamilyRun);
-    UnloadTexture(FoxFamilySleep);
-    UnloadTexture(FoxFamilyWalk);
-    UnloadTexture(SquirrelEat);
-    UnloadTexture(SquirrelIdle);
-    UnloadTexture(SquirrelIdleTwo);
-    UnloadTexture(SquirrelJump);
-    UnloadTexture(SquirrelRun);
-    UnloadTexture(SquirrelSleep);
-    UnloadTexture(SquirrelWalk);
-}
\ No newline at end of file
@@ -6,7 +6,19 @@ HUD::HUD(const GameTexture& GameTextures)
 
 }
 
-void HUD::Draw(float Health, Emotion State)
+void HUD::Tick(float Health, Emotion State)
+{
+    // only recompose the hearts and portrait when something they show has changed
+    if (Health == this->Health && State == this->State) {
+        return;
+    }
+
+    this->Health = Health;
+    this->State = State;
+    Rebuild();
+}
+
+void HUD::Rebuild()
 {
     // manage which fox portraits to draw
     switch (State)
@@ -37,46 +49,48 @@ void HUD::Draw(float Health, Emotion State)
             break;
     }
 
+    auto MakeQuad = [](const Texture2D& Texture, const Vector2 Pos, const float Scale, const int Layer) {
+        return Quad{
+            Texture,
+            Rectangle{0.f, 0.f, static_cast<float>(Texture.width), static_cast<float>(Texture.height)},
+            Rectangle{Pos.x, Pos.y, Texture.width * Scale, Texture.height * Scale},
+            WHITE,
+            Layer
+        };
+    };
+
     Vector2 HeartRowOne{100.f, 30.f}; 
     Vector2 HeartRowTwo{-50.f, 60.f}; 
     Vector2 HeartSpacing{30.f,0.f}; 
     float MaxHP{10.f};
 
-    DrawTextureEx(GameTextures.TransparentContainer, Vector2{15.f, 15.f}, 0.f, 5.f, WHITE);  // Draw Container holding the hearts
-    DrawTextureEx(Fox, Vector2{20.f,20.f}, 0.f, Scale, WHITE);                               // Draw fox portrait
+    Hearts.clear();
+    Hearts.emplace_back(MakeQuad(GameTextures.TransparentContainer, Vector2{15.f, 15.f}, 5.f, 0));  // Container holding the hearts
+    Hearts.emplace_back(MakeQuad(Fox, Vector2{20.f,20.f}, Scale, 1));                               // Fox portrait
 
     for (float i = 1.f; i <= MaxHP; ++i) {
-        // Draw hearts 1-5 on first row
-        if (i <= MaxHP/2.f) {
-            if (i < Health) {
-                if ((i + .5f) == Health) {
-                    DrawTextureEx(GameTextures.HeartHalf, HeartRowOne, 0.f, 3.f, WHITE);
-                }
-                else {
-                    DrawTextureEx(GameTextures.HeartFull, HeartRowOne, 0.f, 3.f, WHITE);
-                }
+        // hearts 1-5 on first row, 6-10 on second row
+        Vector2 HeartPos{i <= MaxHP/2.f ? HeartRowOne : HeartRowTwo};
+
+        if (i < Health) {
+            if ((i + .5f) == Health) {
+                Hearts.emplace_back(MakeQuad(GameTextures.HeartHalf, HeartPos, 3.f, 1));
             }
             else {
-                DrawTextureEx(GameTextures.HeartEmpty, HeartRowOne, 0.f, 3.f, WHITE);
+                Hearts.emplace_back(MakeQuad(GameTextures.HeartFull, HeartPos, 3.f, 1));
             }
         }
-        // Draw hearts 6-10 on second row
         else {
-            if (i < Health) {
-                if ((i + .5f) == Health) {
-                    DrawTextureEx(GameTextures.HeartHalf, HeartRowTwo, 0.f, 3.f, WHITE);
-                }
-                else {
-                    DrawTextureEx(GameTextures.HeartFull, HeartRowTwo, 0.f, 3.f, WHITE);
-                }
-            }
-            else {
-                DrawTextureEx(GameTextures.HeartEmpty, HeartRowTwo, 0.f, 3.f, WHITE);
-            }
+            Hearts.emplace_back(MakeQuad(GameTextures.HeartEmpty, HeartPos, 3.f, 1));
         }
 
         // add spacing between each heart
         HeartRowOne = Vector2Add(HeartRowOne, HeartSpacing);
         HeartRowTwo = Vector2Add(HeartRowTwo, HeartSpacing);
     }
-}
\ No newline at end of file
+}
+
+void HUD::Draw(UILayer& Interface) const
+{
+    Interface.Submit(Hearts);
+}
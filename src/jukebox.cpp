@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <chrono>
+#include "assetarchive.hpp"
+#include "jukebox.hpp"
+
+Jukebox::Jukebox()
+{
+    Streams[static_cast<size_t>(Track::FOREST)].Source = Assets::LoadMusicStream("audio/SecretOfTheForest.mp3");
+    Streams[static_cast<size_t>(Track::DUNGEON)].Source = Assets::LoadMusicStream("audio/ZealPalace.mp3");
+    Streams[static_cast<size_t>(Track::PAUSE)].Source = Assets::LoadMusicStream("audio/PauseMenuTheme.ogg");
+
+    for (auto& Theme:Streams) {
+        Theme.Source.looping = true;
+    }
+
+    // streams are fully set up before the worker can touch them
+    Worker = std::thread{&Jukebox::Run, this};
+}
+
+Jukebox::~Jukebox()
+{
+    Running = false;
+    if (Worker.joinable()) {
+        Worker.join();
+    }
+
+    for (auto& Theme:Streams) {
+        UnloadMusicStream(Theme.Source);
+    }
+}
+
+void Jukebox::Crossfade(const Track From, const Track To, const float Volume, const float Seconds)
+{
+    Post({Action::FADEOUT, From, 0.f, Seconds});
+    Post({Action::FADEIN, To, Volume, Seconds});
+}
+
+// Game thread only. A full ring drops the command rather than block the frame.
+bool Jukebox::Post(const Command& Order)
+{
+    size_t Write{Head.load(std::memory_order_relaxed)};
+    size_t Next{(Write + 1) % Capacity};
+
+    if (Next == Tail.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    Ring[Write] = Order;
+    Head.store(Next, std::memory_order_release);
+    return true;
+}
+
+void Jukebox::Apply(const Command& Order)
+{
+    Stream& Theme{Streams[static_cast<size_t>(Order.Theme)]};
+
+    switch (Order.Type)
+    {
+        case Action::PLAY:
+            Theme.Volume = Order.Volume;
+            Theme.Gain = 1.f;
+            Theme.Rate = 0.f;
+            Theme.Playing = true;
+            PlayMusicStream(Theme.Source);
+            break;
+        case Action::PAUSE:
+            Theme.Playing = false;
+            PauseMusicStream(Theme.Source);
+            break;
+        case Action::RESUME:
+            Theme.Playing = true;
+            ResumeMusicStream(Theme.Source);
+            break;
+        case Action::VOLUME:
+            Theme.Volume = Order.Volume;
+            break;
+        case Action::FADEIN:
+            if (!Theme.Playing) {
+                Theme.Gain = 0.f;
+                Theme.Playing = true;
+                PlayMusicStream(Theme.Source);
+            }
+            Theme.Volume = Order.Volume;
+            Theme.Rate = Order.Seconds > 0.f ? 1.f / Order.Seconds : 1.f;
+            break;
+        case Action::FADEOUT:
+            Theme.Rate = Order.Seconds > 0.f ? -1.f / Order.Seconds : -1.f;
+            break;
+    }
+    SetMusicVolume(Theme.Source, Theme.Volume * Theme.Gain);
+}
+
+void Jukebox::Run()
+{
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point Previous{Clock::now()};
+
+    while (Running) {
+        size_t Read{Tail.load(std::memory_order_relaxed)};
+        while (Read != Head.load(std::memory_order_acquire)) {
+            Apply(Ring[Read]);
+            Read = (Read + 1) % Capacity;
+            Tail.store(Read, std::memory_order_release);
+        }
+
+        Clock::time_point Now{Clock::now()};
+        float DeltaTime{std::chrono::duration<float>(Now - Previous).count()};
+        Previous = Now;
+
+        for (auto& Theme:Streams) {
+            if (!Theme.Playing) {
+                continue;
+            }
+
+            if (Theme.Rate != 0.f) {
+                Theme.Gain = std::clamp(Theme.Gain + Theme.Rate * DeltaTime, 0.f, 1.f);
+                SetMusicVolume(Theme.Source, Theme.Volume * Theme.Gain);
+
+                // a finished fade out pauses the track so it can be resumed later
+                if (Theme.Rate < 0.f && Theme.Gain <= 0.f) {
+                    Theme.Rate = 0.f;
+                    Theme.Gain = 1.f;
+                    Theme.Playing = false;
+                    PauseMusicStream(Theme.Source);
+                    continue;
+                }
+                if (Theme.Rate > 0.f && Theme.Gain >= 1.f) {
+                    Theme.Rate = 0.f;
+                }
+            }
+
+            UpdateMusicStream(Theme.Source);
+        }
+
+        // a few refills per raylib buffer is plenty and keeps the thread mostly asleep
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+}
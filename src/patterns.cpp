@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <cmath>
+#include "patterns.hpp"
+
+namespace
+{
+    // projectile sheets face DOWN, LEFT, RIGHT, UP by row
+    std::uint8_t FacingRow(const Vector2 Heading)
+    {
+        if (std::abs(Heading.x) > std::abs(Heading.y)) {
+            return Heading.x > 0.f ? 2 : 1;
+        }
+        return Heading.y > 0.f ? 0 : 3;
+    }
+}
+
+std::span<const BulletPattern> Pattern::GetScript(const EnemyType Type)
+{
+    switch (Type)
+    {
+        case EnemyType::BOSS:
+            return Pattern::Boss;
+        case EnemyType::FINALBOSS:
+            return Pattern::FinalBoss;
+        default:
+            return {};
+    }
+}
+
+Emitter::Emitter(std::span<const BulletPattern> Script)
+    : Script{Script}
+{
+    Reset();
+}
+
+void Emitter::Tick(const float DeltaTime, Projectiles& Missiles, const SpriteSheet& Sheet, const Vector2 Origin, const Vector2 Target, const float Scale)
+{
+    if (Script.empty()) {
+        return;
+    }
+
+    // a long frame catches up a few steps at most instead of emptying the whole script at once
+    Accumulator = std::min(Accumulator + DeltaTime, Projectiles::MaxCatchUp);
+
+    while (Accumulator >= Projectiles::Step) {
+        Accumulator -= Projectiles::Step;
+        ShotTime += Projectiles::Step;
+
+        const BulletPattern& Pattern{Script[Current]};
+        if (ShotTime < Pattern.Interval) {
+            continue;
+        }
+
+        ShotTime = 0.f;
+        Fire(Pattern, Missiles, Sheet, Origin, Target, Scale);
+        Phase += Pattern.Spin;
+
+        if (++ShotsFired >= Pattern.Shots) {
+            ShotsFired = 0;
+            Phase = 0.f;
+            Current = (Current + 1) % Script.size();
+        }
+    }
+}
+
+void Emitter::Fire(const BulletPattern& Pattern, Projectiles& Missiles, const SpriteSheet& Sheet, const Vector2 Origin, const Vector2 Target, const float Scale)
+{
+    Vector2 ToTarget{Vector2Subtract(Target, Origin)};
+    float Aim{std::atan2(ToTarget.y, ToTarget.x) * RAD2DEG};
+
+    float First{};
+    float Gap{};
+    switch (Pattern.Shape)
+    {
+        case PatternShape::RADIAL:
+        case PatternShape::SPIRAL:
+            First = Phase;
+            Gap = 360.f / Pattern.Count;
+            break;
+        case PatternShape::AIMED:
+            Gap = Pattern.Count > 1 ? Pattern.Spread / (Pattern.Count - 1) : 0.f;
+            First = Aim - Gap * (Pattern.Count - 1) / 2.f;
+            break;
+        case PatternShape::WAVE:
+            // projectiles sit 10 degrees apart and the centre of the fan swings across Spread
+            Gap = 10.f;
+            First = Aim + std::sin(Phase * DEG2RAD) * Pattern.Spread / 2.f - Gap * (Pattern.Count - 1) / 2.f;
+            break;
+    }
+
+    for (int i{}; i < Pattern.Count; ++i) {
+        float Angle{(First + Gap * i) * DEG2RAD};
+        Vector2 Heading{std::cos(Angle), std::sin(Angle)};
+        Missiles.Spawn(Sheet, FacingRow(Heading), Origin, Vector2Scale(Heading, Pattern.Speed), Scale, Pattern.Damage, Pattern.Life);
+    }
+}
@@ -0,0 +1,202 @@
+#include <algorithm>
+#include "projectiles.hpp"
+#include "character.hpp"
+
+void Projectiles::Spawn(const SpriteSheet& Sheet, const std::uint8_t Row, const Vector2 WorldPos, const Vector2 Velocity, const float Scale, const float Damage, const float Life)
+{
+    size_t Slot{Live.size()};
+
+    if (!Free.empty()) {
+        Slot = Free.back();
+        Free.pop_back();
+    }
+    else {
+        X.emplace_back();
+        Y.emplace_back();
+        VelocityX.emplace_back();
+        VelocityY.emplace_back();
+        this->Life.emplace_back();
+        this->Scale.emplace_back();
+        this->Damage.emplace_back();
+        this->Sheet.emplace_back();
+        this->Row.emplace_back();
+        Live.emplace_back();
+    }
+
+    X[Slot] = WorldPos.x;
+    Y[Slot] = WorldPos.y;
+    VelocityX[Slot] = Velocity.x;
+    VelocityY[Slot] = Velocity.y;
+    this->Life[Slot] = Life;
+    this->Scale[Slot] = Scale;
+    this->Damage[Slot] = Damage;
+    this->Sheet[Slot] = &Sheet;
+    this->Row[Slot] = Row;
+    Live[Slot] = 1;
+}
+
+void Projectiles::Tick(const float DeltaTime)
+{
+    Accumulator = std::min(Accumulator + DeltaTime, MaxCatchUp);
+
+    while (Accumulator >= Step) {
+        Advance();
+        Accumulator -= Step;
+    }
+}
+
+// one fixed step over every slot, dead ones included so the loops stay branch free
+void Projectiles::Advance()
+{
+    for (size_t i{}; i < Live.size(); ++i) {
+        X[i] += VelocityX[i] * Step;
+        Y[i] += VelocityY[i] * Step;
+        Life[i] -= Step;
+    }
+
+    for (size_t i{}; i < Live.size(); ++i) {
+        if (Live[i] && Life[i] <= 0.f) {
+            Release(i);
+        }
+    }
+}
+
+void Projectiles::Collide(Character& Fox, Props& Props, std::pmr::vector<Prop>& Trees)
+{
+    if (Count() == 0) {
+        return;
+    }
+
+    Vector2 FoxWorldPos{Fox.GetWorldPos()};
+
+    // gather the solid props around the fox once instead of once per projectile
+    std::vector<Rectangle> Solids{};
+    for (auto* Layer:{&Props.Under, &Props.Over}) {
+        for (auto& PropType:*Layer) {
+            for (auto& Prop:PropType) {
+                if (Prop.HasCollision() && Prop.IsSpawned() && Prop.WithinScreen(FoxWorldPos)) {
+                    Solids.emplace_back(Prop.GetCollisionRec(FoxWorldPos));
+                }
+            }
+        }
+    }
+    for (auto& Tree:Trees) {
+        if (Tree.HasCollision() && Tree.IsSpawned() && Tree.WithinScreen(FoxWorldPos)) {
+            Solids.emplace_back(Tree.GetCollisionRec(FoxWorldPos));
+        }
+    }
+
+    Collide(Fox, Solids);
+}
+
+void Projectiles::Collide(Character& Fox)
+{
+    if (Count() == 0) {
+        return;
+    }
+
+    Collide(Fox, std::vector<Rectangle>{});
+}
+
+void Projectiles::Collide(Character& Fox, const std::vector<Rectangle>& Solids)
+{
+    Vector2 FoxWorldPos{Fox.GetWorldPos()};
+    Rectangle FoxRec{Fox.GetCollisionRec()};
+    bool FoxHittable{Fox.IsCollidable() && Fox.IsAlive()};
+
+    for (size_t i{}; i < Live.size(); ++i) {
+        if (!Live[i]) {
+            continue;
+        }
+
+        Rectangle Hitbox{GetHitbox(i, FoxWorldPos)};
+
+        if (FoxHittable && CheckCollisionRecs(FoxRec, Hitbox)) {
+            Fox.TakeHit(Damage[i]);
+            Release(i);
+            continue;
+        }
+
+        for (const auto& Solid:Solids) {
+            if (CheckCollisionRecs(Solid, Hitbox)) {
+                Release(i);
+                break;
+            }
+        }
+    }
+}
+
+void Projectiles::Draw(const GameTexture& Textures, const Vector2 CharacterWorldPos) const
+{
+    Rectangle ScreenRec{0.f, 0.f, static_cast<float>(GetScreenWidth()), static_cast<float>(GetScreenHeight())};
+
+    for (size_t i{}; i < Live.size(); ++i) {
+        if (!Live[i]) {
+            continue;
+        }
+
+        const SpriteSheet& Current{*Sheet[i]};
+        Rectangle Destination{X[i] - CharacterWorldPos.x, Y[i] - CharacterWorldPos.y, Current.FrameWidth * Scale[i], Current.FrameHeight * Scale[i]};
+
+        if (CheckCollisionRecs(ScreenRec, Destination)) {
+            DrawTexturePro(Textures.Use(Current.Texture), Current.GetFrame(Animator::AmbientFrame(Current.FramesX, Current.UpdateTime), Row[i]), Destination, Vector2{}, 0.f, WHITE);
+        }
+    }
+}
+
+void Projectiles::DrawHitboxes(const Vector2 CharacterWorldPos, const Color RecColor) const
+{
+    for (size_t i{}; i < Live.size(); ++i) {
+        if (Live[i]) {
+            DrawRectangleRec(GetHitbox(i, CharacterWorldPos), RecColor);
+        }
+    }
+}
+
+void Projectiles::Clear()
+{
+    Free.clear();
+    for (size_t i{}; i < Live.size(); ++i) {
+        Live[i] = 0;
+        Free.emplace_back(static_cast<std::uint32_t>(i));
+    }
+}
+
+void Projectiles::Reserve(const size_t Capacity)
+{
+    X.reserve(Capacity);
+    Y.reserve(Capacity);
+    VelocityX.reserve(Capacity);
+    VelocityY.reserve(Capacity);
+    Life.reserve(Capacity);
+    Scale.reserve(Capacity);
+    Damage.reserve(Capacity);
+    Sheet.reserve(Capacity);
+    Row.reserve(Capacity);
+    Live.reserve(Capacity);
+    Free.reserve(Capacity);
+}
+
+void Projectiles::Release(const size_t Slot)
+{
+    Live[Slot] = 0;
+    Life[Slot] = 0.f;
+    VelocityX[Slot] = 0.f;
+    VelocityY[Slot] = 0.f;
+    Free.emplace_back(static_cast<std::uint32_t>(Slot));
+}
+
+Rectangle Projectiles::GetHitbox(const size_t Slot, const Vector2 CharacterWorldPos) const
+{
+    // same fraction of the frame the per-enemy projectile used to test with
+    float Width{Sheet[Slot]->FrameWidth * Scale[Slot]};
+    float Height{Sheet[Slot]->FrameHeight * Scale[Slot]};
+
+    return Rectangle
+    {
+        X[Slot] - CharacterWorldPos.x + Width * 0.3f,
+        Y[Slot] - CharacterWorldPos.y + Height * 0.3f,
+        Width * 0.45f,
+        Height * 0.45f
+    };
+}
@@ -1,6 +1,18 @@
 #include "randomizer.hpp"
 
-int Randomizer::Randomize(std::uniform_int_distribution<int>& Range)
+// Uniform in [Min, Max]. Multiply-shift maps a 32 bit draw onto the range without a division,
+// and the rare draws that would favour the low end are rolled again.
+int Randomizer::Randomize(const int Min, const int Max)
 {
-    return Range(RandomEngine);
-}
\ No newline at end of file
+    const uint32_t Span{static_cast<uint32_t>(static_cast<int64_t>(Max) - Min + 1)};
+    uint64_t Product{(Next() >> 32) * Span};
+
+    if (static_cast<uint32_t>(Product) < Span) {
+        const uint32_t Threshold{static_cast<uint32_t>(0u - Span) % Span};
+        while (static_cast<uint32_t>(Product) < Threshold) {
+            Product = (Next() >> 32) * Span;
+        }
+    }
+
+    return Min + static_cast<int>(Product >> 32);
+}
@@ -0,0 +1,219 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "assetarchive.hpp"
+#include "residency.hpp"
+
+TextureResidency::TextureResidency(const size_t Budget)
+    : Slots(static_cast<size_t>(TextureID::COUNT)), Budget{Budget}
+{
+
+}
+
+TextureResidency::~TextureResidency()
+{
+    if (Pending.valid()) {
+        for (auto& Item:Pending.get()) {
+            if (Item.Owned) {
+                UnloadImage(Item.Pixels);
+            }
+        }
+    }
+    for (auto& Entry:Slots) {
+        Evict(Entry);
+    }
+}
+
+Texture2D TextureResidency::Handle(const TextureID ID) const
+{
+    // layouts only need the size, which the registry already has
+    const TextureAsset& Asset{GetAsset(ID)};
+    return Texture2D{FirstHandle + static_cast<unsigned int>(ID), Asset.Width, Asset.Height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+}
+
+Texture2D TextureResidency::Use(const Texture2D& Handle)
+{
+    // render targets and the solid UI quads never came from Handle
+    if (Handle.id < FirstHandle || Handle.id - FirstHandle >= Slots.size()) {
+        return Handle;
+    }
+
+    const size_t Index{Handle.id - FirstHandle};
+    Slot& Entry{Slots[Index]};
+    if (Entry.Resident.id == 0 && !Entry.Missing) {
+        Load(Index);
+    }
+    Entry.LastUse = Frame;
+
+    return Entry.Resident;
+}
+
+// Uploads a set of textures ahead of use, blocking until they are all resident
+void TextureResidency::Preload(std::span<const TextureID> IDs)
+{
+    std::vector<size_t> Indices{};
+    for (const TextureID ID:IDs) {
+        Indices.emplace_back(static_cast<size_t>(ID));
+    }
+    Upload(Decode(Wanted(Indices)));
+}
+
+// Starts decoding a set of textures in the background. Nothing touches the GL context until
+// Settle is called, so this can be kicked off in the middle of a frame.
+void TextureResidency::Prefetch(std::span<const Texture2D> Handles)
+{
+    // only one batch is in flight at a time
+    while (!Settle()) {
+        Pending.wait();
+    }
+
+    std::vector<size_t> Indices{};
+    for (const Texture2D& Handle:Handles) {
+        if (Handle.id >= FirstHandle && Handle.id - FirstHandle < Slots.size()) {
+            Indices.emplace_back(Handle.id - FirstHandle);
+        }
+    }
+
+    std::vector<size_t> Missing{Wanted(Indices)};
+    if (!Missing.empty()) {
+        Pending = std::async(std::launch::async, Decode, std::move(Missing));
+    }
+}
+
+// Uploads the last Prefetch once its decoding has finished. True once nothing is outstanding.
+bool TextureResidency::Settle()
+{
+    if (!Pending.valid()) {
+        return true;
+    }
+    if (Pending.wait_for(std::chrono::seconds{0}) != std::future_status::ready) {
+        return false;
+    }
+
+    Upload(Pending.get());
+    return true;
+}
+
+void TextureResidency::SetBudget(const size_t Bytes)
+{
+    Budget = Bytes;
+    MakeRoom(0);
+}
+
+std::vector<size_t> TextureResidency::Wanted(std::span<const size_t> Indices) const
+{
+    std::vector<size_t> Wanted{};
+    for (const size_t Index:Indices) {
+        if (Slots[Index].Resident.id == 0 && !Slots[Index].Missing && std::find(Wanted.begin(), Wanted.end(), Index) == Wanted.end()) {
+            Wanted.emplace_back(Index);
+        }
+    }
+    return Wanted;
+}
+
+// Decoding runs across the hardware threads, which costs nothing for packed textures
+std::vector<TextureResidency::Decoded> TextureResidency::Decode(const std::vector<size_t> Indices)
+{
+    std::vector<Decoded> Images(Indices.size());
+    std::atomic<size_t> Next{};
+
+    auto Work = [&] {
+        for (size_t i{Next++}; i < Indices.size(); i = Next++) {
+            Images[i].Index = Indices[i];
+            Images[i].Pixels = Assets::LoadImage(TextureAssets[Indices[i]].Path, Images[i].Owned);
+        }
+    };
+
+    std::vector<std::thread> Workers{};
+    const size_t Helpers{std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u) - 1, Indices.size())};
+    for (size_t i{}; i < Helpers; ++i) {
+        Workers.emplace_back(Work);
+    }
+    Work();
+    for (auto& Worker:Workers) {
+        Worker.join();
+    }
+
+    return Images;
+}
+
+// The uploads touch the GL context and stay on the main thread
+void TextureResidency::Upload(std::vector<Decoded>&& Images)
+{
+    for (auto& Item:Images) {
+        // skip anything drawn, and so loaded, while it was still decoding
+        if (Slots[Item.Index].Resident.id == 0) {
+            Upload(Item.Index, Item.Pixels);
+            // preloaded but not drawn yet, so it ranks behind anything on screen this frame
+            Slots[Item.Index].LastUse = Frame - 1;
+        }
+        if (Item.Owned) {
+            UnloadImage(Item.Pixels);
+        }
+    }
+}
+
+void TextureResidency::Load(const size_t Index)
+{
+    bool Owned{};
+    Image Pixels{Assets::LoadImage(TextureAssets[Index].Path, Owned)};
+    Upload(Index, Pixels);
+    if (Owned) {
+        UnloadImage(Pixels);
+    }
+}
+
+void TextureResidency::Upload(const size_t Index, const Image& Pixels)
+{
+    Slot& Entry{Slots[Index]};
+
+    if (!Pixels.data) {
+        // a missing file would otherwise be retried every frame it is drawn
+        Entry.Missing = true;
+        return;
+    }
+
+    const size_t Bytes{static_cast<size_t>(GetPixelDataSize(Pixels.width, Pixels.height, Pixels.format))};
+    MakeRoom(Bytes);
+
+    Entry.Resident = LoadTextureFromImage(Pixels);
+    if (Entry.Resident.id == 0) {
+        Entry.Missing = true;
+        return;
+    }
+
+    Entry.Bytes = Bytes;
+    ResidentBytes += Bytes;
+}
+
+void TextureResidency::Evict(Slot& Entry)
+{
+    if (Entry.Resident.id == 0) {
+        return;
+    }
+
+    UnloadTexture(Entry.Resident);
+    Entry.Resident = Texture2D{};
+    ResidentBytes -= Entry.Bytes;
+    Entry.Bytes = 0;
+}
+
+void TextureResidency::MakeRoom(const size_t Bytes)
+{
+    while (ResidentBytes + Bytes > Budget) {
+        // anything drawn this frame may still sit in raylib's batch, so it is never a candidate
+        Slot* Oldest{nullptr};
+        for (auto& Entry:Slots) {
+            if (Entry.Resident.id != 0 && Entry.LastUse < Frame && (!Oldest || Entry.LastUse < Oldest->LastUse)) {
+                Oldest = &Entry;
+            }
+        }
+
+        if (!Oldest) {
+            // everything resident is on screen, so run over budget rather than draw nothing
+            return;
+        }
+        Evict(*Oldest);
+    }
+}
@@ -0,0 +1,390 @@
+#include "scene.hpp"
+#include "arena.hpp"
+
+namespace
+{
+    const Sprite& Showing(const Critter& Animal)
+    {
+        return Animal.Sprites.at(static_cast<size_t>(Animal.Current));
+    }
+
+    // only the sheet being shown is advanced by the animator
+    void Play(Critter& Animal, Animator& Animations)
+    {
+        const int Clip{Animal.Clips.at(static_cast<size_t>(Animal.Current))};
+
+        if (Animal.PlayingClip != Clip) {
+            if (Animal.PlayingClip != Animator::NoClip) {
+                Animations.Stop(Animal.PlayingClip);
+            }
+            Animal.PlayingClip = Clip;
+            Animations.Play(Clip);
+        }
+    }
+
+    void Stop(Critter& Animal, Animator& Animations)
+    {
+        if (Animal.PlayingClip != Animator::NoClip) {
+            Animations.Stop(Animal.PlayingClip);
+            Animal.PlayingClip = Animator::NoClip;
+        }
+    }
+
+    NPC Pose(const Wander& Mind)
+    {
+        if (Mind.Walking) {
+            return NPC::WALK;
+        }
+        if (Mind.Misc) {
+            return NPC::MISC;
+        }
+        if (Mind.Sleeping) {
+            return NPC::SLEEP;
+        }
+        return Mind.IdleTwo ? NPC::IDLETWO : NPC::IDLE;
+    }
+
+    // Idles, walks back and forth inside its range, plays its misc animation or sleeps, rolling
+    // a new action every time the current one runs out
+    void Think(Position& Where, Wander& Mind, const EnemyArchetype& Archetype, const float DeltaTime)
+    {
+        Mind.ActionTime += DeltaTime;
+
+        if (Mind.ActionTime >= Mind.IdleTime) {
+            Mind.ActionTime = 0.f;
+            Mind.IdleTwo = !Mind.IdleTwo;
+            Mind.Misc = false;
+            Mind.Sleeping = false;
+            Mind.Walking = false;
+            Mind.ActionState = Mind.Random.Randomize(Archetype.ActionState.Min, Archetype.ActionState.Max);
+        }
+
+        if (Mind.ActionState >= 1 && Mind.ActionState <= 3) {
+            Mind.Walking = false;
+        }
+        else if ((Mind.ActionState >= 4 && Mind.ActionState <= 6) && (Mind.ActionTime <= Mind.IdleTime)) {
+            Mind.Travelled = Vector2Add(Mind.Travelled, Mind.Step);
+            if (Mind.Travelled.x <= -Mind.Range.x || Mind.Travelled.x >= Mind.Range.x) {
+                Mind.Step.x = -Mind.Step.x;
+            }
+            if (Mind.Travelled.y <= -Mind.Range.y || Mind.Travelled.y >= Mind.Range.y) {
+                Mind.Step.y = -Mind.Step.y;
+            }
+
+            Mind.Walking = true;
+            Where.World = Vector2Add(Where.World, Mind.Step);
+        }
+        else if (Mind.ActionState == 7 && (Mind.ActionTime <= Mind.IdleTime)) {
+            Mind.Misc = true;
+        }
+        else if ((Mind.ActionState >= 8 && Mind.ActionState <= 10) && (Mind.ActionTime <= Mind.IdleTime)) {
+            Mind.Sleeping = true;
+        }
+    }
+
+    // step away from anything on screen that is inside the critter's minimum range
+    void Avoid(const Critter& Animal, Position& Where, const Vector2 Target)
+    {
+        Vector2 RadiusAroundEnemy{5.f,5.f};
+        Vector2 Away{Vector2Subtract(Vector2Add(Target, RadiusAroundEnemy), Animal.ScreenPos)};
+
+        if (Vector2Length(Away) <= Animal.Archetype->Aggro.at(static_cast<size_t>(Animal.Face)).Min) {
+            Where.World = Vector2Subtract(Where.World, Vector2Scale(Vector2Normalize(Away), Animal.Archetype->Speed));
+        }
+    }
+}
+
+Entity Systems::SpawnGrass(Scene& Scenery, const SpriteSheet& Sheet, const Vector2 WorldPos, const DrawLayer Layer)
+{
+    Entity Grass{Scenery.Create()};
+
+    Scenery.Emplace<Position>(Grass, WorldPos);
+    Scenery.Emplace<Appearance>(Grass, Sprite{Sheet}, 4.f, Layer);
+    Scenery.Emplace<Hitbox>(Grass, .05f, .4f, .125f, .35f);
+    Scenery.Emplace<Sway>(Grass);
+
+    return Grass;
+}
+
+size_t Systems::SceneBytes(const size_t Grass, const size_t Critters)
+{
+    const size_t Entities{Grass + Critters};
+
+    // the generations, then a sparse index per entity in each of the six pools
+    size_t Bytes{Arena::Bytes<std::uint32_t>(Entities) * 7};
+    Bytes += Arena::Bytes<Position>(Entities) + Arena::Bytes<Entity>(Entities);
+    Bytes += Arena::Bytes<Appearance>(Grass) + Arena::Bytes<Hitbox>(Grass) + Arena::Bytes<Sway>(Grass) + Arena::Bytes<Entity>(Grass) * 3;
+    Bytes += Arena::Bytes<Critter>(Critters) + Arena::Bytes<Wander>(Critters) + Arena::Bytes<Entity>(Critters) * 2;
+    return Bytes;
+}
+
+void Systems::ReserveScene(Scene& Scenery, const size_t Grass, const size_t Critters)
+{
+    Scenery.Reserve(Grass + Critters);
+    Scenery.Storage<Position>().Reserve(Grass + Critters);
+    Scenery.Storage<Appearance>().Reserve(Grass);
+    Scenery.Storage<Hitbox>().Reserve(Grass);
+    Scenery.Storage<Sway>().Reserve(Grass);
+    Scenery.Storage<Critter>().Reserve(Critters);
+    Scenery.Storage<Wander>().Reserve(Critters);
+}
+
+Entity Systems::SpawnCritter(Scene& Scenery, const std::array<Sprite, 5>& Sprites, const EnemyType Race, const Vector2 WorldPos, const float Scale, Animator& Animations, const Randomizer Random)
+{
+    Entity Animal{Scenery.Create()};
+
+    Scenery.Emplace<Position>(Animal, WorldPos);
+
+    Critter& Look{Scenery.Emplace<Critter>(Animal, Sprites)};
+    Look.Archetype = &GetArchetype(Race);
+    Look.Scale = Scale;
+    Look.Flying = Race == EnemyType::CROW;
+    for (size_t i{}; i < Look.Sprites.size(); ++i) {
+        Look.Clips[i] = Animations.Add(Look.Sprites[i].Sheet->FramesX, Look.Sprites[i].Sheet->UpdateTime);
+    }
+
+    Wander& Mind{Scenery.Emplace<Wander>(Animal, Random)};
+    const EnemyArchetype& Archetype{*Look.Archetype};
+    Mind.IdleTime = static_cast<float>(Mind.Random.Randomize(Archetype.IdleTime.Min, Archetype.IdleTime.Max));
+    Mind.Range.x = static_cast<float>(Mind.Random.Randomize(Archetype.MoveRange.Min, Archetype.MoveRange.Max));
+    Mind.Range.y = static_cast<float>(Mind.Random.Randomize(Archetype.MoveRange.Min, Archetype.MoveRange.Max));
+
+    // about half set off up and to the left
+    if (Mind.Random.Randomize(Archetype.LeftRight.Min, Archetype.LeftRight.Max) <= 5) {
+        Mind.Step = Vector2Scale(Mind.Step, -1.f);
+        Mind.IdleTwo = true;
+    }
+    Mind.ActionState = Mind.Random.Randomize(Archetype.ActionState.Min, Archetype.ActionState.Max);
+
+    return Animal;
+}
+
+bool Systems::WithinScreen(const Position& Where, const Appearance& Look, const Vector2 CharacterWorldPos)
+{
+    const Texture2D& Texture{Look.Object.Sheet->Texture};
+    float ReachX{static_cast<float>(GetScreenWidth()/2) + Texture.width * Look.Scale};
+    float ReachY{static_cast<float>(GetScreenHeight()/2) + Texture.height * Look.Scale};
+
+    return (Where.World.x >= (CharacterWorldPos.x + 615.f) - ReachX) &&
+           (Where.World.x <= (CharacterWorldPos.x + 615.f) + ReachX) &&
+           (Where.World.y >= (CharacterWorldPos.y + 335.f) - ReachY) &&
+           (Where.World.y <= (CharacterWorldPos.y + 335.f) + ReachY);
+}
+
+Rectangle Systems::GetHitbox(const Position& Where, const Appearance& Look, const Hitbox& Box, const Vector2 CharacterWorldPos)
+{
+    Vector2 ScreenPos{Vector2Subtract(Where.World, CharacterWorldPos)};
+    float Width{Look.Object.Sheet->Texture.width * Look.Scale};
+    float Height{Look.Object.Sheet->Texture.height * Look.Scale};
+
+    return Rectangle
+    {
+        ScreenPos.x + Width * Box.X,
+        ScreenPos.y + Height * Box.Y,
+        Width * Box.Width,
+        Height * Box.Height
+    };
+}
+
+bool Systems::WithinScreen(const Position& Where, const Critter& Animal, const Vector2 CharacterWorldPos)
+{
+    const Texture2D& Texture{Showing(Animal).Sheet->Texture};
+    float ReachX{static_cast<float>(GetScreenWidth()/2) + Texture.width * Animal.Scale};
+    float ReachY{static_cast<float>(GetScreenHeight()/2) + Texture.height * Animal.Scale};
+
+    return (Where.World.x >= (CharacterWorldPos.x + 615.f) - ReachX) &&
+           (Where.World.x <= (CharacterWorldPos.x + 615.f) + ReachX) &&
+           (Where.World.y >= (CharacterWorldPos.y + 335.f) - ReachY) &&
+           (Where.World.y <= (CharacterWorldPos.y + 335.f) + ReachY);
+}
+
+Rectangle Systems::GetHitbox(const Critter& Animal)
+{
+    float Width{Showing(Animal).Sheet->FrameWidth * Animal.Scale};
+    float Height{Showing(Animal).Sheet->FrameHeight * Animal.Scale};
+    const FrameBox& Box{Animal.Archetype->Collision};
+
+    return Rectangle
+    {
+        Animal.ScreenPos.x + Width * Box.X,
+        Animal.ScreenPos.y + Height * Box.Y,
+        Width * Box.Width,
+        Height * Box.Height
+    };
+}
+
+// Ticks the critters that were on screen last frame. Ground critters keep clear of props, trees,
+// monsters and each other, crows only of the monsters and ground critters.
+void Systems::Roam(Scene& Scenery, Props& Props, std::pmr::vector<Prop>& Trees, std::pmr::vector<Enemy>& Enemies, Background& World, Animator& Animations, const Vector2 CharacterWorldPos)
+{
+    const float DeltaTime{GetFrameTime()};
+
+    Scenery.Each<Critter, Position, Wander>([&](const Entity, Critter& Animal, Position& Where, Wander& Mind) {
+        Animal.ScreenPos = Vector2Subtract(Where.World, CharacterWorldPos);
+
+        if (!Animal.Visible) {
+            Stop(Animal, Animations);
+            return;
+        }
+
+        // only a left and a right row on every sheet
+        if (Mind.Step.x < 0.f) {
+            Animal.Face = Direction::LEFT;
+        }
+        if (Mind.Step.x > 0.f) {
+            Animal.Face = Direction::RIGHT;
+        }
+        Animal.Current = Pose(Mind);
+        Animal.Sprites.at(static_cast<size_t>(Animal.Current)).FrameY = (Animal.Face == Direction::LEFT || Animal.Face == Direction::UP) ? 1 : 0;
+        Play(Animal, Animations);
+
+        Animal.PrevWorldPos = Where.World;
+        Think(Where, Mind, *Animal.Archetype, DeltaTime);
+
+        float Width{Showing(Animal).Sheet->FrameWidth * Animal.Scale};
+        float Height{Showing(Animal).Sheet->FrameHeight * Animal.Scale};
+        if (Where.World.x < 0.f ||
+            Where.World.y < 0.f ||
+            Where.World.x > World.GetForestMapSize().x - Width ||
+            Where.World.y > World.GetForestMapSize().y - Height)
+        {
+            Where.World = Animal.PrevWorldPos;
+        }
+
+        for (auto* Group:{&Props.Under, &Props.Over}) {
+            if (!Animal.Flying) {
+                for (auto& PropType:*Group) {
+                    for (auto& Prop:PropType) {
+                        if (Prop.HasCollision() && Prop.IsSpawned()) {
+                            Rectangle Solid{Prop.GetCollisionRec(CharacterWorldPos)};
+                            Avoid(Animal, Where, Vector2{Solid.x, Solid.y});
+                        }
+                    }
+                }
+                for (auto& Tree:Trees) {
+                    if (Tree.HasCollision() && Tree.IsSpawned()) {
+                        Rectangle Solid{Tree.GetCollisionRec(CharacterWorldPos)};
+                        Avoid(Animal, Where, Vector2{Solid.x, Solid.y});
+                    }
+                }
+            }
+
+            for (auto& Enemy:Enemies) {
+                if (Enemy.GetType() != EnemyType::BOSS) {
+                    Avoid(Animal, Where, Enemy.GetEnemyPos());
+                }
+            }
+            Scenery.Each<Critter>([&](const Entity, const Critter& Other) {
+                if (&Other != &Animal && !Other.Flying) {
+                    Avoid(Animal, Where, Other.ScreenPos);
+                }
+            });
+        }
+    });
+
+    // monsters step around the ground critters in turn
+    for (auto& Enemy:Enemies) {
+        if (Enemy.IsAlive() && Enemy.IsSummoned() && !Enemy.IsDying() && Enemy.GetType() != EnemyType::BOSS && Enemy.WithinScreen(CharacterWorldPos)) {
+            Scenery.Each<Critter>([&](const Entity, const Critter& Animal) {
+                if (!Animal.Flying) {
+                    Enemy.Avoid(Animal.ScreenPos);
+                }
+            });
+        }
+    }
+}
+
+void Systems::Trample(Scene& Scenery, Character& Fox, std::pmr::vector<Enemy>& Enemies)
+{
+    Vector2 FoxWorldPos{Fox.GetWorldPos()};
+    Rectangle FoxRec{Fox.GetCollisionRec()};
+
+    // only walkers that can actually reach on screen grass are tested against it
+    std::vector<Rectangle> Walkers{};
+    for (auto& Enemy:Enemies) {
+        if (Enemy.IsAlive() && Enemy.IsSummoned() && Enemy.WithinScreen(FoxWorldPos)) {
+            Walkers.emplace_back(Enemy.GetCollisionRec());
+        }
+    }
+    Scenery.Each<Critter, Position>([&](const Entity, const Critter& Animal, const Position& Where) {
+        if (!Animal.Flying && WithinScreen(Where, Animal, FoxWorldPos)) {
+            Walkers.emplace_back(GetHitbox(Animal));
+        }
+    });
+
+    Scenery.Each<Sway, Position, Appearance, Hitbox>([&](const Entity, Sway& Grass, const Position& Where, const Appearance& Look, const Hitbox& Box) {
+        if (!WithinScreen(Where, Look, FoxWorldPos)) {
+            Grass.Active = false;
+            return;
+        }
+
+        Rectangle GrassRec{GetHitbox(Where, Look, Box, FoxWorldPos)};
+        Grass.Active = Fox.IsCollidable() && CheckCollisionRecs(FoxRec, GrassRec);
+
+        for (size_t i{}; i < Walkers.size() && !Grass.Active; ++i) {
+            Grass.Active = CheckCollisionRecs(Walkers[i], GrassRec);
+        }
+    });
+}
+
+void Systems::Draw(Scene& Scenery, const GameTexture& Textures, const DrawLayer Layer, const Vector2 CharacterWorldPos)
+{
+    Scenery.Each<Appearance, Position>([&](const Entity Handle, Appearance& Look, const Position& Where) {
+        if (Look.Layer != Layer || !WithinScreen(Where, Look, CharacterWorldPos)) {
+            return;
+        }
+
+        // swaying grass follows the global clock, still grass keeps the frame it stopped on
+        if (Sway* Grass{Scenery.Storage<Sway>().Find(Handle)}; Grass && Grass->Active) {
+            Look.Object.FrameX = Animator::AmbientFrame(Look.Object.Sheet->FramesX, Look.Object.Sheet->UpdateTime);
+        }
+
+        DrawTexturePro(Textures.Use(Look.Object.Sheet->Texture), Look.Object.GetSourceRec(), Look.Object.GetPosRec(Vector2Subtract(Where.World, CharacterWorldPos), Look.Scale), Vector2{}, 0.f, WHITE);
+    });
+}
+
+void Systems::DrawCritters(Scene& Scenery, const GameTexture& Textures, const Animator& Animations, const bool Flying, const Vector2 CharacterWorldPos)
+{
+    Scenery.Each<Critter, Position>([&](const Entity, Critter& Animal, const Position& Where) {
+        if (Animal.Flying != Flying) {
+            return;
+        }
+
+        Animal.Visible = WithinScreen(Where, Animal, CharacterWorldPos);
+        if (Animal.Visible) {
+            const Sprite& Look{Showing(Animal)};
+            const int Frame{Animations.GetFrame(Animal.Clips.at(static_cast<size_t>(Animal.Current)))};
+            DrawTexturePro(Textures.Use(Look.Sheet->Texture), Look.GetSourceRec(Frame), Look.GetPosRec(Animal.ScreenPos, Animal.Scale), Vector2{}, 0.f, WHITE);
+        }
+    });
+}
+
+void Systems::CollectTextures(Scene& Scenery, std::vector<Texture2D>& Into)
+{
+    Scenery.Each<Appearance>([&](const Entity, const Appearance& Look) {
+        Into.emplace_back(Look.Object.Sheet->Texture);
+    });
+    Scenery.Each<Critter>([&](const Entity, const Critter& Animal) {
+        for (const auto& Sprite:Animal.Sprites) {
+            Into.emplace_back(Sprite.Sheet->Texture);
+        }
+    });
+}
+
+void Systems::DrawHitboxes(Scene& Scenery, const DrawLayer Layer, const Vector2 CharacterWorldPos, const Color RecColor)
+{
+    Scenery.Each<Hitbox, Position, Appearance>([&](const Entity, const Hitbox& Box, const Position& Where, const Appearance& Look) {
+        if (Look.Layer == Layer && WithinScreen(Where, Look, CharacterWorldPos)) {
+            DrawRectangleRec(GetHitbox(Where, Look, Box, CharacterWorldPos), RecColor);
+        }
+    });
+}
+
+void Systems::DrawCritterHitboxes(Scene& Scenery, const bool Flying, const Color RecColor)
+{
+    Scenery.Each<Critter>([&](const Entity, const Critter& Animal) {
+        if (Animal.Flying == Flying && Animal.Visible) {
+            DrawRectangleRec(GetHitbox(Animal), RecColor);
+        }
+    });
+}
@@ -1,7 +1,7 @@
 #include "sprite.hpp"
 
-Sprite::Sprite(const Texture2D& Texture, const int MaxFramesX, const int MaxFramesY, const float UpdateSpeed) 
-    : Texture{Texture}, MaxFramesX{MaxFramesX}, MaxFramesY{MaxFramesY}, UpdateTime{UpdateSpeed}
+Sprite::Sprite(const SpriteSheet& Sheet) 
+    : Sheet{&Sheet}
 {
 
 }
@@ -10,38 +10,24 @@ void Sprite::Tick(float DeltaTime)
 {
     // update animation frame
     RunningTime += DeltaTime;
-    if (RunningTime >= UpdateTime) {
-        PreviousFrame = FrameX;
+    if (RunningTime >= Sheet->UpdateTime) {
         ++FrameX;
         RunningTime = 0.f;
-        if (FrameX > MaxFramesX) {
+        if (FrameX > Sheet->FramesX) {
             FrameX = 0;
         }
     }
 }
 
-Rectangle Sprite::GetSourceRec()
-{
-    // source rectangle that shows what to draw
-    Rectangle Source {
-        static_cast<float>(FrameX * Texture.width / MaxFramesX),
-        static_cast<float>(FrameY * Texture.height / MaxFramesY),
-        static_cast<float>(Texture.width / MaxFramesX),
-        static_cast<float>(Texture.height / MaxFramesY)
-    };
-
-    return Source;
-}
-
-Rectangle Sprite::GetPosRec(const Vector2& ScreenPos, const float Scale)
+Rectangle Sprite::GetPosRec(const Vector2& ScreenPos, const float Scale) const
 {
     // destination rectangle that shows where to draw
     Rectangle Destination {
         ScreenPos.x,
         ScreenPos.y,
-        static_cast<float>(Texture.width/MaxFramesX) * Scale,
-        static_cast<float>(Texture.height/MaxFramesY) * Scale
+        Sheet->FrameWidth * Scale,
+        Sheet->FrameHeight * Scale
     };
 
     return Destination;
-}
\ No newline at end of file
+}
@@ -0,0 +1,46 @@
+#include "spritesheet.hpp"
+
+namespace
+{
+    SpriteSheet Build(const Texture2D& Texture, const int FramesX, const int FramesY, const float UpdateTime)
+    {
+        SpriteSheet Sheet{Texture, FramesX, FramesY, UpdateTime};
+
+        Sheet.FrameWidth = static_cast<float>(Texture.width / FramesX);
+        Sheet.FrameHeight = static_cast<float>(Texture.height / FramesY);
+
+        // same integer math Sprite::GetSourceRec used to do per call
+        for (int y = 0; y < FramesY; ++y) {
+            for (int x = 0; x <= FramesX; ++x) {
+                Sheet.Frames.emplace_back(Rectangle{
+                    static_cast<float>(x * Texture.width / FramesX),
+                    static_cast<float>(y * Texture.height / FramesY),
+                    Sheet.FrameWidth,
+                    Sheet.FrameHeight
+                });
+            }
+        }
+
+        return Sheet;
+    }
+}
+
+SpriteSheets::SpriteSheets(const GameTexture& Textures)
+{
+    for (const auto& Layout:SheetLayouts) {
+        Sheets[static_cast<size_t>(Layout.ID)] = Build(Textures.*Layout.Texture, Layout.FramesX, Layout.FramesY, Layout.UpdateTime);
+    }
+}
+
+const SpriteSheet& SpriteSheets::Still(const Texture2D& Texture)
+{
+    // map nodes never move, so the reference stays good after the lock is released
+    std::lock_guard<std::mutex> Lock{StillsLock};
+    auto Sheet{Stills.find(Texture.id)};
+
+    if (Sheet == Stills.end()) {
+        Sheet = Stills.emplace(Texture.id, Build(Texture, 1, 1, 1.f/8.f)).first;
+    }
+
+    return Sheet->second;
+}
@@ -0,0 +1,148 @@
+#include "ui.hpp"
+#include <algorithm>
+
+void UILayer::Submit(const Quad& Item)
+{
+    Queue.emplace_back(Item);
+}
+
+void UILayer::Submit(const std::vector<Quad>& Items, const Vector2 Offset)
+{
+    for (auto Item:Items) {
+        Item.Dest.x += Offset.x;
+        Item.Dest.y += Offset.y;
+        Queue.emplace_back(Item);
+    }
+}
+
+void UILayer::Flush(const GameTexture& Textures)
+{
+    // layers only, submission order is the painter's order within a layer; raylib still batches
+    // the quads that share a texture as long as they sit next to each other in the queue
+    std::stable_sort(Queue.begin(), Queue.end(), [](const Quad& A, const Quad& B) {return A.Layer < B.Layer;});
+
+    for (const auto& Item:Queue) {
+        if (Item.Texture.id == 0) {
+            DrawRectangleRec(Item.Dest, Item.Tint);
+        }
+        else {
+            DrawTexturePro(Textures.Use(Item.Texture), Item.Source, Item.Dest, Vector2{}, 0.f, Item.Tint);
+        }
+    }
+
+    Queue.clear();
+}
+
+// ---------------------------------------------------------------------
+
+void HealthBar::Update(const GameTexture& GameTextures, const int Health, const int MaxHP)
+{
+    if (Health == CachedHealth && MaxHP == CachedMaxHP) {
+        return;
+    }
+
+    CachedHealth = Health;
+    CachedMaxHP = MaxHP;
+    Segments.clear();
+
+    float SingleBarWidth{static_cast<float>(GameTextures.LifebarLeftEmpty.width) * Scale};
+    Width = SingleBarWidth * MaxHP;
+
+    for (auto i = 1; i <= MaxHP; ++i) {
+        Texture2D Segment{};
+
+        if (i <= Health) {
+            // far left, far right or middle of lifebar
+            Segment = (i == 1) ? GameTextures.LifebarLeftFilled : (i == MaxHP) ? GameTextures.LifebarRightFilled : GameTextures.LifebarMiddleFilled;
+        }
+        else {
+            Segment = (i == 1) ? GameTextures.LifebarLeftEmpty : (i == MaxHP) ? GameTextures.LifebarRightEmpty : GameTextures.LifebarMiddleEmpty;
+        }
+
+        Segments.emplace_back(Quad{
+            Segment,
+            Rectangle{0.f, 0.f, static_cast<float>(Segment.width), static_cast<float>(Segment.height)},
+            Rectangle{SingleBarWidth * (i - 1), 0.f, Segment.width * Scale, Segment.height * Scale},
+            WHITE
+        });
+    }
+}
+
+void HealthBar::Draw(UILayer& Interface, const Vector2 Position) const
+{
+    Interface.Submit(Segments, Position);
+}
+
+// ---------------------------------------------------------------------
+
+MenuPanel::MenuPanel(const std::vector<MenuText>& Lines, const std::vector<Rectangle>& Options, const Color Highlight)
+    : Lines{Lines}, Options{Options}, Highlight{Highlight}
+{
+
+}
+
+MenuPanel::~MenuPanel()
+{
+    if (Composed) {
+        UnloadRenderTexture(Target);
+    }
+}
+
+MenuPanel::MenuPanel(MenuPanel&& Other) noexcept
+    : Lines{std::move(Other.Lines)}, Options{std::move(Other.Options)}, Target{Other.Target}, Bounds{Other.Bounds},
+      Selection{Other.Selection}, Highlight{Other.Highlight}, Selected{Other.Selected}, Composed{Other.Composed}
+{
+    Other.Composed = false;
+}
+
+void MenuPanel::Select(const int Option)
+{
+    if (Option == Selected || Option < 0 || Option >= static_cast<int>(Options.size())) {
+        return;
+    }
+
+    Selected = Option;
+    Selection = Quad{Texture2D{}, Rectangle{}, Options.at(Selected), Highlight, 1};
+}
+
+void MenuPanel::Compose()
+{
+    // fit the render texture around every line of text
+    float Left{static_cast<float>(GetScreenWidth())};
+    float Top{static_cast<float>(GetScreenHeight())};
+    float Right{0.f};
+    float Bottom{0.f};
+
+    for (const auto& Line:Lines) {
+        Left = std::min(Left, static_cast<float>(Line.X));
+        Top = std::min(Top, static_cast<float>(Line.Y));
+        Right = std::max(Right, static_cast<float>(Line.X + MeasureText(Line.Text.c_str(), Line.FontSize)));
+        Bottom = std::max(Bottom, static_cast<float>(Line.Y + Line.FontSize));
+    }
+
+    Bounds = Rectangle{Left, Top, Right - Left, Bottom - Top};
+    Target = LoadRenderTexture(static_cast<int>(Bounds.width), static_cast<int>(Bounds.height));
+
+    BeginTextureMode(Target);
+    ClearBackground(BLANK);
+    for (const auto& Line:Lines) {
+        DrawText(Line.Text.c_str(), Line.X - static_cast<int>(Left), Line.Y - static_cast<int>(Top), Line.FontSize, WHITE);
+    }
+    EndTextureMode();
+
+    Composed = true;
+}
+
+void MenuPanel::Draw(UILayer& Interface)
+{
+    if (!Composed) {
+        Compose();
+    }
+
+    // render textures are stored upside down
+    Interface.Submit(Quad{Target.texture, Rectangle{0.f, 0.f, Bounds.width, -Bounds.height}, Bounds, WHITE});
+
+    if (Selected >= 0) {
+        Interface.Submit(Selection);
+    }
+}
@@ -0,0 +1,191 @@
+#include <algorithm>
+#include <raymath.h>
+#include "voices.hpp"
+
+Voices::Voices()
+{
+    // only the cues every area shares are requested up front
+    for (size_t i{}; i < Cues.size(); ++i) {
+        if (Wanted(i)) {
+            Load(i);
+        }
+    }
+}
+
+Voices::~Voices()
+{
+    for (size_t i{}; i < Cues.size(); ++i) {
+        Unload(i);
+    }
+}
+
+void Voices::Enter(const CueGroup Area)
+{
+    if (Area == Current) {
+        return;
+    }
+    Current = Area;
+
+    for (size_t i{}; i < Cues.size(); ++i) {
+        if (Wanted(i) && State[i] == Residency::UNLOADED) {
+            Load(i);
+        }
+        else if (!Wanted(i) && State[i] == Residency::READY) {
+            Unload(i);
+        }
+    }
+}
+
+// Builds voices for every wave the loader finished, then plays the queued cues. A cue whose
+// group was left while it was decoding is thrown away here instead.
+void Voices::Poll()
+{
+    Loader.Collect(Arrived);
+
+    for (auto& Wave:Arrived) {
+        if (Wanted(Wave.Key)) {
+            // every voice gets its own buffer so it can be stopped or restarted alone
+            std::vector<Voice>& Slots{Pool[Wave.Key]};
+            for (int i{}; i < Cues[Wave.Key].Limit; ++i) {
+                Slots.emplace_back(Voice{LoadSoundFromWave(Wave.Samples)});
+            }
+            State[Wave.Key] = Residency::READY;
+        }
+        else {
+            State[Wave.Key] = Residency::UNLOADED;
+        }
+        if (Wave.Owned) {
+            UnloadWave(Wave.Samples);
+        }
+    }
+    Arrived.clear();
+
+    // everything gameplay asked for since the last Poll, in the order it was posted
+    CueEvent Event{};
+    while (Requests.Pop(Event)) {
+        Emit(Event);
+    }
+}
+
+bool Voices::Emit(const CueEvent& Event)
+{
+    if (!Event.Positioned) {
+        return Start(Event.Effect, Event.Volume, 0.f, 0.5f);
+    }
+
+    Vector2 Offset{Vector2Subtract(Event.Emitter, Listener)};
+    float Distance{Vector2Length(Offset)};
+
+    if (Distance >= AudibleRadius) {
+        return false;
+    }
+
+    // quadratic fade to silence at the edge, raylib 4.2 pans towards the left as pan goes to 1
+    float Fade{1.f - Distance / AudibleRadius};
+    float Side{Clamp(Offset.x / PanWidth, -1.f, 1.f)};
+
+    return Start(Event.Effect, Event.Volume * Fade * Fade, Distance, 0.5f - Side * MaxPan);
+}
+
+bool Voices::Start(const Cue Effect, const float Volume, const float Distance, const float Pan)
+{
+    float Priority{Cues[static_cast<size_t>(Effect)].Importance * Falloff / (Falloff + Distance)};
+
+    Voice* Free{Claim(Effect, Priority)};
+    if (!Free) {
+        return false;
+    }
+
+    // an idle voice still has to fit under the mixer cap
+    if (!IsSoundPlaying(Free->Instance) && Sounding() >= MaxVoices) {
+        Voice* Victim{Quietest(Priority)};
+        if (!Victim) {
+            return false;
+        }
+        StopSound(Victim->Instance);
+    }
+
+    Free->Priority = Priority;
+    SetSoundVolume(Free->Instance, Volume);
+    SetSoundPan(Free->Instance, Pan);
+    PlaySound(Free->Instance);
+    return true;
+}
+
+void Voices::StopAll()
+{
+    for (auto& Slots:Pool) {
+        for (auto& Slot:Slots) {
+            StopSound(Slot.Instance);
+        }
+    }
+}
+
+// True once every cue of the group last entered has finished decoding
+bool Voices::IsSettled() const
+{
+    return std::none_of(State.begin(), State.end(), [](const Residency Cue) {return Cue == Residency::LOADING;});
+}
+
+int Voices::Sounding()
+{
+    int Count{};
+    for (auto& Slots:Pool) {
+        for (auto& Slot:Slots) {
+            Count += IsSoundPlaying(Slot.Instance);
+        }
+    }
+    return Count;
+}
+
+// An idle voice of the cue, otherwise its quietest voice if the new sound ranks at least as high
+Voices::Voice* Voices::Claim(const Cue Effect, const float Priority)
+{
+    Voice* Candidate{nullptr};
+
+    for (auto& Slot:Pool[static_cast<size_t>(Effect)]) {
+        if (!IsSoundPlaying(Slot.Instance)) {
+            return &Slot;
+        }
+        if (Slot.Priority <= Priority && (!Candidate || Slot.Priority < Candidate->Priority)) {
+            Candidate = &Slot;
+        }
+    }
+    return Candidate;
+}
+
+// The quietest sounding voice in the mixer that ranks no higher than Priority
+Voices::Voice* Voices::Quietest(const float Priority)
+{
+    Voice* Candidate{nullptr};
+
+    for (auto& Slots:Pool) {
+        for (auto& Slot:Slots) {
+            if (IsSoundPlaying(Slot.Instance) && Slot.Priority <= Priority && (!Candidate || Slot.Priority < Candidate->Priority)) {
+                Candidate = &Slot;
+            }
+        }
+    }
+    return Candidate;
+}
+
+bool Voices::Wanted(const size_t Index) const
+{
+    return Cues[Index].Group == CueGroup::COMMON || Cues[Index].Group == Current;
+}
+
+void Voices::Load(const size_t Index)
+{
+    State[Index] = Residency::LOADING;
+    Loader.Request(Index, GetAsset(Cues[Index].Sound).Path);
+}
+
+void Voices::Unload(const size_t Index)
+{
+    for (auto& Slot:Pool[Index]) {
+        StopSound(Slot.Instance);
+        UnloadSound(Slot.Instance);
+    }
+    Pool[Index].clear();
+    State[Index] = Residency::UNLOADED;
+}
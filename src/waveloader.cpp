@@ -0,0 +1,64 @@
+#include "assetarchive.hpp"
+#include "waveloader.hpp"
+
+WaveLoader::WaveLoader()
+    : Worker{&WaveLoader::Run, this}
+{
+
+}
+
+WaveLoader::~WaveLoader()
+{
+    {
+        std::lock_guard<std::mutex> Guard{Lock};
+        Quit = true;
+    }
+    Wake.notify_one();
+    Worker.join();
+
+    // anything decoded but never collected is ours to free
+    for (auto& Wave:Finished) {
+        if (Wave.Owned) {
+            UnloadWave(Wave.Samples);
+        }
+    }
+}
+
+void WaveLoader::Request(const size_t Key, const char* Path)
+{
+    {
+        std::lock_guard<std::mutex> Guard{Lock};
+        Pending.emplace_back(Job{Key, Path});
+    }
+    Wake.notify_one();
+}
+
+void WaveLoader::Collect(std::vector<Decoded>& Ready)
+{
+    std::lock_guard<std::mutex> Guard{Lock};
+    Ready.insert(Ready.end(), Finished.begin(), Finished.end());
+    Finished.clear();
+}
+
+void WaveLoader::Run()
+{
+    std::unique_lock<std::mutex> Guard{Lock};
+
+    while (true) {
+        Wake.wait(Guard, [this]{return Quit || !Pending.empty();});
+        if (Quit) {
+            return;
+        }
+
+        Job Next{Pending.front()};
+        Pending.pop_front();
+
+        // decode without holding the lock so Request and Collect never wait on file I/O
+        Guard.unlock();
+        bool Owned{};
+        Wave Samples{Assets::LoadWave(Next.Path, Owned)};
+        Guard.lock();
+
+        Finished.emplace_back(Decoded{Next.Key, Samples, Owned});
+    }
+}
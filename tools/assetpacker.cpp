@@ -0,0 +1,146 @@
+// Offline asset packer. Decodes every image and sound under the given directories once and
+// writes them into a single archive the game maps at startup.
+//
+//     AssetPacker assets.pak sprites audio
+//
+// Run it from a directory holding sprites/ and audio/ so the stored paths match the ones the
+// game loads. The build does this from the source tree whenever one of the assets changes.
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "assetarchive.hpp"
+
+namespace
+{
+    struct Source
+    {
+        std::string Path{};
+        Pack::Entry Item{};
+        std::vector<unsigned char> Bytes{};
+    };
+
+    bool Decode(Source& Asset)
+    {
+        std::string Extension{std::filesystem::path{Asset.Path}.extension().string()};
+        std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](unsigned char c) {return static_cast<char>(std::tolower(c));});
+
+        if (Extension == ".png") {
+            Image Pixels{LoadImage(Asset.Path.c_str())};
+            if (!Pixels.data) {
+                return false;
+            }
+            ImageFormat(&Pixels, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+            const unsigned char* Data{static_cast<const unsigned char*>(Pixels.data)};
+            Asset.Item.Type = Pack::Kind::IMAGE;
+            Asset.Item.Width = static_cast<uint32_t>(Pixels.width);
+            Asset.Item.Height = static_cast<uint32_t>(Pixels.height);
+            Asset.Item.Format = static_cast<uint32_t>(Pixels.format);
+            Asset.Bytes.assign(Data, Data + GetPixelDataSize(Pixels.width, Pixels.height, Pixels.format));
+            UnloadImage(Pixels);
+            return true;
+        }
+
+        if (Extension == ".wav") {
+            Wave Samples{LoadWave(Asset.Path.c_str())};
+            if (!Samples.data) {
+                return false;
+            }
+
+            const unsigned char* Data{static_cast<const unsigned char*>(Samples.data)};
+            Asset.Item.Type = Pack::Kind::WAVE;
+            Asset.Item.Frames = Samples.frameCount;
+            Asset.Item.SampleRate = Samples.sampleRate;
+            Asset.Item.SampleSize = Samples.sampleSize;
+            Asset.Item.Channels = Samples.channels;
+            Asset.Bytes.assign(Data, Data + size_t{Samples.frameCount} * Samples.channels * Samples.sampleSize / 8);
+            UnloadWave(Samples);
+            return true;
+        }
+
+        if (Extension == ".mp3" || Extension == ".ogg") {
+            // music is streamed, decoding it whole would cost far more memory than it saves time
+            unsigned int Size{};
+            unsigned char* Data{LoadFileData(Asset.Path.c_str(), &Size)};
+            if (!Data) {
+                return false;
+            }
+
+            Asset.Item.Type = Pack::Kind::STREAM;
+            Asset.Bytes.assign(Data, Data + Size);
+            UnloadFileData(Data);
+            return true;
+        }
+
+        return false;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3) {
+        std::fprintf(stderr, "usage: %s <archive> <directory>...\n", argv[0]);
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    std::vector<Source> Assets{};
+    for (int i{2}; i < argc; ++i) {
+        for (const auto& File:std::filesystem::recursive_directory_iterator{argv[i]}) {
+            if (!File.is_regular_file()) {
+                continue;
+            }
+
+            Source Asset{File.path().generic_string()};
+            if (Asset.Path.size() >= Pack::PathLength) {
+                std::fprintf(stderr, "skipping %s: path longer than %zu characters\n", Asset.Path.c_str(), Pack::PathLength - 1);
+                continue;
+            }
+            if (Decode(Asset)) {
+                std::memcpy(Asset.Item.Path, Asset.Path.c_str(), Asset.Path.size());
+                Assets.emplace_back(std::move(Asset));
+            }
+        }
+    }
+
+    // the game binary searches the index
+    std::sort(Assets.begin(), Assets.end(), [](const Source& A, const Source& B) {return A.Path < B.Path;});
+
+    auto Align = [](uint64_t Offset) {return (Offset + Pack::Alignment - 1) / Pack::Alignment * Pack::Alignment;};
+
+    uint64_t Offset{sizeof(Pack::Header) + Assets.size() * sizeof(Pack::Entry)};
+    for (auto& Asset:Assets) {
+        Offset = Align(Offset);
+        Asset.Item.Offset = Offset;
+        Asset.Item.Size = Asset.Bytes.size();
+        Offset += Asset.Bytes.size();
+    }
+
+    std::ofstream Archive{argv[1], std::ios::binary};
+    if (!Archive) {
+        std::fprintf(stderr, "could not open %s for writing\n", argv[1]);
+        return 1;
+    }
+
+    Pack::Header Top{Pack::Magic, Pack::Version, static_cast<uint32_t>(Assets.size()), 0};
+    Archive.write(reinterpret_cast<const char*>(&Top), sizeof(Top));
+    for (const auto& Asset:Assets) {
+        Archive.write(reinterpret_cast<const char*>(&Asset.Item), sizeof(Asset.Item));
+    }
+
+    const char Padding[Pack::Alignment]{};
+    for (const auto& Asset:Assets) {
+        Archive.write(Padding, static_cast<std::streamsize>(Asset.Item.Offset - static_cast<uint64_t>(Archive.tellp())));
+        Archive.write(reinterpret_cast<const char*>(Asset.Bytes.data()), static_cast<std::streamsize>(Asset.Bytes.size()));
+    }
+
+    std::printf("packed %zu assets into %s (%llu bytes)\n", Assets.size(), argv[1], static_cast<unsigned long long>(Offset));
+    return Archive ? 0 : 1;
+}
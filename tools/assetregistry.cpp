@@ -0,0 +1,216 @@
+// Build step that writes assetregistry.hpp from the files under sprites/ and audio/. Every
+// image and sound gets a constexpr ID named after its path, an entry in a path table and the
+// metadata the game would otherwise have to open the file for.
+//
+//     AssetRegistry <source dir> <output header>
+//
+// The output is always rewritten; the build copies it over the real header only when it differs.
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+    namespace fs = std::filesystem;
+
+    struct Asset
+    {
+        std::string Path{};
+        std::string Name{};
+        uint32_t Width{};           // images
+        uint32_t Height{};
+        uint32_t Frames{};          // sounds, zero for compressed streams
+        uint32_t SampleRate{};
+        uint32_t Channels{};
+        uint32_t SampleSize{};
+    };
+
+    uint32_t BigEndian(const unsigned char* Bytes)
+    {
+        return (uint32_t{Bytes[0]} << 24) | (uint32_t{Bytes[1]} << 16) | (uint32_t{Bytes[2]} << 8) | uint32_t{Bytes[3]};
+    }
+
+    uint32_t LittleEndian(const unsigned char* Bytes, const int Count)
+    {
+        uint32_t Value{};
+        for (int i{Count - 1}; i >= 0; --i) {
+            Value = (Value << 8) | Bytes[i];
+        }
+        return Value;
+    }
+
+    // "sprites/enemies/bear/brown_attack.png" becomes EnemiesBearBrownAttack
+    std::string Identifier(const fs::path& Relative)
+    {
+        std::string Name{};
+        bool Upper{true};
+
+        for (const char c:(Relative.parent_path() / Relative.stem()).generic_string()) {
+            if (!std::isalnum(static_cast<unsigned char>(c))) {
+                Upper = true;
+                continue;
+            }
+            Name += Upper ? static_cast<char>(std::toupper(static_cast<unsigned char>(c))) : c;
+            Upper = false;
+        }
+        return Name;
+    }
+
+    bool ReadImage(const fs::path& File, Asset& Image)
+    {
+        // a PNG states its size in the IHDR chunk straight after the signature
+        unsigned char Head[24]{};
+        std::ifstream Stream{File, std::ios::binary};
+        if (!Stream.read(reinterpret_cast<char*>(Head), sizeof(Head)) || std::memcmp(Head + 12, "IHDR", 4) != 0) {
+            return false;
+        }
+
+        Image.Width = BigEndian(Head + 16);
+        Image.Height = BigEndian(Head + 20);
+        return true;
+    }
+
+    bool ReadSound(const fs::path& File, Asset& Sound)
+    {
+        if (File.extension() != ".wav") {
+            return true;
+        }
+
+        std::ifstream Stream{File, std::ios::binary};
+        unsigned char Riff[12]{};
+        if (!Stream.read(reinterpret_cast<char*>(Riff), sizeof(Riff)) || std::memcmp(Riff, "RIFF", 4) != 0 || std::memcmp(Riff + 8, "WAVE", 4) != 0) {
+            return false;
+        }
+
+        // walk the chunks until both the format and the sample data have been seen
+        unsigned char Chunk[8]{};
+        uint32_t DataSize{};
+        while (Stream.read(reinterpret_cast<char*>(Chunk), sizeof(Chunk))) {
+            uint32_t Size{LittleEndian(Chunk + 4, 4)};
+
+            if (std::memcmp(Chunk, "fmt ", 4) == 0) {
+                unsigned char Format[16]{};
+                if (Size < sizeof(Format) || !Stream.read(reinterpret_cast<char*>(Format), sizeof(Format))) {
+                    return false;
+                }
+                Sound.Channels = LittleEndian(Format + 2, 2);
+                Sound.SampleRate = LittleEndian(Format + 4, 4);
+                Sound.SampleSize = LittleEndian(Format + 14, 2);
+                Size -= sizeof(Format);
+            }
+            else if (std::memcmp(Chunk, "data", 4) == 0) {
+                DataSize = Size;
+            }
+
+            Stream.seekg(Size + (Size & 1), std::ios::cur);
+        }
+
+        if (Sound.Channels == 0 || Sound.SampleSize == 0) {
+            return false;
+        }
+        Sound.Frames = DataSize / (Sound.Channels * Sound.SampleSize / 8);
+        return true;
+    }
+
+    std::vector<Asset> Collect(const fs::path& Root, const char* Directory, const std::set<std::string>& Extensions, bool (*Read)(const fs::path&, Asset&))
+    {
+        std::vector<Asset> Found{};
+        const fs::path Base{Root / Directory};
+
+        for (const auto& File:fs::recursive_directory_iterator{Base}) {
+            if (!File.is_regular_file() || !Extensions.contains(File.path().extension().string())) {
+                continue;
+            }
+
+            Asset Entry{(fs::path{Directory} / fs::relative(File.path(), Base)).generic_string(), Identifier(fs::relative(File.path(), Base))};
+            if (!Read(File.path(), Entry)) {
+                std::fprintf(stderr, "AssetRegistry: could not read %s\n", Entry.Path.c_str());
+                continue;
+            }
+            Found.emplace_back(Entry);
+        }
+
+        // stable IDs regardless of directory iteration order
+        std::sort(Found.begin(), Found.end(), [](const Asset& A, const Asset& B) {return A.Name < B.Name;});
+        return Found;
+    }
+
+    bool Unique(const std::vector<Asset>& Assets)
+    {
+        for (size_t i{1}; i < Assets.size(); ++i) {
+            if (Assets[i].Name == Assets[i - 1].Name) {
+                std::fprintf(stderr, "AssetRegistry: %s and %s both map to %s\n", Assets[i - 1].Path.c_str(), Assets[i].Path.c_str(), Assets[i].Name.c_str());
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 3) {
+        std::fprintf(stderr, "usage: %s <source dir> <output header>\n", argv[0]);
+        return 1;
+    }
+
+    const fs::path Root{argv[1]};
+    std::vector<Asset> Textures{Collect(Root, "sprites", {".png"}, ReadImage)};
+    std::vector<Asset> Sounds{Collect(Root, "audio", {".wav", ".ogg", ".mp3"}, ReadSound)};
+
+    if (!Unique(Textures) || !Unique(Sounds)) {
+        return 1;
+    }
+
+    std::string Out{};
+    Out += "// Generated by AssetRegistry from the sprites/ and audio/ trees. Do not edit.\n\n";
+    Out += "#ifndef ASSETREGISTRY_HPP\n#define ASSETREGISTRY_HPP\n\n";
+    Out += "#include <array>\n#include <cstddef>\n#include <cstdint>\n\n";
+
+    Out += "enum class TextureID : uint16_t\n{\n";
+    for (const auto& Texture:Textures) {
+        Out += "    " + Texture.Name + ",\n";
+    }
+    Out += "    COUNT\n};\n\n";
+
+    Out += "enum class SoundID : uint16_t\n{\n";
+    for (const auto& Sound:Sounds) {
+        Out += "    " + Sound.Name + ",\n";
+    }
+    Out += "    COUNT\n};\n\n";
+
+    Out += "struct TextureAsset\n{\n    const char* Path{};\n    int Width{};\n    int Height{};\n};\n\n";
+    Out += "// Frames is zero for music, which stays compressed and is never decoded whole\n";
+    Out += "struct SoundAsset\n{\n    const char* Path{};\n    unsigned int Frames{};\n    unsigned int SampleRate{};\n    unsigned int Channels{};\n    unsigned int SampleSize{};\n};\n\n";
+
+    Out += "inline constexpr std::array<TextureAsset, static_cast<size_t>(TextureID::COUNT)> TextureAssets\n{{\n";
+    for (const auto& Texture:Textures) {
+        Out += "    {\"" + Texture.Path + "\", " + std::to_string(Texture.Width) + ", " + std::to_string(Texture.Height) + "},\n";
+    }
+    Out += "}};\n\n";
+
+    Out += "inline constexpr std::array<SoundAsset, static_cast<size_t>(SoundID::COUNT)> SoundAssets\n{{\n";
+    for (const auto& Sound:Sounds) {
+        Out += "    {\"" + Sound.Path + "\", " + std::to_string(Sound.Frames) + ", " + std::to_string(Sound.SampleRate) + ", " +
+               std::to_string(Sound.Channels) + ", " + std::to_string(Sound.SampleSize) + "},\n";
+    }
+    Out += "}};\n\n";
+
+    Out += "constexpr const TextureAsset& GetAsset(const TextureID ID) {return TextureAssets[static_cast<size_t>(ID)];}\n";
+    Out += "constexpr const SoundAsset& GetAsset(const SoundID ID) {return SoundAssets[static_cast<size_t>(ID)];}\n\n";
+    Out += "#endif // ASSETREGISTRY_HPP\n";
+
+    const fs::path Output{argv[2]};
+    fs::create_directories(Output.parent_path());
+    std::ofstream Header{Output, std::ios::binary};
+    Header << Out;
+    return Header ? 0 : 1;
+}